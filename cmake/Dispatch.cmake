@@ -0,0 +1,92 @@
+# Builds the same kernel sources once per ISA target and bundles them into one static library.
+# Each copy is compiled with the target's instruction set and a pinned `UI_CPU_SSE_LEVEL`, so
+# `UI_DISPATCH_TARGET` (see include/ui/dispatch.hpp) expands to the matching namespace.
+#
+#   ui_add_dispatch_library(my_kernels
+#       SOURCES  src/kernels.cpp
+#       TARGETS  emul sse41 avx2 skx
+#   )
+#
+# Supported targets: emul, sse41, sse42, avx, avx2, skx, neon.
+
+function(ui_dispatch_target_flags target_name out_flags out_defs)
+    set(flags "")
+    set(defs "")
+
+    if(target_name STREQUAL "emul")
+        set(defs "UI_NO_NATIVE_VECTOR")
+    elseif(target_name STREQUAL "sse41")
+        set(defs "UI_CPU_SSE_LEVEL=41")
+        if(NOT MSVC)
+            set(flags -msse4.1)
+        endif()
+    elseif(target_name STREQUAL "sse42")
+        set(defs "UI_CPU_SSE_LEVEL=42")
+        if(NOT MSVC)
+            set(flags -msse4.2 -mpopcnt)
+        endif()
+    elseif(target_name STREQUAL "avx")
+        set(defs "UI_CPU_SSE_LEVEL=51")
+        if(MSVC)
+            set(flags /arch:AVX)
+        else()
+            set(flags -mavx -mpopcnt)
+        endif()
+    elseif(target_name STREQUAL "avx2")
+        set(defs "UI_CPU_SSE_LEVEL=52")
+        if(MSVC)
+            set(flags /arch:AVX2)
+        else()
+            set(flags -mavx2 -mfma -mf16c -mbmi -mbmi2 -mlzcnt -mpopcnt)
+        endif()
+    elseif(target_name STREQUAL "skx")
+        set(defs "UI_CPU_SSE_LEVEL=60")
+        if(MSVC)
+            set(flags /arch:AVX512)
+        else()
+            set(flags -mavx2 -mfma -mf16c -mbmi -mbmi2 -mlzcnt -mpopcnt
+                -mavx512f -mavx512dq -mavx512cd -mavx512bw -mavx512vl)
+        endif()
+    elseif(target_name STREQUAL "neon")
+        # Advanced SIMD is part of the AArch64 baseline; nothing to add.
+    else()
+        message(FATAL_ERROR "ui_add_dispatch_library: unknown target '${target_name}'")
+    endif()
+
+    set(${out_flags} ${flags} PARENT_SCOPE)
+    set(${out_defs} ${defs} PARENT_SCOPE)
+endfunction(ui_dispatch_target_flags)
+
+function(ui_add_dispatch_library name)
+    cmake_parse_arguments(UI_DISPATCH "" "" "SOURCES;TARGETS" ${ARGN})
+
+    if(NOT UI_DISPATCH_SOURCES)
+        message(FATAL_ERROR "ui_add_dispatch_library: no SOURCES given for '${name}'")
+    endif()
+    if(NOT UI_DISPATCH_TARGETS)
+        set(UI_DISPATCH_TARGETS emul)
+    endif()
+
+    add_library(${name} STATIC)
+    target_link_libraries(${name} PUBLIC ui_core)
+
+    foreach(isa IN LISTS UI_DISPATCH_TARGETS)
+        set(object_target "${name}_${isa}")
+        ui_dispatch_target_flags(${isa} isa_flags isa_defs)
+
+        add_library(${object_target} OBJECT ${UI_DISPATCH_SOURCES})
+        target_link_libraries(${object_target} PRIVATE ui_core)
+
+        # The global `-march=native` would let the compiler use instructions of the build machine
+        # inside the narrower copies, so every copy gets exactly the flags of its target.
+        get_target_property(options ${object_target} COMPILE_OPTIONS)
+        if(options)
+            list(REMOVE_ITEM options "-march=native" "/arch:AVX2")
+            set_target_properties(${object_target} PROPERTIES COMPILE_OPTIONS "${options}")
+        endif()
+
+        target_compile_options(${object_target} PRIVATE ${isa_flags})
+        target_compile_definitions(${object_target} PRIVATE ${isa_defs})
+        target_sources(${name} PRIVATE $<TARGET_OBJECTS:${object_target}>)
+    endforeach()
+endfunction(ui_add_dispatch_library)
@@ -0,0 +1,248 @@
+#ifndef AMT_UI_ACTIVATION_HPP
+#define AMT_UI_ACTIVATION_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "float.hpp"
+#include "transcendental.hpp"
+#include "polynomial.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+
+// Activation functions
+// --------------------
+// Built on `exp` and a reciprocal from `reciprocal_estimate` refined with `reciprocal_refine`.
+// Every quotient is arranged so that the divisor lies in (1, 2], which keeps the estimate away
+// from zero and infinity and the Newton steps well conditioned; the rounding errors of `1 +- e`
+// are carried into one remainder step:
+//
+//     sigmoid(x) = 1 / (1 + e) or e / (1 + e),  e = exp(-|x|)
+//     tanh(|x|)  = (1 - e) / (1 + e),           e = exp(-2|x|), a polynomial below 0.625
+//     softplus(x) = max(x, 0) + log1p(exp(-|x|))
+//
+// `erf` is a polynomial on [0, 1]; above it `erfc(u) = t * exp(-u^2 + P(t))` with
+// `t = 2 / (2 + u)`, where `-u^2` is kept in two parts so that the tail of `gelu` stays accurate
+// until it underflows. `gelu` is the exact form `x / 2 * (1 + erf(x / sqrt(2)))` and takes the
+// complement directly for negative lanes.
+//
+// `float16` and `bfloat16` lanes are evaluated in `float`.
+
+namespace ui {
+
+    namespace internal {
+        template <std::floating_point T>
+        struct ActivationConstants;
+
+        template <>
+        struct ActivationConstants<float> {
+            static constexpr float rsqrt2_hi = 0.707106769f;
+            static constexpr float rsqrt2_lo = 1.21016171e-08f;
+
+            // tanh(x) = x + x^3 * P(x^2) for |x| < 0.625.
+            static constexpr std::array<float, 6> tanh{
+                0.00229274482f, -0.00834394526f, 0.0217689183f, -0.0539592579f, 0.133333042f, -0.333333343f
+            };
+            // erf(x) = x + x * P(x^2) for |x| < 1.
+            static constexpr std::array<float, 7> erf{
+                7.87587487e-05f, -0.00080168643f, 0.00518908724f, -0.0268542115f, 0.112835944f, -0.37612626f, 0.128379166f
+            };
+            // erfc(u) = t * exp(-u^2 + P(t - centre)) for 1 <= u <= erfc_max; erfc underflows past it.
+            static constexpr float erfc_max = 10.375f;
+            static constexpr float erfc_centre = 0.4140625f;
+            static constexpr std::array<float, 9> erfc{
+                -0.25177896f, -0.15095149f, 0.264911413f, 0.180072546f, -0.260482132f, -0.301964432f,
+                0.277424186f, 1.30489981f, -0.785777867f
+            };
+        };
+
+        template <>
+        struct ActivationConstants<double> {
+            static constexpr double rsqrt2_hi = 0.70710678118654757;
+            static constexpr double rsqrt2_lo = -4.8336466567264567e-17;
+
+            static constexpr std::array<double, 12> tanh{
+                6.485163482793113e-06, -3.1201101425797402e-05, 9.2571161295567687e-05, -0.0002375906496055562,
+                0.00058966065777570434, -0.0014557754120478055, 0.0035921217511549622, -0.0088632351032408782,
+                0.021869488519008305, -0.053968253967896992, 0.13333333333333042, -0.33333333333333331
+            };
+            static constexpr std::array<double, 13> erf{
+                5.9571761477489113e-11, -1.1372848856791674e-09, 1.4659775274047436e-08, -1.6350312701054695e-07,
+                1.6461000484121368e-06, -1.4925595266831182e-05, 0.0001205533111164271, -0.000854832698083379,
+                0.0052239776248180145, -0.026866170645076792, 0.11283791670954879, -0.37612638903183748,
+                0.12837916709551259
+            };
+            static constexpr double erfc_max = 27.5;
+            static constexpr double erfc_centre = 0.3671875;
+            static constexpr std::array<double, 21> erfc{
+                0.38903063164890961, -1.1768063572034722, 0.1227406043765783, 1.2595216286569588,
+                -0.59311315275086318, -0.78247818790398882, 0.6928033847987769, 0.37643767822150914,
+                -0.59633648190174537, -0.1565849936971673, 0.46511001291496806, 0.068971650288030859,
+                -0.36411042822651196, -0.057098255084010785, 0.30692166689800443, 0.09987198638327216,
+                -0.29371319279221536, -0.24973097895872304, 0.3162902387237872, 1.277012048619028,
+                -0.84630564628372185
+            };
+        };
+
+        // (n + n_lo) / (d + d_lo) for 1 <= d <= 2 from one remainder step on n * (1 / d).
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto divide(
+            Vec<N, T> const& n,
+            Vec<N, T> const& n_lo,
+            Vec<N, T> const& d,
+            Vec<N, T> const& d_lo
+        ) noexcept -> Vec<N, T> {
+            auto const r = reciprocal(d);
+            auto const q = n * r;
+            auto const rem = ui::fused_mul_acc(n, q, d, op::sub_t{}) + ui::fused_mul_acc(n_lo, q, d_lo, op::sub_t{});
+            return ui::fused_mul_acc(q, rem, r, op::add_t{});
+        }
+
+        // erf(a) for 0 <= a < 1.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto erf_small(Vec<N, T> const& a) noexcept -> Vec<N, T> {
+            return ui::fused_mul_acc(a, a, horner(a * a, ActivationConstants<T>::erf), op::add_t{});
+        }
+
+        // erfc(u + u_lo) for 1 <= u <= erfc_max.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto erfc_large(Vec<N, T> const& u, Vec<N, T> const& u_lo) noexcept -> Vec<N, T> {
+            using consts = ActivationConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const two = vec_t::load(T(2));
+            auto const t = two * reciprocal(two + u);
+            auto const p = horner(t - vec_t::load(consts::erfc_centre), consts::erfc);
+
+            // -u^2 + p as hi + lo; the square is scaled by up to erfc_max^2 in the exponent.
+            auto sq_lo = vec_t{};
+            auto const sq = two_prod(u, u, sq_lo);
+            sq_lo = ui::fused_mul_acc(sq_lo, two * u, u_lo, op::add_t{});
+            auto lo = vec_t{};
+            auto const hi = two_sum(p, -sq, lo);
+            return t * exp_impl<Accuracy::Ulp1>(hi, lo - sq_lo);
+        }
+    } // namespace internal
+
+// MARK: Activation Functions
+    /**
+     * @brief Hyperbolic tangent.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto tanh(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(tanh(cast<float>(x)));
+        } else {
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const ax = abs(x);
+            auto const z = ax * ax;
+            auto const small = fused_mul_acc(ax, ax * z, ui::internal::horner(z, ui::internal::ActivationConstants<T>::tanh), op::add_t{});
+
+            auto const e = ui::exp(-(ax + ax));
+            auto n_lo = vec_t{};
+            auto d_lo = vec_t{};
+            auto const n = ui::internal::fast_two_sum(one, -e, n_lo);
+            auto const d = ui::internal::fast_two_sum(one, e, d_lo);
+            auto const large = ui::internal::divide(n, n_lo, d, d_lo);
+            return ui::internal::copy_sign(bitwise_select(ax < vec_t::load(T(0.625)), small, large), x);
+        }
+    }
+
+    /**
+     * @brief Logistic function 1 / (1 + e^-x).
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto sigmoid(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(sigmoid(cast<float>(x)));
+        } else {
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const e = ui::exp(-abs(x));
+            auto d_lo = vec_t{};
+            auto const d = ui::internal::fast_two_sum(one, e, d_lo);
+            auto const n = bitwise_select(x < vec_t::load(T(0)), e, one);
+            return ui::internal::divide(n, vec_t::load(T(0)), d, d_lo);
+        }
+    }
+
+    /**
+     * @brief Error function.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto erf(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(erf(cast<float>(x)));
+        } else {
+            using consts = ui::internal::ActivationConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const ax = abs(x);
+            auto const small = ui::internal::erf_small(ax);
+            auto const large = one - ui::internal::erfc_large(min(ax, vec_t::load(consts::erfc_max)), vec_t::load(T(0)));
+            auto const res = ui::internal::copy_sign(bitwise_select(ax < one, small, large), x);
+            return bitwise_select(x != x, x, res);
+        }
+    }
+
+    /**
+     * @brief Gaussian error linear unit x / 2 * (1 + erf(x / sqrt(2))).
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto gelu(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(gelu(cast<float>(x)));
+        } else {
+            using consts = ui::internal::ActivationConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const max_u = vec_t::load(consts::erfc_max);
+            auto const neg = x < vec_t::load(T(0));
+
+            // |x| / sqrt(2) as hi + lo.
+            auto const ax = abs(x);
+            auto u_lo = vec_t{};
+            auto const u = ui::internal::two_prod(ax, vec_t::load(consts::rsqrt2_hi), u_lo);
+            u_lo = fused_mul_acc(u_lo, ax, vec_t::load(consts::rsqrt2_lo), op::add_t{});
+            u_lo = bitwise_select(u < max_u, u_lo, vec_t::load(T(0)));
+
+            // Below one, erfc(u) = (1 - u) - u * P(u^2) where 1 - u is exact.
+            auto const small = u < one;
+            auto const p = ui::internal::horner(u * u, consts::erf);
+            auto const ec = ui::internal::erfc_large(min(u, max_u), u_lo);
+            auto const erf_u = bitwise_select(small, fused_mul_acc(u, u, p, op::add_t{}), one - ec);
+            auto const erfc_u = bitwise_select(small, fused_mul_acc(one - u, u, p, op::sub_t{}), ec);
+
+            // 1 + erf(x / sqrt(2)) is erfc(|x| / sqrt(2)) for negative x.
+            auto const phi = bitwise_select(neg, erfc_u, one + erf_u);
+            auto const res = x * vec_t::load(T(0.5)) * phi;
+            auto const ninf = x == vec_t::load(-std::numeric_limits<T>::infinity());
+            return bitwise_select(ninf, vec_t::load(T(-0.0)), bitwise_select(x != x, x, res));
+        }
+    }
+
+    /**
+     * @brief log(1 + e^x) without overflowing for large x.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto softplus(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(softplus(cast<float>(x)));
+        } else {
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const zero = vec_t::load(T(0));
+            // log1p(e) = log(u) + c / u with u = 1 + e and c the rounding error of u.
+            auto const e = ui::exp(-abs(x));
+            auto const u = one + e;
+            auto const c = e - (u - one);
+            auto const l = fused_mul_acc(ui::log(u), c, ui::internal::reciprocal(u), op::add_t{});
+            return bitwise_select(x != x, x, ui::max(x, zero) + l);
+        }
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_ACTIVATION_HPP
@@ -0,0 +1,619 @@
+#ifndef AMT_UI_ALGORITHM_HPP
+#define AMT_UI_ALGORITHM_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Span algorithms
+// ---------------
+// Loops over arbitrary-length arrays built from the fixed-width operations. Each algorithm runs
+// `Unroll` native registers per iteration, then single registers, and finishes with one masked
+// register for the remainder, so no scalar epilogue is ever executed. The callable receives
+// `Vec<N, T>` arguments and must return a `Vec<N, U>`; it may be a generic lambda.
+//
+//     ui::transform(std::span(x), std::span(y), [](auto v) { return v * 2.f; });
+//     auto s = ui::reduce(std::span(x));                         // sum
+//     auto m = ui::reduce(std::span(x), ui::op::max_t{});        // maximum
+//     auto d = ui::transform_reduce(std::span(x), std::span(y), 0.f); // dot product
+//     ui::convert(std::span(h), std::span(x));                   // float16 -> float
+//     auto p = ui::dot(std::span(wa), std::span(wb));            // bfloat16 inner product in float
+//     auto q = ui::dot(std::span(qa), std::span(qb));            // int8 x uint8 inner product in int32
+
+namespace ui {
+
+    namespace internal {
+        // Lanes of one native register; the same widths as the `native::` aliases.
+        template <typename T>
+        inline constexpr std::size_t native_lanes = std::max<std::size_t>(16 * native::NativeSizeFactor / sizeof(T), 1);
+
+        template <typename Op>
+        concept reduce_op = std::same_as<Op, op::add_t>
+            || std::same_as<Op, op::mul_t>
+            || std::same_as<Op, op::max_t>
+            || std::same_as<Op, op::min_t>
+            || std::same_as<Op, op::maxnm_t>
+            || std::same_as<Op, op::minnm_t>;
+
+        template <typename T, reduce_op Op>
+        UI_ALWAYS_INLINE constexpr auto reduce_identity([[maybe_unused]] Op op) noexcept -> T {
+            using limits = std::numeric_limits<T>;
+            if constexpr (std::same_as<Op, op::add_t>) {
+                return T{};
+            } else if constexpr (std::same_as<Op, op::mul_t>) {
+                return T(1);
+            } else if constexpr (std::same_as<Op, op::max_t>) {
+                if constexpr (limits::has_infinity) return T(-limits::infinity());
+                else return limits::lowest();
+            } else if constexpr (std::same_as<Op, op::min_t>) {
+                if constexpr (limits::has_infinity) return limits::infinity();
+                else return limits::max();
+            } else {
+                // `maxnm`/`minnm` ignore NaN, so an empty range stays NaN.
+                static_assert(std::is_floating_point_v<T>, "maxnm and minnm are only defined for floating-point types");
+                return limits::quiet_NaN();
+            }
+        }
+
+        template <std::size_t N, typename T, reduce_op Op>
+        UI_ALWAYS_INLINE auto reduce_combine(
+            Vec<N, T> const& lhs,
+            Vec<N, T> const& rhs,
+            [[maybe_unused]] Op op
+        ) noexcept -> Vec<N, T> {
+            if constexpr (std::same_as<Op, op::add_t>) return lhs + rhs;
+            else if constexpr (std::same_as<Op, op::mul_t>) return lhs * rhs;
+            else if constexpr (std::same_as<Op, op::max_t>) return ui::max(lhs, rhs);
+            else if constexpr (std::same_as<Op, op::min_t>) return ui::min(lhs, rhs);
+            else if constexpr (std::same_as<Op, op::maxnm_t>) return ui::maxnm(lhs, rhs);
+            else return ui::minnm(lhs, rhs);
+        }
+
+        template <std::size_t N, typename T, reduce_op Op>
+        UI_ALWAYS_INLINE auto reduce_fold(
+            Vec<N, T> const& v,
+            Op op
+        ) noexcept -> T {
+            if constexpr (N == 1) {
+                return v.val;
+            } else if constexpr (std::same_as<Op, op::mul_t>) {
+                return reduce_fold(v.lo * v.hi, op);
+            } else {
+                return ui::fold(v, op);
+            }
+        }
+
+        // Tree reduction keeps the dependency chain of the final merge at log2(K).
+        template <std::size_t K, std::size_t N, typename T, reduce_op Op>
+        UI_ALWAYS_INLINE auto reduce_accumulators(
+            std::array<Vec<N, T>, K>& acc,
+            Op op
+        ) noexcept -> Vec<N, T> {
+            for (auto stride = 1ul; stride < K; stride *= 2) {
+                for (auto i = 0ul; i + stride < K; i += 2 * stride) {
+                    acc[i] = reduce_combine(acc[i], acc[i + stride], op);
+                }
+            }
+            return acc[0];
+        }
+
+        // Lanes past `count` repeat the last element instead of zero so that the callable never
+        // sees a value it would not see otherwise (e.g. a zero divisor).
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto tail_load(
+            T const* UI_RESTRICT in,
+            std::size_t count
+        ) noexcept -> Vec<N, T> {
+            return ui::masked_load(in, emul::internal::tail_mask<N, T>(count), Vec<N, T>::load(in[count - 1]));
+        }
+
+        template <std::size_t N, typename Fn, typename... Ts>
+        using transform_result_t = typename std::invoke_result_t<Fn&, Vec<N, Ts> const&...>::element_t;
+
+        template <std::size_t N, std::size_t Unroll, typename U, typename Fn, typename... Ts>
+        UI_ALWAYS_INLINE auto transform_impl(
+            U* out,
+            std::size_t size,
+            Fn& fn,
+            Ts const*... in
+        ) noexcept -> void {
+            static_assert(std::same_as<transform_result_t<N, Fn, Ts...>, U>, "callable must return Vec<N, U> where U is the output element type");
+
+            auto const step = [&](std::size_t i) {
+                auto res = fn(Vec<N, Ts>::load(in + i, N)...);
+                res.store(out + i, N);
+            };
+
+            auto i = std::size_t{};
+            for (; i + Unroll * N <= size; i += Unroll * N) {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (step(i + Is * N), ...);
+                }(std::make_index_sequence<Unroll>{});
+            }
+            for (; i + N <= size; i += N) step(i);
+
+            if (i < size) {
+                auto const count = size - i;
+                ui::masked_store(out + i, fn(tail_load<N>(in + i, count)...), count);
+            }
+        }
+
+        template <std::size_t N, std::size_t Unroll, typename R, reduce_op Op, typename Fn, typename... Ts>
+        UI_ALWAYS_INLINE auto transform_reduce_impl(
+            std::size_t size,
+            R init,
+            Op op,
+            Fn& fn,
+            Ts const* UI_RESTRICT... in
+        ) noexcept -> R {
+            static_assert(std::same_as<transform_result_t<N, Fn, Ts...>, R>, "callable must return Vec<N, R> where R is the type of init");
+
+            auto const identity = Vec<N, R>::load(reduce_identity<R>(op));
+            auto acc = std::array<Vec<N, R>, Unroll>{};
+            acc.fill(identity);
+
+            auto const step = [&](std::size_t i) {
+                return fn(Vec<N, Ts>::load(in + i, N)...);
+            };
+
+            auto i = std::size_t{};
+            for (; i + Unroll * N <= size; i += Unroll * N) {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((acc[Is] = reduce_combine(acc[Is], step(i + Is * N), op)), ...);
+                }(std::make_index_sequence<Unroll>{});
+            }
+            for (; i + N <= size; i += N) {
+                acc[0] = reduce_combine(acc[0], step(i), op);
+            }
+
+            if (i < size) {
+                auto const count = size - i;
+                auto const res = fn(tail_load<N>(in + i, count)...);
+                auto const mask = emul::internal::tail_mask<N, R>(count);
+                acc[Unroll - 1] = reduce_combine(acc[Unroll - 1], ui::bitwise_select(mask, res, identity), op);
+            }
+
+            auto const total = reduce_fold(reduce_accumulators(acc, op), op);
+            return reduce_combine(Vec<1, R>{ .val = init }, Vec<1, R>{ .val = total }, op).val;
+        }
+
+        // Index tracking for `argmin`/`argmax`. Every accumulator keeps the best value per lane and
+        // the number of the vector it came from; the comparison is strict, so a lane keeps its
+        // first occurrence. Vector numbers are stored in lanes as wide as `T`, so the span is
+        // processed in chunks whose vector count fits that type.
+        template <bool IsMax, std::size_t N, std::size_t Unroll, typename T>
+        UI_ALWAYS_INLINE auto arg_extremum(
+            T const* UI_RESTRICT data,
+            std::size_t size
+        ) noexcept -> std::size_t {
+            using index_t = mask_inner_t<T>;
+            using value_vec = Vec<N, T>;
+            using index_vec = Vec<N, index_t>;
+            using limits = std::numeric_limits<T>;
+
+            static constexpr auto sentinel = std::numeric_limits<index_t>::max();
+            static constexpr auto chunk_vectors = std::min<std::size_t>(sentinel, std::numeric_limits<std::size_t>::max() / N);
+            // Never strictly better than any element, NaN included.
+            static constexpr auto fill = [] {
+                if constexpr (IsMax) return limits::has_infinity ? T(-limits::infinity()) : limits::lowest();
+                else return limits::has_infinity ? limits::infinity() : limits::max();
+            }();
+
+            auto const better = [](value_vec const& l, value_vec const& r) {
+                if constexpr (IsMax) return ui::cmp(l, r, op::greater_t{});
+                else return ui::cmp(l, r, op::less_t{});
+            };
+
+            auto best_value = fill;
+            auto best_index = std::size_t{};
+
+            for (auto start = std::size_t{}; start < size; start += chunk_vectors * N) {
+                auto const* in = data + start;
+                auto const len = std::min(size - start, chunk_vectors * N);
+
+                auto val = std::array<value_vec, Unroll>{};
+                auto idx = std::array<index_vec, Unroll>{};
+                auto num = std::array<index_vec, Unroll>{};
+                for (auto k = 0ul; k < Unroll; ++k) {
+                    val[k] = value_vec::load(fill);
+                    idx[k] = index_vec::load(sentinel);
+                    num[k] = index_vec::load(static_cast<index_t>(k));
+                }
+
+                auto const update = [&](std::size_t k, value_vec const& v, index_vec const& n) {
+                    auto const m = better(v, val[k]);
+                    val[k] = ui::bitwise_select(m, v, val[k]);
+                    idx[k] = ui::bitwise_select(m, n, idx[k]);
+                };
+
+                auto i = std::size_t{};
+                if constexpr (Unroll > 1) {
+                    auto const step = index_vec::load(static_cast<index_t>(Unroll));
+                    for (; i + Unroll * N <= len; i += Unroll * N) {
+                        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                            (update(Is, value_vec::load(in + i + Is * N, N), num[Is]), ...);
+                            ((num[Is] = num[Is] + step), ...);
+                        }(std::make_index_sequence<Unroll>{});
+                    }
+                }
+                for (; i + N <= len; i += N) {
+                    update(0, value_vec::load(in + i, N), index_vec::load(static_cast<index_t>(i / N)));
+                }
+                if (i < len) {
+                    auto const v = ui::masked_load(in + i, emul::internal::tail_mask<N, T>(len - i), value_vec::load(fill));
+                    update(0, v, index_vec::load(static_cast<index_t>(i / N)));
+                }
+
+                // Merge the accumulators; ties go to the earlier vector.
+                for (auto k = 1ul; k < Unroll; ++k) {
+                    auto const m = better(val[k], val[0])
+                        | (ui::cmp(val[k], val[0], op::equal_t{}) & ui::cmp(idx[k], idx[0], op::less_t{}));
+                    val[0] = ui::bitwise_select(m, val[k], val[0]);
+                    idx[0] = ui::bitwise_select(m, idx[k], idx[0]);
+                }
+
+                auto const value = [&] {
+                    if constexpr (IsMax) return ui::fold(val[0], op::max_t{});
+                    else return ui::fold(val[0], op::min_t{});
+                }();
+                auto const sentinel_vec = index_vec::load(sentinel);
+                auto const candidates = ui::cmp(val[0], value_vec::load(value), op::equal_t{})
+                    & ~ui::cmp(idx[0], sentinel_vec, op::equal_t{});
+                auto const vec_num = ui::fold(ui::bitwise_select(candidates, idx[0], sentinel_vec), op::min_t{});
+                // Only unmatched lanes remain when the chunk holds nothing better than `fill`.
+                if (vec_num == sentinel) continue;
+
+                auto const first = ui::cmp(idx[0], index_vec::load(vec_num), op::equal_t{}) & candidates;
+                auto const lane = first_match<N, T>(first);
+                if (IsMax ? value > best_value : value < best_value) {
+                    best_value = value;
+                    best_index = start + static_cast<std::size_t>(vec_num) * N + lane;
+                }
+            }
+            return best_index;
+        }
+    } // namespace internal
+
+// MARK: Transform
+    /**
+     * @brief Applies `fn` over `N` elements at a time and writes the result to `out`.
+     * Processes `out.size()` elements; every input must be at least that long. `out` may be
+     * one of the inputs.
+     */
+    template <
+        std::size_t Unroll = 2,
+        typename U,
+        typename Fn,
+        typename... Ts,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<U>>
+    >
+        requires (Unroll > 0 && sizeof...(Ts) > 0 && !std::is_const_v<U>)
+    UI_ALWAYS_INLINE auto zip_transform(
+        std::span<U> out,
+        Fn&& fn,
+        std::span<Ts>... in
+    ) noexcept -> void {
+        assert(((in.size() >= out.size()) && ...));
+        ui::internal::transform_impl<N, Unroll>(out.data(), out.size(), fn, static_cast<std::remove_cv_t<Ts> const*>(in.data())...);
+    }
+
+    /**
+     * @brief Unary transform; `out[i] = fn(in[i])`.
+     */
+    template <std::size_t Unroll = 2, typename T, typename U, typename Fn>
+        requires (!std::is_const_v<U>)
+    UI_ALWAYS_INLINE auto transform(
+        std::span<T> in,
+        std::span<U> out,
+        Fn&& fn
+    ) noexcept -> void {
+        zip_transform<Unroll>(out, fn, in);
+    }
+
+    /**
+     * @brief Binary transform; `out[i] = fn(a[i], b[i])`.
+     */
+    template <std::size_t Unroll = 2, typename T0, typename T1, typename U, typename Fn>
+        requires (!std::is_const_v<U>)
+    UI_ALWAYS_INLINE auto transform(
+        std::span<T0> a,
+        std::span<T1> b,
+        std::span<U> out,
+        Fn&& fn
+    ) noexcept -> void {
+        zip_transform<Unroll>(out, fn, a, b);
+    }
+// !MARK
+
+// MARK: Convert
+    /**
+     * @brief Element-wise `cast<U>`; `out[i] = U(in[i])` for `out.size()` elements. Each step
+     * fills one register of the narrower type, so e.g. `float` -> `float16` packs two `float`
+     * registers into one.
+     */
+    template <std::size_t Unroll = 2, typename T, typename U>
+        requires (!std::is_const_v<U>)
+    UI_ALWAYS_INLINE auto convert(
+        std::span<T> in,
+        std::span<U> out
+    ) noexcept -> void {
+        using from_t = std::remove_cv_t<T>;
+        static constexpr auto N = std::max(ui::internal::native_lanes<from_t>, ui::internal::native_lanes<U>);
+        assert(in.size() >= out.size());
+        auto fn = [](auto const& v) { return ui::cast<U>(v); };
+        ui::internal::transform_impl<N, Unroll>(out.data(), out.size(), fn, static_cast<from_t const*>(in.data()));
+    }
+// !MARK
+
+// MARK: Reduce
+    /**
+     * @brief Reduces `in` with `op`, starting from `init`. `Unroll` independent accumulators
+     * hide the latency of the combining instruction.
+     * @note Floating-point results follow the vector order, not the sequential one.
+     */
+    template <
+        std::size_t Unroll = 4,
+        typename T,
+        ui::internal::reduce_op Op,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (Unroll > 0)
+    UI_ALWAYS_INLINE auto reduce(
+        std::span<T> in,
+        std::remove_cv_t<T> init,
+        Op op
+    ) noexcept -> std::remove_cv_t<T> {
+        using type = std::remove_cv_t<T>;
+        auto fn = [](Vec<N, type> const& v) { return v; };
+        return ui::internal::transform_reduce_impl<N, Unroll>(in.size(), init, op, fn, static_cast<type const*>(in.data()));
+    }
+
+    /**
+     * @brief Reduces `in` with `op`, starting from the identity of `op`.
+     */
+    template <std::size_t Unroll = 4, typename T, ui::internal::reduce_op Op = op::add_t>
+    UI_ALWAYS_INLINE auto reduce(
+        std::span<T> in,
+        Op op = {}
+    ) noexcept -> std::remove_cv_t<T> {
+        return reduce<Unroll>(in, ui::internal::reduce_identity<std::remove_cv_t<T>>(op), op);
+    }
+// !MARK
+
+// MARK: Argmin and Argmax
+    /**
+     * @brief Index of the smallest element; the first one on ties. NaN elements are ignored;
+     * returns 0 for an empty span or when no element compares.
+     */
+    template <
+        std::size_t Unroll = 2,
+        typename T,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (Unroll > 0)
+    UI_ALWAYS_INLINE auto argmin(
+        std::span<T> in
+    ) noexcept -> std::size_t {
+        return ui::internal::arg_extremum<false, N, Unroll>(static_cast<std::remove_cv_t<T> const*>(in.data()), in.size());
+    }
+
+    /**
+     * @brief Index of the largest element; the first one on ties. NaN elements are ignored;
+     * returns 0 for an empty span or when no element compares.
+     */
+    template <
+        std::size_t Unroll = 2,
+        typename T,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (Unroll > 0)
+    UI_ALWAYS_INLINE auto argmax(
+        std::span<T> in
+    ) noexcept -> std::size_t {
+        return ui::internal::arg_extremum<true, N, Unroll>(static_cast<std::remove_cv_t<T> const*>(in.data()), in.size());
+    }
+// !MARK
+
+// MARK: Transform Reduce
+    /**
+     * @brief Reduces `fn(in[i])` with `op`, starting from `init`.
+     */
+    template <
+        std::size_t Unroll = 4,
+        typename T,
+        typename R,
+        ui::internal::reduce_op Op,
+        typename Fn,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (Unroll > 0)
+    UI_ALWAYS_INLINE auto transform_reduce(
+        std::span<T> in,
+        R init,
+        Op op,
+        Fn&& fn
+    ) noexcept -> R {
+        return ui::internal::transform_reduce_impl<N, Unroll>(
+            in.size(), init, op, fn,
+            static_cast<std::remove_cv_t<T> const*>(in.data())
+        );
+    }
+
+    /**
+     * @brief Reduces `fn(a[i], b[i])` with `op`, starting from `init`; `b` must be at least as long as `a`.
+     */
+    template <
+        std::size_t Unroll = 4,
+        typename T0,
+        typename T1,
+        typename R,
+        ui::internal::reduce_op Op,
+        typename Fn,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<std::conditional_t<(sizeof(T0) > sizeof(T1)), T0, T1>>>
+    >
+        requires (Unroll > 0)
+    UI_ALWAYS_INLINE auto transform_reduce(
+        std::span<T0> a,
+        std::span<T1> b,
+        R init,
+        Op op,
+        Fn&& fn
+    ) noexcept -> R {
+        assert(b.size() >= a.size());
+        return ui::internal::transform_reduce_impl<N, Unroll>(
+            a.size(), init, op, fn,
+            static_cast<std::remove_cv_t<T0> const*>(a.data()),
+            static_cast<std::remove_cv_t<T1> const*>(b.data())
+        );
+    }
+
+    /**
+     * @brief Inner product; `init + sum(a[i] * b[i])`. Floating-point types use fused multiply-add.
+     */
+    template <
+        std::size_t Unroll = 4,
+        typename T0,
+        typename T1,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T0>>
+    >
+        requires (Unroll > 0 && std::same_as<std::remove_cv_t<T0>, std::remove_cv_t<T1>>)
+    UI_ALWAYS_INLINE auto transform_reduce(
+        std::span<T0> a,
+        std::span<T1> b,
+        std::remove_cv_t<T0> init
+    ) noexcept -> std::remove_cv_t<T0> {
+        using type = std::remove_cv_t<T0>;
+        assert(b.size() >= a.size());
+
+        auto const size = a.size();
+        auto const* pa = static_cast<type const*>(a.data());
+        auto const* pb = static_cast<type const*>(b.data());
+
+        auto const fma = [](Vec<N, type> const& acc, Vec<N, type> const& l, Vec<N, type> const& r) {
+            if constexpr (std::is_floating_point_v<type>) return fused_mul_acc(acc, l, r, op::add_t{});
+            else return mul_acc(acc, l, r, op::add_t{});
+        };
+
+        auto acc = std::array<Vec<N, type>, Unroll>{};
+        acc.fill(Vec<N, type>::load(type{}));
+
+        auto i = std::size_t{};
+        for (; i + Unroll * N <= size; i += Unroll * N) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((acc[Is] = fma(acc[Is], Vec<N, type>::load(pa + i + Is * N, N), Vec<N, type>::load(pb + i + Is * N, N))), ...);
+            }(std::make_index_sequence<Unroll>{});
+        }
+        for (; i + N <= size; i += N) {
+            acc[0] = fma(acc[0], Vec<N, type>::load(pa + i, N), Vec<N, type>::load(pb + i, N));
+        }
+        if (i < size) {
+            // Zero-filled lanes contribute nothing to the sum.
+            auto const count = size - i;
+            acc[Unroll - 1] = fma(acc[Unroll - 1], masked_load<N>(pa + i, count), masked_load<N>(pb + i, count));
+        }
+
+        auto const total = fold(ui::internal::reduce_accumulators(acc, op::add_t{}), op::add_t{});
+        return static_cast<type>(init + total);
+    }
+// !MARK
+
+// MARK: Dot Product
+    namespace internal {
+        // `dot_acc` over two spans of `M`-lane operand registers with `N`-lane accumulators.
+        template <std::size_t N, std::size_t M, std::size_t Unroll, typename A, typename L, typename R>
+        UI_ALWAYS_INLINE auto dot_impl(
+            L const* UI_RESTRICT pa,
+            R const* UI_RESTRICT pb,
+            std::size_t size
+        ) noexcept -> A {
+            auto acc = std::array<Vec<N, A>, Unroll>{};
+            acc.fill(Vec<N, A>::load(A{}));
+
+            auto i = std::size_t{};
+            for (; i + Unroll * M <= size; i += Unroll * M) {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((acc[Is] = ui::dot_acc(acc[Is], Vec<M, L>::load(pa + i + Is * M, M), Vec<M, R>::load(pb + i + Is * M, M))), ...);
+                }(std::make_index_sequence<Unroll>{});
+            }
+            for (; i + M <= size; i += M) {
+                acc[0] = ui::dot_acc(acc[0], Vec<M, L>::load(pa + i, M), Vec<M, R>::load(pb + i, M));
+            }
+            if (i < size) {
+                // Zero-filled lanes contribute nothing to the sum.
+                auto const count = size - i;
+                acc[Unroll - 1] = ui::dot_acc(acc[Unroll - 1], ui::masked_load<M>(pa + i, count), ui::masked_load<M>(pb + i, count));
+            }
+
+            return ui::fold(reduce_accumulators(acc, op::add_t{}), op::add_t{});
+        }
+    } // namespace internal
+
+    /**
+     * @brief Inner product of two `bfloat16` spans accumulated in `float`; `init + sum(a[i] * b[i])`.
+     * Every step multiplies one register of each span with `dot_acc`, so the operands are never
+     * widened through `cast`. `b` must be at least as long as `a`.
+     */
+    template <std::size_t Unroll = 4, typename T0, typename T1>
+        requires (
+            Unroll > 0 &&
+            std::same_as<std::remove_cv_t<T0>, bfloat16> &&
+            std::same_as<std::remove_cv_t<T1>, bfloat16>
+        )
+    UI_ALWAYS_INLINE auto dot(
+        std::span<T0> a,
+        std::span<T1> b,
+        float init = 0.f
+    ) noexcept -> float {
+        static constexpr auto N = ui::internal::native_lanes<float>;
+        assert(b.size() >= a.size());
+        return init + ui::internal::dot_impl<N, 2 * N, Unroll, float>(
+            static_cast<bfloat16 const*>(a.data()),
+            static_cast<bfloat16 const*>(b.data()),
+            a.size()
+        );
+    }
+
+    /**
+     * @brief Inner product of two 8-bit integer spans accumulated in 32-bit lanes;
+     * `init + sum(a[i] * b[i])`. The sum is `int32_t` unless both spans are `uint8_t`, and it
+     * wraps on overflow. `b` must be at least as long as `a`.
+     */
+    template <
+        std::size_t Unroll = 4,
+        typename T0,
+        typename T1,
+        typename A = std::conditional_t<
+            std::is_signed_v<std::remove_cv_t<T0>> || std::is_signed_v<std::remove_cv_t<T1>>,
+            std::int32_t,
+            std::uint32_t
+        >
+    >
+        requires (Unroll > 0 && ui::internal::int8_dot<A, std::remove_cv_t<T0>, std::remove_cv_t<T1>>)
+    UI_ALWAYS_INLINE auto dot(
+        std::span<T0> a,
+        std::span<T1> b,
+        A init = 0
+    ) noexcept -> A {
+        static constexpr auto N = ui::internal::native_lanes<A>;
+        assert(b.size() >= a.size());
+        auto const sum = ui::internal::dot_impl<N, 4 * N, Unroll, A>(
+            static_cast<std::remove_cv_t<T0> const*>(a.data()),
+            static_cast<std::remove_cv_t<T1> const*>(b.data()),
+            a.size()
+        );
+        return static_cast<A>(static_cast<std::uint32_t>(init) + static_cast<std::uint32_t>(sum));
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_ALGORITHM_HPP
@@ -33,6 +33,9 @@ namespace ui {
     #include "arm/sqrt.hpp"
     #include "arm/permute.hpp"
     #include "arm/prefetch.hpp"
+    #include "arm/gather.hpp"
+    #include "arm/masked.hpp"
+    #include "arm/compress.hpp"
 
     namespace ui {
         using namespace arm::neon;
@@ -59,6 +62,9 @@ namespace ui {
     #include "x86/manip.hpp"
     #include "x86/permute.hpp"
     #include "x86/prefetch.hpp"
+    #include "x86/gather.hpp"
+    #include "x86/masked.hpp"
+    #include "x86/compress.hpp"
 
     namespace ui {
         using namespace x86;
@@ -85,6 +91,9 @@ namespace ui {
     #include "wasm/int_mask.hpp"
     #include "wasm/permute.hpp"
     #include "wasm/prefetch.hpp"
+    #include "wasm/gather.hpp"
+    #include "wasm/masked.hpp"
+    #include "wasm/compress.hpp"
     namespace ui {
         using namespace wasm;
         static constexpr auto ARCH_TYPE = Arch::Wasm;
@@ -111,6 +120,9 @@ namespace ui {
     #include "emul/int_mask.hpp"
     #include "emul/permute.hpp"
     #include "emul/prefetch.hpp"
+    #include "emul/gather.hpp"
+    #include "emul/masked.hpp"
+    #include "emul/compress.hpp"
 
     namespace ui {
         using namespace emul;
@@ -40,6 +40,11 @@ namespace ui::arm::neon {
                 else if constexpr (N == 4) return std::bit_cast<bfloat16x4_t>(v);
                 else return std::bit_cast<bfloat16x8_t>(v);
             #endif
+            } else if constexpr (::ui::internal::is_fp8<T>) {
+                // Only moved as bits; arithmetic goes through `cast`.
+                if constexpr (N == 1) return std::bit_cast<std::uint8_t>(v);
+                else if constexpr (N == 8) return std::bit_cast<uint8x8_t>(v);
+                else return std::bit_cast<uint8x16_t>(v);
             } else {
                 static_assert(
                     sizeof(T) == sizeof(float)   ||
@@ -1255,7 +1260,11 @@ namespace ui::arm::neon {
 
     template <typename To, std::size_t N, typename From>
     UI_ALWAYS_INLINE auto cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
-        return internal::CastImpl<To, false>{}(v);
+        if constexpr (::ui::internal::is_fp8<To> || ::ui::internal::is_fp8<From>) {
+            return ::ui::internal::cast_float8<To, false>(v);
+        } else {
+            return internal::CastImpl<To, false>{}(v);
+        }
     }
 
     template <typename To, std::size_t N, std::integral From>
@@ -1263,6 +1272,12 @@ namespace ui::arm::neon {
         return internal::CastImpl<To, true>{}(v);
     }
 
+    template <typename To, std::size_t N, std::floating_point From>
+        requires ::ui::internal::is_fp8<To>
+    UI_ALWAYS_INLINE auto sat_cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
+        return ::ui::internal::cast_float8<To, true>(v);
+    }
+
     template <typename T>
     UI_ALWAYS_INLINE constexpr auto from_vec(auto const& v) noexcept {
         return rcast<T>(from_vec(v));
@@ -0,0 +1,191 @@
+#ifndef AMT_UI_ARCH_ARM_COMPRESS_HPP
+#define AMT_UI_ARCH_ARM_COMPRESS_HPP
+
+#include "cast.hpp"
+#include "bit.hpp"
+#include "masked.hpp"
+#include "../emul/compress.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ui::arm::neon {
+
+    namespace internal {
+        using namespace ::ui::internal;
+        using emul::internal::compress_lut;
+        using emul::internal::expand_lut;
+        using emul::internal::compress_merge_lut;
+
+        template <std::size_t N, typename T>
+        static constexpr bool has_native_compress = [] {
+            #ifdef UI_CPU_ARM64
+            return N * sizeof(T) == 16;
+            #else
+            return false;
+            #endif
+        }();
+
+        #ifdef UI_CPU_ARM64
+        // There is no `movemask`; each lane is weighted by its bit and the weights are summed.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto lane_bits(mask_t<N, T> const& m) noexcept -> unsigned {
+            if constexpr (sizeof(T) == 1) {
+                alignas(16) static constexpr std::uint8_t weights[] = {
+                    1, 2, 4, 8, 16, 32, 64, 128,
+                    1, 2, 4, 8, 16, 32, 64, 128
+                };
+                auto w = vandq_u8(std::bit_cast<uint8x16_t>(m), vld1q_u8(weights));
+                return static_cast<unsigned>(vaddv_u8(vget_low_u8(w)))
+                    | (static_cast<unsigned>(vaddv_u8(vget_high_u8(w))) << 8);
+            } else if constexpr (sizeof(T) == 2) {
+                alignas(16) static constexpr std::uint16_t weights[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+                return vaddvq_u16(vandq_u16(std::bit_cast<uint16x8_t>(m), vld1q_u16(weights)));
+            } else if constexpr (sizeof(T) == 4) {
+                alignas(16) static constexpr std::uint32_t weights[] = { 1, 2, 4, 8 };
+                return vaddvq_u32(vandq_u32(std::bit_cast<uint32x4_t>(m), vld1q_u32(weights)));
+            } else {
+                alignas(16) static constexpr std::uint64_t weights[] = { 1, 2 };
+                return static_cast<unsigned>(vaddvq_u64(vandq_u64(std::bit_cast<uint64x2_t>(m), vld1q_u64(weights))));
+            }
+        }
+
+        template <typename T>
+        UI_ALWAYS_INLINE auto compress_bytes(uint8x16_t v, unsigned bits) noexcept -> uint8x16_t {
+            if constexpr (sizeof(T) == 1) {
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto idx = vcombine_u8(
+                    vld1_u8(compress_lut<8, 1>[lo].data()),
+                    vadd_u8(vld1_u8(compress_lut<8, 1>[hi].data()), vdup_n_u8(8))
+                );
+                auto t = vqtbl1q_u8(v, idx);
+                return vqtbl1q_u8(t, vld1q_u8(compress_merge_lut[std::popcount(lo)].data()));
+            } else {
+                return vqtbl1q_u8(v, vld1q_u8(compress_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+
+        // Inactive lanes are garbage; callers blend them with the source.
+        template <typename T>
+        UI_ALWAYS_INLINE auto expand_bytes(uint8x16_t v, unsigned bits) noexcept -> uint8x16_t {
+            if constexpr (sizeof(T) == 1) {
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto offset = static_cast<std::uint8_t>(std::popcount(lo));
+                auto idx = vcombine_u8(
+                    vld1_u8(expand_lut<8, 1>[lo].data()),
+                    vadd_u8(vld1_u8(expand_lut<8, 1>[hi].data()), vdup_n_u8(offset))
+                );
+                return vqtbl1q_u8(v, idx);
+            } else {
+                return vqtbl1q_u8(v, vld1q_u8(expand_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+        #endif
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto active_count(mask_t<N, T> const& mask) noexcept -> std::size_t {
+            if constexpr (has_native_compress<N, T>) {
+                #ifdef UI_CPU_ARM64
+                return static_cast<std::size_t>(std::popcount(lane_bits<N, T>(mask)));
+                #endif
+            } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+                return active_count<N / 2, T>(mask.lo) + active_count<N / 2, T>(mask.hi);
+            } else {
+                return emul::internal::active_count<N, T>(mask);
+            }
+        }
+    } // namespace internal
+
+// MARK: Compress
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            #ifdef UI_CPU_ARM64
+            auto res = compress_bytes<T>(std::bit_cast<uint8x16_t>(v), lane_bits<N, T>(mask));
+            return std::bit_cast<Vec<N, T>>(res);
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto res = Vec<N, T>{};
+            auto lo = compress(v.lo, mask.lo);
+            auto hi = compress(v.hi, mask.hi);
+            auto n = active_count<N / 2, T>(mask.lo);
+            std::memcpy(res.data(), lo.data(), sizeof(lo));
+            std::memcpy(res.data() + n, hi.data(), sizeof(hi));
+            return res;
+        } else {
+            return emul::compress(v, mask);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> std::size_t {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            auto n = active_count<N, T>(mask);
+            masked_store(out, compress(v, mask), n);
+            return n;
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto n = compress_store(out, v.lo, mask.lo);
+            return n + compress_store(out + n, v.hi, mask.hi);
+        } else {
+            return emul::compress_store(out, v, mask);
+        }
+    }
+// !MARK
+
+// MARK: Expand
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            #ifdef UI_CPU_ARM64
+            auto res = expand_bytes<T>(std::bit_cast<uint8x16_t>(v), lane_bits<N, T>(mask));
+            return bitwise_select(mask, std::bit_cast<Vec<N, T>>(res), src);
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            static constexpr auto half = N / 2;
+            auto n = active_count<half, T>(mask.lo);
+            auto rest = Vec<half, T>::load(v.data() + n, half);
+            return join(expand(v.lo, mask.lo, src.lo), expand(rest, mask.hi, src.hi));
+        } else {
+            return emul::expand(v, mask, src);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            return expand(masked_load<N>(in, active_count<N, T>(mask)), mask, src);
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto lo = expand_load(in, mask.lo, src.lo);
+            auto hi = expand_load(in + active_count<N / 2, T>(mask.lo), mask.hi, src.hi);
+            return join(lo, hi);
+        } else {
+            return emul::expand_load(in, mask, src);
+        }
+    }
+// !MARK
+
+} // namespace ui::arm::neon
+
+#endif // AMT_UI_ARCH_ARM_COMPRESS_HPP
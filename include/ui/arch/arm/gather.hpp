@@ -0,0 +1,12 @@
+#ifndef AMT_UI_ARCH_ARM_GATHER_HPP
+#define AMT_UI_ARCH_ARM_GATHER_HPP
+
+#include "../emul/gather.hpp"
+
+namespace ui::arm::neon {
+    // There are no indexed loads or stores; the lane-wise emulation lowers to per-lane loads/stores.
+    using emul::gather;
+    using emul::scatter;
+} // namespace ui::arm::neon
+
+#endif // AMT_UI_ARCH_ARM_GATHER_HPP
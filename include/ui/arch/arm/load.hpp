@@ -2,6 +2,8 @@
 #define AMT_UI_ARCH_ARM_LOAD_HPP
 
 #include "cast.hpp"
+#include "../emul/load.hpp"
+#include <bit>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -45,6 +47,8 @@ namespace ui::arm::neon {
                 #else
                 return std::bit_cast<Vec<N, T>>(load<N>(std::bit_cast<std::uint16_t>(val.data)));
                 #endif
+            } else if constexpr (::ui::internal::is_fp8<T>) {
+                return std::bit_cast<Vec<N, T>>(load<N>(val.data));
             } else if constexpr (std::is_signed_v<T>) {
                 if constexpr (sizeof(T) == 1) {
                     if constexpr (N == 8) {
@@ -995,6 +999,124 @@ namespace ui::arm::neon {
         }
     }
 
+
+    namespace internal {
+        // `vst2/3/4` only move bits, so every lane type is stored through the unsigned
+        // integer of the same width.
+        template <std::size_t K, std::size_t N, typename T, typename... Vs>
+        UI_ALWAYS_INLINE auto interleaved_store(T* UI_RESTRICT data, Vs const&... vs) noexcept -> void {
+            static constexpr bool is_q = N * sizeof(T) == 16;
+            if constexpr (sizeof(T) == 1) {
+                auto* p = reinterpret_cast<std::uint8_t*>(data);
+                if constexpr (is_q) {
+                    if constexpr (K == 2) vst2q_u8(p, uint8x16x2_t{{ std::bit_cast<uint8x16_t>(vs)... }});
+                    else if constexpr (K == 3) vst3q_u8(p, uint8x16x3_t{{ std::bit_cast<uint8x16_t>(vs)... }});
+                    else vst4q_u8(p, uint8x16x4_t{{ std::bit_cast<uint8x16_t>(vs)... }});
+                } else {
+                    if constexpr (K == 2) vst2_u8(p, uint8x8x2_t{{ std::bit_cast<uint8x8_t>(vs)... }});
+                    else if constexpr (K == 3) vst3_u8(p, uint8x8x3_t{{ std::bit_cast<uint8x8_t>(vs)... }});
+                    else vst4_u8(p, uint8x8x4_t{{ std::bit_cast<uint8x8_t>(vs)... }});
+                }
+            } else if constexpr (sizeof(T) == 2) {
+                auto* p = reinterpret_cast<std::uint16_t*>(data);
+                if constexpr (is_q) {
+                    if constexpr (K == 2) vst2q_u16(p, uint16x8x2_t{{ std::bit_cast<uint16x8_t>(vs)... }});
+                    else if constexpr (K == 3) vst3q_u16(p, uint16x8x3_t{{ std::bit_cast<uint16x8_t>(vs)... }});
+                    else vst4q_u16(p, uint16x8x4_t{{ std::bit_cast<uint16x8_t>(vs)... }});
+                } else {
+                    if constexpr (K == 2) vst2_u16(p, uint16x4x2_t{{ std::bit_cast<uint16x4_t>(vs)... }});
+                    else if constexpr (K == 3) vst3_u16(p, uint16x4x3_t{{ std::bit_cast<uint16x4_t>(vs)... }});
+                    else vst4_u16(p, uint16x4x4_t{{ std::bit_cast<uint16x4_t>(vs)... }});
+                }
+            } else if constexpr (sizeof(T) == 4) {
+                auto* p = reinterpret_cast<std::uint32_t*>(data);
+                if constexpr (is_q) {
+                    if constexpr (K == 2) vst2q_u32(p, uint32x4x2_t{{ std::bit_cast<uint32x4_t>(vs)... }});
+                    else if constexpr (K == 3) vst3q_u32(p, uint32x4x3_t{{ std::bit_cast<uint32x4_t>(vs)... }});
+                    else vst4q_u32(p, uint32x4x4_t{{ std::bit_cast<uint32x4_t>(vs)... }});
+                } else {
+                    if constexpr (K == 2) vst2_u32(p, uint32x2x2_t{{ std::bit_cast<uint32x2_t>(vs)... }});
+                    else if constexpr (K == 3) vst3_u32(p, uint32x2x3_t{{ std::bit_cast<uint32x2_t>(vs)... }});
+                    else vst4_u32(p, uint32x2x4_t{{ std::bit_cast<uint32x2_t>(vs)... }});
+                }
+            } else {
+                #ifdef UI_CPU_ARM64
+                auto* p = reinterpret_cast<std::uint64_t*>(data);
+                if constexpr (K == 2) vst2q_u64(p, uint64x2x2_t{{ std::bit_cast<uint64x2_t>(vs)... }});
+                else if constexpr (K == 3) vst3q_u64(p, uint64x2x3_t{{ std::bit_cast<uint64x2_t>(vs)... }});
+                else vst4q_u64(p, uint64x2x4_t{{ std::bit_cast<uint64x2_t>(vs)... }});
+                #else
+                emul::strided_store(data, vs...);
+                #endif
+            }
+        }
+    } // namespace internal
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<2, N>(data, a, b);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo);
+            strided_store(data + N / 2 * 2, a.hi, b.hi);
+        } else {
+            emul::strided_store(data, a, b);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<3, N>(data, a, b, c);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo, c.lo);
+            strided_store(data + N / 2 * 3, a.hi, b.hi, c.hi);
+        } else {
+            emul::strided_store(data, a, b, c);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c,
+        Vec<N, T> const& d
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+            data[3] = d.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<4, N>(data, a, b, c, d);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo, c.lo, d.lo);
+            strided_store(data + N / 2 * 4, a.hi, b.hi, c.hi, d.hi);
+        } else {
+            emul::strided_store(data, a, b, c, d);
+        }
+    }
 } // namespace ui::arm::neon;
 
 #endif // AMT_UI_ARCH_ARM_LOAD_HPP
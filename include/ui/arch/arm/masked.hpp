@@ -0,0 +1,69 @@
+#ifndef AMT_UI_ARCH_ARM_MASKED_HPP
+#define AMT_UI_ARCH_ARM_MASKED_HPP
+
+#include "cast.hpp"
+#include "bit.hpp"
+#include "../emul/masked.hpp"
+#include <cstddef>
+
+namespace ui::arm::neon {
+
+    namespace internal {
+        using namespace ::ui::internal;
+        using emul::internal::can_overread;
+        using emul::internal::tail_mask;
+    } // namespace internal
+
+// MARK: Masked Load
+    /**
+     * @brief There are no predicated loads; when the whole register cannot cross a page boundary
+     * it is loaded unconditionally and the inactive lanes are replaced afterwards.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (N * sizeof(T) == 8 || N * sizeof(T) == 16) {
+            if (can_overread<N * sizeof(T)>(in)) {
+                return bitwise_select(mask, Vec<N, T>::load(in, N), src);
+            }
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            return join(
+                masked_load(in, mask.lo, src.lo),
+                masked_load(in + N / 2, mask.hi, src.hi)
+            );
+        }
+        return emul::masked_load(in, mask, src);
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_load(
+        T const* UI_RESTRICT in,
+        std::size_t count
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if (count >= N) return Vec<N, T>::load(in, N);
+        if constexpr (N * sizeof(T) == 8 || N * sizeof(T) == 16) {
+            if (can_overread<N * sizeof(T)>(in)) {
+                return bitwise_select(tail_mask<N, T>(count), Vec<N, T>::load(in, N), Vec<N, T>{});
+            }
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            static constexpr auto half = N / 2;
+            if (count <= half) return join(masked_load<half>(in, count), Vec<half, T>{});
+            return join(Vec<half, T>::load(in, half), masked_load<half>(in + half, count - half));
+        }
+        return emul::masked_load<N>(in, count);
+    }
+// !MARK
+
+// MARK: Masked Store
+    // Stores cannot be widened safely since the inactive lanes may belong to another thread.
+    using emul::masked_store;
+// !MARK
+
+} // namespace ui::arm::neon
+
+#endif // AMT_UI_ARCH_ARM_MASKED_HPP
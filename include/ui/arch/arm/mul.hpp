@@ -2,10 +2,13 @@
 #define AMT_UI_ARCH_ARM_MUL_HPP
 
 #include "cast.hpp"
+#include "shift.hpp"
+#include "logical.hpp"
 #include "../emul/mul.hpp"
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 namespace ui::arm::neon {
 // MARK: Multiplication
@@ -2044,6 +2047,137 @@ namespace ui::arm::neon {
     }
 // !MARK
 
+// MARK: High-half Multiplication
+    using emul::mul_high;
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto mul_wide(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> std::pair<Vec<N, T> /*low*/, Vec<N, T> /*high*/> {
+        return { mul(lhs, rhs), mul_high(lhs, rhs) };
+    }
+// !MARK
+
+// MARK: Dot-Product Accumulate
+    /**
+     * @brief Adds the products of each pair of adjacent lanes to one accumulator lane;
+     * `acc[i] + lhs[2i] * rhs[2i] + lhs[2i + 1] * rhs[2i + 1]`. Uses `bfdot` with FEAT_BF16,
+     * which does not round the intermediate sum and flushes subnormals to zero.
+     */
+    template <std::size_t N, std::size_t M>
+        requires (M == 2 * N)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, float> const& acc,
+        Vec<M, bfloat16> const& lhs,
+        Vec<M, bfloat16> const& rhs
+    ) noexcept -> Vec<N, float> {
+        if constexpr (N == 1) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else {
+            #ifdef UI_ARM_HAS_BF16
+            if constexpr (N == 2) {
+                return std::bit_cast<Vec<N, float>>(vbfdot_f32(to_vec(acc), std::bit_cast<bfloat16x4_t>(lhs), std::bit_cast<bfloat16x4_t>(rhs)));
+            } else if constexpr (N == 4) {
+                return std::bit_cast<Vec<N, float>>(vbfdotq_f32(to_vec(acc), std::bit_cast<bfloat16x8_t>(lhs), std::bit_cast<bfloat16x8_t>(rhs)));
+            } else {
+                return join(dot_acc(acc.lo, lhs.lo, rhs.lo), dot_acc(acc.hi, lhs.hi, rhs.hi));
+            }
+            #else
+            // The even lanes are the low halves of the 32-bit lanes and the odd lanes the high
+            // halves, so both widen in place without a shuffle.
+            auto const mask = Vec<N, std::uint32_t>::load(0xffff'0000);
+            auto const l = std::bit_cast<Vec<N, std::uint32_t>>(lhs);
+            auto const r = std::bit_cast<Vec<N, std::uint32_t>>(rhs);
+            auto const even = [](auto const& v) { return std::bit_cast<Vec<N, float>>(shift_left<16>(v)); };
+            auto const odd = [&mask](auto const& v) { return std::bit_cast<Vec<N, float>>(bitwise_and(v, mask)); };
+            auto const res = fused_mul_acc(acc, even(l), even(r), op::add_t{});
+            return fused_mul_acc(res, odd(l), odd(r), op::add_t{});
+            #endif
+        }
+    }
+
+    namespace internal {
+        // Products of eight 8-bit lanes in 16 bits, where every one of them fits.
+        template <typename L, typename R>
+        UI_ALWAYS_INLINE auto dot_products(L l, R r) noexcept {
+            if constexpr (std::same_as<L, int8x8_t> && std::same_as<R, int8x8_t>) {
+                return vmull_s8(l, r);
+            } else if constexpr (std::same_as<L, uint8x8_t> && std::same_as<R, uint8x8_t>) {
+                return vmull_u8(l, r);
+            } else {
+                return vmulq_s16(vreinterpretq_s16_u16(vmovl_u8(l)), vmovl_s8(r));
+            }
+        }
+
+        // Sums of each group of four products; two pairwise widening additions.
+        UI_ALWAYS_INLINE auto dot_quads(int16x8_t p) noexcept -> int32x2_t {
+            auto const pairs = vpaddlq_s16(p);
+            return vpadd_s32(vget_low_s32(pairs), vget_high_s32(pairs));
+        }
+
+        UI_ALWAYS_INLINE auto dot_quads(uint16x8_t p) noexcept -> uint32x2_t {
+            auto const pairs = vpaddlq_u16(p);
+            return vpadd_u32(vget_low_u32(pairs), vget_high_u32(pairs));
+        }
+    } // namespace internal
+
+    /**
+     * @brief Adds the products of each group of four adjacent 8-bit lanes to one 32-bit
+     * accumulator lane; `acc[i] + lhs[4i] * rhs[4i] + ... + lhs[4i + 3] * rhs[4i + 3]`.
+     * Uses `sdot`/`udot` with FEAT_DotProd and `usdot` for mixed signs with FEAT_I8MM;
+     * otherwise the products are widened with `vmull` and added pairwise.
+     */
+    template <std::size_t N, std::size_t M, typename A, typename L, typename R>
+        requires (M == 4 * N && ::ui::internal::int8_dot<A, L, R>)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, A> const& acc,
+        Vec<M, L> const& lhs,
+        Vec<M, R> const& rhs
+    ) noexcept -> Vec<N, A> {
+        if constexpr (N == 1) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else if constexpr (std::is_signed_v<L> && !std::is_signed_v<R>) {
+            // `usdot` takes the unsigned operand first.
+            return dot_acc(acc, rhs, lhs);
+        } else if constexpr (N == 2 || N == 4) {
+            [[maybe_unused]] static constexpr auto mixed = std::is_signed_v<L> != std::is_signed_v<R>;
+            #ifdef UI_ARM_HAS_I8MM
+            if constexpr (mixed) {
+                if constexpr (N == 2) return std::bit_cast<Vec<N, A>>(vusdot_s32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                else return std::bit_cast<Vec<N, A>>(vusdotq_s32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+            }
+            #endif
+            #ifdef UI_ARM_HAS_DOTPROD
+            if constexpr (!mixed) {
+                if constexpr (std::is_signed_v<A>) {
+                    if constexpr (N == 2) return std::bit_cast<Vec<N, A>>(vdot_s32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                    else return std::bit_cast<Vec<N, A>>(vdotq_s32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                } else {
+                    if constexpr (N == 2) return std::bit_cast<Vec<N, A>>(vdot_u32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                    else return std::bit_cast<Vec<N, A>>(vdotq_u32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                }
+            }
+            #endif
+            if constexpr (N == 2) {
+                auto const quads = internal::dot_quads(internal::dot_products(to_vec(lhs), to_vec(rhs)));
+                if constexpr (std::is_signed_v<A>) return std::bit_cast<Vec<N, A>>(vadd_s32(to_vec(acc), quads));
+                else return std::bit_cast<Vec<N, A>>(vadd_u32(to_vec(acc), quads));
+            } else {
+                auto const lo = internal::dot_quads(internal::dot_products(to_vec(lhs.lo), to_vec(rhs.lo)));
+                auto const hi = internal::dot_quads(internal::dot_products(to_vec(lhs.hi), to_vec(rhs.hi)));
+                if constexpr (std::is_signed_v<A>) return std::bit_cast<Vec<N, A>>(vaddq_s32(to_vec(acc), vcombine_s32(lo, hi)));
+                else return std::bit_cast<Vec<N, A>>(vaddq_u32(to_vec(acc), vcombine_u32(lo, hi)));
+            }
+        } else {
+            return join(
+                dot_acc(acc.lo, lhs.lo, rhs.lo),
+                dot_acc(acc.hi, lhs.hi, rhs.hi)
+            );
+        }
+    }
+// !MARK
+
 } // namespace ui::arm::neon
 
 #endif // AMT_UI_ARCH_ARM_MUL_HPP
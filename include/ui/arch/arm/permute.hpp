@@ -1,10 +1,54 @@
 #ifndef AMT_UI_ARCH_ARM_PERMUTE_HPP
 #define AMT_UI_ARCH_ARM_PERMUTE_HPP
 
+#include "cast.hpp"
 #include "../emul/permute.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 
 namespace ui::arm::neon {
     using emul::shuffle;
+
+    template <std::size_t M, std::size_t N, typename T>
+        requires (sizeof(T) == 1)
+    UI_ALWAYS_INLINE auto lookup(
+        Vec<M, T> const& table,
+        Vec<N, std::uint8_t> const& indices
+    ) noexcept -> Vec<N, T> {
+        using ret_t = Vec<N, T>;
+        #ifdef UI_CPU_ARM64
+        // `tbl` takes up to four consecutive registers and zeroes out-of-range lanes by itself.
+        if constexpr ((M == 16 || M == 32 || M == 48 || M == 64) && (N == 8 || N == 16)) {
+            auto const* t = reinterpret_cast<std::uint8_t const*>(table.data());
+            auto const lookup_impl = [&](auto idx) {
+                static constexpr bool is_half = N == 8;
+                if constexpr (M == 16) {
+                    auto tb = vld1q_u8(t);
+                    if constexpr (is_half) return vqtbl1_u8(tb, idx);
+                    else return vqtbl1q_u8(tb, idx);
+                } else if constexpr (M == 32) {
+                    auto tb = vld1q_u8_x2(t);
+                    if constexpr (is_half) return vqtbl2_u8(tb, idx);
+                    else return vqtbl2q_u8(tb, idx);
+                } else if constexpr (M == 48) {
+                    auto tb = vld1q_u8_x3(t);
+                    if constexpr (is_half) return vqtbl3_u8(tb, idx);
+                    else return vqtbl3q_u8(tb, idx);
+                } else {
+                    auto tb = vld1q_u8_x4(t);
+                    if constexpr (is_half) return vqtbl4_u8(tb, idx);
+                    else return vqtbl4q_u8(tb, idx);
+                }
+            };
+            if constexpr (N == 8) return std::bit_cast<ret_t>(lookup_impl(std::bit_cast<uint8x8_t>(indices)));
+            else return std::bit_cast<ret_t>(lookup_impl(std::bit_cast<uint8x16_t>(indices)));
+        } else if constexpr ((M == 16 || M == 32 || M == 48 || M == 64) && N > 16) {
+            return join(lookup(table, indices.lo), lookup(table, indices.hi));
+        }
+        #endif
+        return emul::lookup(table, indices);
+    }
 } // namespace ui::arm::neon
 
-#endif // AMT_UI_ARCH_ARM_PERMUTE_HPP 
+#endif // AMT_UI_ARCH_ARM_PERMUTE_HPP
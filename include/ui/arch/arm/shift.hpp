@@ -1731,6 +1731,27 @@ namespace ui::arm::neon {
     }
 // !MARK
 
+// MARK: Shift by a runtime count
+    // `vshl` already takes a per-lane count, so the count is broadcast.
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_left(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        using utype = std::make_unsigned_t<T>;
+        return shift_left(v, Vec<N, utype>::load(static_cast<utype>(s)));
+    }
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_right(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        using utype = std::make_unsigned_t<T>;
+        return shift_right(v, Vec<N, utype>::load(static_cast<utype>(s)));
+    }
+// !MARK
+
 // MARK: Shift Lane
     template <unsigned Shift, std::size_t N, typename T>
         requires (Shift <= N)
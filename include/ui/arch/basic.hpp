@@ -291,6 +291,19 @@ namespace ui::internal {
     template <typename T>
     concept is_fp16 = std::same_as<T, float16> || std::same_as<T, bfloat16>;
 
+    template <typename T>
+    concept is_fp8 = std::same_as<T, float8_e4m3> || std::same_as<T, float8_e5m2>;
+
+    template <typename T>
+    concept is_byte_int = std::same_as<T, std::int8_t> || std::same_as<T, std::uint8_t>;
+
+    // Operands of the 8-bit `dot_acc`; the accumulator is unsigned only when both operands are.
+    template <typename A, typename L, typename R>
+    concept int8_dot = is_byte_int<L> && is_byte_int<R> && std::same_as<
+        A,
+        std::conditional_t<std::is_signed_v<L> || std::is_signed_v<R>, std::int32_t, std::uint32_t>
+    >;
+
 
     template <std::size_t N, typename Fn>
     struct Case {
@@ -2,8 +2,11 @@
 #define AMT_UI_ARCH_ARM_CAST_FLOAT_HPP
 
 #include "../float.hpp"
+#include "basic.hpp"
 #include <bit>
+#include <concepts>
 #include <cstdint>
+#include <limits>
 
 namespace ui {
 
@@ -16,7 +19,8 @@ namespace ui {
 
         auto bits = I(v);
         auto sign = bitwise_and(bits, load<N, std::uint32_t>(0x8000'0000));
-        auto abs = min(bitwise_xor(bits, sign), load<N, std::uint32_t>(0x4780'0000));
+        auto mag = bitwise_xor(bits, sign);
+        auto abs = min(mag, load<N, std::uint32_t>(0x4780'0000));
 
         auto magic = bitwise_and(
             I(
@@ -32,10 +36,18 @@ namespace ui {
         auto exp = sub(shift_right<13>(magic), shifts);
 
         auto f16 = add(rounded, exp);
+        // NaN saturates to infinity above; keep it a quiet NaN with the top of its payload.
+        auto nan = bitwise_and(
+            cmp(mag, load<N, std::uint32_t>(0x7F80'0000), op::greater_t{}),
+            bitwise_or(
+                bitwise_and(shift_right<13>(mag), load<N, std::uint32_t>(0x1FF)),
+                load<N, std::uint32_t>(0x200)
+            )
+        );
         return std::bit_cast<Vec<N, float16>>(
             cast<std::uint16_t>(bitwise_or(
-                shift_right<16>(sign),
-                f16
+                bitwise_or(shift_right<16>(sign), f16),
+                nan
             ))
         );
         #undef I
@@ -55,6 +67,10 @@ namespace ui {
             cmp(abs, load<N, std::uint32_t>(31 << 10), op::greater_equal_t{}),
             load<N, std::uint32_t>(0xFF << 23)
         );
+        auto quiet = bitwise_and(
+            cmp(abs, load<N, std::uint32_t>(31 << 10), op::greater_t{}),
+            load<N, std::uint32_t>(1 << 22)
+        );
         auto is_norm = cmp(abs, load<N, std::uint32_t>(0x3FF), op::greater_t{});
         auto sub = I(mul(cast<float>(abs), load<N, float>(1.f / (1 << 24))));
         auto norm = add(
@@ -68,7 +84,7 @@ namespace ui {
                     shift_left<16>(sign),
                     finite
                 ),
-                inf_or_nan
+                bitwise_or(inf_or_nan, quiet)
             )
         );
         #undef I
@@ -80,19 +96,18 @@ namespace ui {
         Vec<N, float> const& v
     ) noexcept -> Vec<N, bfloat16> {
         auto temp = std::bit_cast<Vec<N, std::uint32_t>>(v);
-        auto const m0 = load<N, std::uint32_t>(0x7FFFFF);
         auto shifted = shift_right<16>(temp);
-        auto b0 = load<N, std::uint32_t>(0x7FFF);
-        auto b1 = add(b0, bitwise_and(temp, load<N, std::uint32_t>(1)));
-        return std::bit_cast<Vec<N, bfloat16>>(cast<uint16_t>(bitwise_or(
-            shifted,
-            shift_right<16>(
-                bitwise_and(
-                    add(temp, b1),
-                    m0
-                )
-            )
-        )));
+        // Round to nearest, ties to even; the carry may run into the exponent.
+        auto bias = add(load<N, std::uint32_t>(0x7FFF), bitwise_and(shifted, load<N, std::uint32_t>(1)));
+        auto rounded = shift_right<16>(add(temp, bias));
+        // NaN stays a quiet NaN instead of rounding into infinity or the sign.
+        auto is_nan = cmp(
+            bitwise_and(temp, load<N, std::uint32_t>(0x7FFF'FFFF)),
+            load<N, std::uint32_t>(0x7F80'0000),
+            op::greater_t{}
+        );
+        auto nan = bitwise_or(shifted, load<N, std::uint32_t>(0x40));
+        return std::bit_cast<Vec<N, bfloat16>>(cast<std::uint16_t>(bitwise_select(is_nan, nan, rounded)));
     }
 
     template <std::size_t N>
@@ -106,6 +121,213 @@ namespace ui {
         );
     }
 
+    namespace internal {
+        /**
+         * @brief Fixed-point view of `|v|` with the 8-bit encoding of `To` on top and `23 - M`
+         * bits below it that rounding drops. Mirrors `float32_to_float8` in `float.hpp`.
+         */
+        template <typename To, std::size_t N>
+        static inline auto float8_fixed_point(
+            Vec<N, std::uint32_t> const& abs
+        ) noexcept -> Vec<N, std::uint32_t> {
+            using rep_t = fp::FloatingPointRep<To>;
+            constexpr auto min_normal = (127u + 1u - rep_t::bias) << 23;
+
+            auto is_sub = cmp(abs, load<N, std::uint32_t>(min_normal), op::less_t{});
+            // Clamped so that normal, infinite and NaN lanes stay in `int32_t` range.
+            auto scaled = mul(
+                std::bit_cast<Vec<N, float>>(::ui::min(abs, load<N, std::uint32_t>(min_normal))),
+                load<N, float>(std::bit_cast<float>((127u + rep_t::bias + 22u) << 23))
+            );
+            // Truncated explicitly; the float -> int conversion rounds to nearest on some targets.
+            auto truncated = ::ui::round<std::float_round_style::round_toward_zero>(scaled);
+            auto sticky = bitwise_and(
+                cmp(truncated, scaled, op::less_t{}),
+                load<N, std::uint32_t>(1)
+            );
+            auto sub_fixed = bitwise_or(std::bit_cast<Vec<N, std::uint32_t>>(cast<std::int32_t>(truncated)), sticky);
+            auto norm_fixed = sub(abs, load<N, std::uint32_t>((127u - rep_t::bias) << 23));
+            return bitwise_select(is_sub, sub_fixed, norm_fixed);
+        }
+
+        /**
+         * @brief Drops the fixed-point bits of `code`, applies overflow and NaN, and narrows.
+         */
+        template <typename To, bool Saturating, std::size_t N>
+        static inline auto float8_finish(
+            Vec<N, std::uint32_t> const& bits,
+            Vec<N, std::uint32_t> const& code
+        ) noexcept -> Vec<N, To> {
+            constexpr auto overflow = Saturating ? To::max_rep() : To::overflow_rep();
+            auto abs = bitwise_and(bits, load<N, std::uint32_t>(0x7FFF'FFFF));
+            auto sign = bitwise_and(shift_right<24>(bits), load<N, std::uint32_t>(0x80));
+            auto res = bitwise_select(
+                cmp(code, load<N, std::uint32_t>(To::max_rep()), op::greater_t{}),
+                load<N, std::uint32_t>(overflow),
+                code
+            );
+            res = bitwise_select(
+                cmp(abs, load<N, std::uint32_t>(0x7F80'0000), op::greater_t{}),
+                load<N, std::uint32_t>(To::nan_rep()),
+                res
+            );
+            return std::bit_cast<Vec<N, To>>(cast<std::uint8_t>(bitwise_or(res, sign)));
+        }
+    } // namespace internal
+
+    /**
+     * @brief float -> 8-bit float, rounding to nearest even. Overflow becomes NaN (E4M3) or
+     * infinity (E5M2), or the largest finite value with `Saturating`; NaN is always kept.
+     */
+    template <typename To, bool Saturating, std::size_t N>
+        requires ::ui::internal::is_fp8<To>
+    static inline auto cast_float32_to_float8(
+        Vec<N, float> const& v
+    ) noexcept -> Vec<N, To> {
+        constexpr auto shift = 23u - fp::FloatingPointRep<To>::mantissa_bits;
+        auto bits = std::bit_cast<Vec<N, std::uint32_t>>(v);
+        auto fixed = ::ui::internal::float8_fixed_point<To>(bitwise_and(bits, load<N, std::uint32_t>(0x7FFF'FFFF)));
+        auto bias = add(
+            load<N, std::uint32_t>((1u << (shift - 1)) - 1),
+            bitwise_and(shift_right<shift>(fixed), load<N, std::uint32_t>(1))
+        );
+        return ::ui::internal::float8_finish<To, Saturating>(bits, shift_right<shift>(add(fixed, bias)));
+    }
+
+    /**
+     * @brief float -> 8-bit float with stochastic rounding. The low `23 - M` bits of `random` are
+     * added below the kept mantissa, so a value rounds up with probability proportional to its
+     * distance from the lower neighbour. Saturates like `sat_cast`.
+     */
+    template <typename To, std::size_t N>
+        requires ::ui::internal::is_fp8<To>
+    static inline auto cast_float32_to_float8_stochastic(
+        Vec<N, float> const& v,
+        Vec<N, std::uint32_t> const& random
+    ) noexcept -> Vec<N, To> {
+        constexpr auto shift = 23u - fp::FloatingPointRep<To>::mantissa_bits;
+        auto bits = std::bit_cast<Vec<N, std::uint32_t>>(v);
+        auto fixed = ::ui::internal::float8_fixed_point<To>(bitwise_and(bits, load<N, std::uint32_t>(0x7FFF'FFFF)));
+        auto noise = bitwise_and(random, load<N, std::uint32_t>((1u << shift) - 1));
+        return ::ui::internal::float8_finish<To, true>(bits, shift_right<shift>(add(fixed, noise)));
+    }
+
+    /**
+     * @brief 8-bit float -> float; exact. Subnormals go through an integer conversion so the
+     * result does not depend on denormals-are-zero.
+     */
+    template <std::size_t N, typename From>
+        requires ::ui::internal::is_fp8<From>
+    static inline auto cast_float8_to_float32(
+        Vec<N, From> const& v
+    ) noexcept -> Vec<N, float> {
+        using rep_t = fp::FloatingPointRep<From>;
+        constexpr auto shift = 23u - rep_t::mantissa_bits;
+
+        auto wide = cast<std::uint32_t>(std::bit_cast<Vec<N, std::uint8_t>>(v));
+        auto sign = shift_left<24>(bitwise_and(wide, load<N, std::uint32_t>(0x80)));
+        auto mag = bitwise_and(wide, load<N, std::uint32_t>(0x7F));
+
+        auto is_norm = cmp(mag, load<N, std::uint32_t>((1u << rep_t::mantissa_bits) - 1), op::greater_t{});
+        auto norm = add(shift_left<shift>(mag), load<N, std::uint32_t>((127u - rep_t::bias) << 23));
+        auto sub = std::bit_cast<Vec<N, std::uint32_t>>(mul(
+            cast<float>(std::bit_cast<Vec<N, std::int32_t>>(mag)),
+            load<N, float>(std::bit_cast<float>((127u + 1u - rep_t::bias - rep_t::mantissa_bits) << 23))
+        ));
+        auto res = bitwise_select(is_norm, norm, sub);
+
+        auto special = load<N, std::uint32_t>(0x7FC0'0000);
+        if constexpr (From::has_infinity) {
+            special = bitwise_select(
+                cmp(mag, load<N, std::uint32_t>(From::overflow_rep()), op::equal_t{}),
+                load<N, std::uint32_t>(0x7F80'0000),
+                special
+            );
+        }
+        res = bitwise_select(cmp(mag, load<N, std::uint32_t>(From::max_rep()), op::greater_t{}), special, res);
+        return std::bit_cast<Vec<N, float>>(bitwise_or(res, sign));
+    }
+
+    /**
+     * @brief float16 -> E5M2. E5M2 is the top byte of float16, so this rounds the low byte away
+     * in 16-bit lanes without going through float.
+     */
+    template <bool Saturating, std::size_t N>
+    static inline auto cast_float16_to_float8_e5m2(
+        Vec<N, float16> const& v
+    ) noexcept -> Vec<N, float8_e5m2> {
+        constexpr auto overflow = Saturating ? float8_e5m2::max_rep() : float8_e5m2::overflow_rep();
+        auto bits = std::bit_cast<Vec<N, std::uint16_t>>(v);
+        auto abs = bitwise_and(bits, load<N, std::uint16_t>(0x7FFF));
+        auto bias = add(
+            load<N, std::uint16_t>(0x7F),
+            bitwise_and(shift_right<8>(abs), load<N, std::uint16_t>(1))
+        );
+        auto code = shift_right<8>(add(abs, bias));
+        code = bitwise_select(
+            cmp(code, load<N, std::uint16_t>(float8_e5m2::max_rep()), op::greater_t{}),
+            load<N, std::uint16_t>(overflow),
+            code
+        );
+        code = bitwise_select(
+            cmp(abs, load<N, std::uint16_t>(0x7C00), op::greater_t{}),
+            load<N, std::uint16_t>(float8_e5m2::nan_rep()),
+            code
+        );
+        auto sign = shift_right<8>(bitwise_and(bits, load<N, std::uint16_t>(0x8000)));
+        return std::bit_cast<Vec<N, float8_e5m2>>(cast<std::uint8_t>(bitwise_or(code, sign)));
+    }
+
+    /**
+     * @brief E5M2 -> float16; exact, a single shift.
+     */
+    template <std::size_t N>
+    static inline auto cast_float8_e5m2_to_float16(
+        Vec<N, float8_e5m2> const& v
+    ) noexcept -> Vec<N, float16> {
+        auto wide = cast<std::uint16_t>(std::bit_cast<Vec<N, std::uint8_t>>(v));
+        return std::bit_cast<Vec<N, float16>>(shift_left<8>(wide));
+    }
+
+    namespace internal {
+        template <typename To, bool Saturating, std::size_t N, typename From>
+        static inline auto cast_float8(Vec<N, From> const& v) noexcept -> Vec<N, To> {
+            if constexpr (std::same_as<To, From>) {
+                return v;
+            } else if constexpr (is_fp8<From>) {
+                if constexpr (std::same_as<From, float8_e5m2> && std::same_as<To, float16>) {
+                    return cast_float8_e5m2_to_float16(v);
+                } else if constexpr (is_fp8<To>) {
+                    return cast_float32_to_float8<To, Saturating>(cast_float8_to_float32(v));
+                } else if constexpr (std::same_as<To, float>) {
+                    return cast_float8_to_float32(v);
+                } else {
+                    return ::ui::cast<To>(cast_float8_to_float32(v));
+                }
+            } else if constexpr (std::same_as<From, float16> && std::same_as<To, float8_e5m2>) {
+                return cast_float16_to_float8_e5m2<Saturating>(v);
+            } else if constexpr (std::same_as<From, float>) {
+                return cast_float32_to_float8<To, Saturating>(v);
+            } else {
+                // float16 and bfloat16 widen exactly, so there is still a single rounding.
+                return cast_float32_to_float8<To, Saturating>(::ui::cast<float>(v));
+            }
+        }
+    } // namespace internal
+
+    /**
+     * @brief float -> 8-bit float with stochastic rounding driven by `random`, one word per lane.
+     * The rounding is unbiased in expectation; the result saturates like `sat_cast`.
+     */
+    template <typename To, std::size_t N>
+        requires ::ui::internal::is_fp8<To>
+    UI_ALWAYS_INLINE auto stochastic_cast(
+        Vec<N, float> const& v,
+        Vec<N, std::uint32_t> const& random
+    ) noexcept -> Vec<N, To> {
+        return cast_float32_to_float8_stochastic<To>(v, random);
+    }
+
 } // namespace ui
 
 #endif // AMT_UI_ARCH_ARM_CAST_FLOAT_HPP
@@ -2,9 +2,22 @@
 #define AMT_UI_ARCH_ARM_INFO_HPP
 
 #include "../features.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include <optional>
+#include <span>
+#include <string_view>
+
+#if defined(UI_CPU_X86)
+    #if defined(UI_COMPILER_MSVC)
+        #include <intrin.h>
+    #elif defined(UI_COMPILER_GCC) || defined(UI_COMPILER_CLANG)
+        #include <cpuid.h>
+    #endif
+#endif
 
 #define UI_CPU_API_ID_WIN 1
 #define UI_CPU_API_ID_BSD 2
@@ -36,6 +49,12 @@
     #define UI_CPU_API UI_CPU_API_ID_BSD
 #elif defined(UI_OS_LINUX) || defined(UI_OS_ANDROID)
     #include <sys/sysinfo.h>
+    #include <unistd.h>
+    #include <cstdio>
+    #if __has_include(<sys/auxv.h>)
+        #include <sys/auxv.h>
+        #define UI_CPU_HAS_AUXV
+    #endif
     #define UI_CPU_API UI_CPU_API_ID_LINUX
 #endif
 
@@ -44,16 +63,266 @@ namespace ui {
     struct CacheInfo {
         std::uint8_t level;
         unsigned size;
+        // Number of logical processors sharing one instance of this cache.
+        unsigned shared_by{1};
+
+        // Portion of the cache a single logical processor can count on when every sharer is busy.
+        constexpr auto size_per_thread() const noexcept -> unsigned {
+            return size / std::max(shared_by, 1u);
+        }
+    };
+
+    // Fixed capacity list of cache levels so that `CpuInfo` never touches the heap.
+    struct CacheLevels {
+        static constexpr std::size_t capacity = 4;
+
+        constexpr auto push_back(CacheInfo info) noexcept -> void {
+            if (m_size < capacity) m_data[m_size++] = info;
+        }
+
+        constexpr auto size() const noexcept -> std::size_t { return m_size; }
+        constexpr auto empty() const noexcept -> bool { return m_size == 0; }
+        constexpr auto operator[](std::size_t k) const noexcept -> CacheInfo const& { return m_data[k]; }
+        constexpr auto begin() const noexcept -> CacheInfo const* { return m_data.data(); }
+        constexpr auto end() const noexcept -> CacheInfo const* { return m_data.data() + m_size; }
+        constexpr auto begin() noexcept -> CacheInfo* { return m_data.data(); }
+        constexpr auto end() noexcept -> CacheInfo* { return m_data.data() + m_size; }
+
+        // Returns the size of the cache at the given level or zero if the level is not present.
+        constexpr auto at_level(std::uint8_t level) const noexcept -> unsigned {
+            for (auto const& c: *this) if (c.level == level) return c.size;
+            return 0;
+        }
+    private:
+        std::array<CacheInfo, capacity> m_data{};
+        std::uint8_t m_size{};
+    };
+
+    // Instruction set extensions reported by the running CPU and enabled by the OS.
+    struct CpuFeatures {
+        // x86
+        bool sse2{};
+        bool sse3{};
+        bool ssse3{};
+        bool sse41{};
+        bool sse42{};
+        bool popcnt{};
+        bool avx{};
+        bool avx2{};
+        bool fma{};
+        bool f16c{};
+        bool bmi1{};
+        bool bmi2{};
+        bool lzcnt{};
+        bool avx512f{};
+        bool avx512dq{};
+        bool avx512cd{};
+        bool avx512bw{};
+        bool avx512vl{};
+        bool avx512vnni{};
+        bool avx512bf16{};
+        bool avx512fp16{};
+        bool avxvnni{};
+        // arm
+        bool neon{};
+        bool neon_fp16{};
+        bool neon_dotprod{};
+        bool neon_bf16{};
+        bool neon_i8mm{};
+        bool sve{};
+        // wasm
+        bool simd128{};
     };
 
     struct CpuInfo {
-        std::vector<CacheInfo> cache;
-        std::vector<CacheInfo> icache;
+        CacheLevels cache;
+        CacheLevels icache;
         unsigned cacheline;
         std::size_t mem;
+        unsigned physical_cores;
+        unsigned logical_cores;
+        CpuFeatures features;
+        unsigned numa_nodes{1};
+    };
+
+    // One instance of a data or unified cache and the logical processors that share it.
+    struct CacheDomain {
+        std::uint8_t level;
+        unsigned size;
+        unsigned line_size;
+        std::vector<unsigned> cpus;
+    };
+
+    // One physical core and its SMT siblings.
+    struct CoreInfo {
+        unsigned id;
+        unsigned package;
+        unsigned node;
+        std::vector<unsigned> cpus;
+    };
+
+    struct NumaNode {
+        unsigned id;
+        std::size_t mem;
+        std::vector<unsigned> cpus;
+    };
+
+    struct CpuTopology {
+        std::vector<CoreInfo> cores;
+        std::vector<CacheDomain> caches;
+        std::vector<NumaNode> nodes;
+
+        // Every cache instance at the given level; workers assigned to the processors of one
+        // domain share its capacity.
+        auto caches_at(std::uint8_t level) const -> std::vector<CacheDomain const*> {
+            auto res = std::vector<CacheDomain const*>{};
+            for (auto const& c: caches) if (c.level == level) res.push_back(&c);
+            return res;
+        }
+
+        // Cache instance at the given level that the logical processor uses.
+        auto cache_of(unsigned cpu, std::uint8_t level) const noexcept -> CacheDomain const* {
+            for (auto const& c: caches) {
+                if (c.level != level) continue;
+                if (std::find(c.cpus.begin(), c.cpus.end(), cpu) != c.cpus.end()) return &c;
+            }
+            return nullptr;
+        }
+
+        auto core_of(unsigned cpu) const noexcept -> CoreInfo const* {
+            for (auto const& c: cores) {
+                if (std::find(c.cpus.begin(), c.cpus.end(), cpu) != c.cpus.end()) return &c;
+            }
+            return nullptr;
+        }
+
+        auto logical_cores() const noexcept -> std::size_t {
+            auto res = std::size_t{};
+            for (auto const& c: cores) res += c.cpus.size();
+            return res;
+        }
     };
 
     namespace internal {
+        #if defined(UI_CPU_X86)
+        struct CpuIdRegs {
+            std::uint32_t eax;
+            std::uint32_t ebx;
+            std::uint32_t ecx;
+            std::uint32_t edx;
+        };
+
+        inline auto cpuid(std::uint32_t leaf, std::uint32_t subleaf = 0) noexcept -> CpuIdRegs {
+            #if defined(UI_COMPILER_MSVC)
+                int regs[4];
+                __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+                return {
+                    static_cast<std::uint32_t>(regs[0]),
+                    static_cast<std::uint32_t>(regs[1]),
+                    static_cast<std::uint32_t>(regs[2]),
+                    static_cast<std::uint32_t>(regs[3])
+                };
+            #else
+                unsigned a{}, b{}, c{}, d{};
+                __cpuid_count(leaf, subleaf, a, b, c, d);
+                return { a, b, c, d };
+            #endif
+        }
+
+        // Reads the extended control register; tells us which register states the OS saves.
+        inline auto xgetbv(std::uint32_t xcr) noexcept -> std::uint64_t {
+            #if defined(UI_COMPILER_MSVC)
+                return _xgetbv(xcr);
+            #else
+                std::uint32_t lo{}, hi{};
+                __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(xcr));
+                return (static_cast<std::uint64_t>(hi) << 32) | lo;
+            #endif
+        }
+
+        inline auto detect_x86_features(CpuFeatures& f) noexcept -> void {
+            constexpr auto bit = [](std::uint32_t reg, unsigned pos) { return ((reg >> pos) & 1) != 0; };
+
+            auto const max_leaf = cpuid(0).eax;
+            if (max_leaf < 1) return;
+
+            auto const l1 = cpuid(1);
+            auto const l7 = max_leaf >= 7 ? cpuid(7, 0) : CpuIdRegs{};
+            auto const l7_1 = (max_leaf >= 7 && l7.eax >= 1) ? cpuid(7, 1) : CpuIdRegs{};
+            auto const ext = cpuid(0x80000000).eax >= 0x80000001 ? cpuid(0x80000001) : CpuIdRegs{};
+
+            auto const osxsave = bit(l1.ecx, 27);
+            auto const xcr0 = osxsave ? xgetbv(0) : std::uint64_t{};
+            // XMM and YMM states
+            auto const os_avx = (xcr0 & 0x6) == 0x6;
+            // XMM, YMM, opmask, ZMM_Hi256 and Hi16_ZMM states
+            auto const os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+            f.sse2   = bit(l1.edx, 26);
+            f.sse3   = bit(l1.ecx, 0);
+            f.ssse3  = bit(l1.ecx, 9);
+            f.sse41  = bit(l1.ecx, 19);
+            f.sse42  = bit(l1.ecx, 20);
+            f.popcnt = bit(l1.ecx, 23);
+            f.bmi1   = bit(l7.ebx, 3);
+            f.bmi2   = bit(l7.ebx, 8);
+            f.lzcnt  = bit(ext.ecx, 5);
+
+            f.avx    = os_avx && bit(l1.ecx, 28);
+            f.fma    = f.avx && bit(l1.ecx, 12);
+            f.f16c   = f.avx && bit(l1.ecx, 29);
+            f.avx2   = f.avx && bit(l7.ebx, 5);
+            f.avxvnni = f.avx && bit(l7_1.eax, 4);
+
+            if (os_avx512) {
+                f.avx512f    = bit(l7.ebx, 16);
+                f.avx512dq   = bit(l7.ebx, 17);
+                f.avx512cd   = bit(l7.ebx, 28);
+                f.avx512bw   = bit(l7.ebx, 30);
+                f.avx512vl   = bit(l7.ebx, 31);
+                f.avx512vnni = bit(l7.ecx, 11);
+                f.avx512fp16 = bit(l7.edx, 23);
+                f.avx512bf16 = bit(l7_1.eax, 5);
+            }
+        }
+
+        // Number of logical processors sharing one core; leaf 0xB reports it at the SMT level.
+        inline auto x86_threads_per_core() noexcept -> unsigned {
+            if (cpuid(0).eax < 0xB) return 1;
+            auto const smt = cpuid(0xB, 0);
+            auto const level_type = (smt.ecx >> 8) & 0xff;
+            auto const count = smt.ebx & 0xffff;
+            if (level_type != 1 || count == 0) return 1;
+            return count;
+        }
+        #endif
+
+        // Fallback for platforms without a runtime query; reports what the compiler was allowed to use.
+        inline auto detect_compile_time_features(CpuFeatures& f) noexcept -> void {
+            #if defined(UI_ARM_HAS_NEON) || defined(UI_CPU_ARM64)
+                f.neon = true;
+            #endif
+            #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+                f.neon_fp16 = true;
+            #endif
+            #if defined(__ARM_FEATURE_DOTPROD)
+                f.neon_dotprod = true;
+            #endif
+            #if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+                f.neon_bf16 = true;
+            #endif
+            #if defined(__ARM_FEATURE_MATMUL_INT8)
+                f.neon_i8mm = true;
+            #endif
+            #if defined(__ARM_FEATURE_SVE)
+                f.sve = true;
+            #endif
+            #if defined(__wasm_simd128__)
+                f.simd128 = true;
+            #endif
+            (void)f;
+        }
+
         #if UI_CPU_API == UI_CPU_API_ID_BSD
         template <typename T>
         inline static auto read_info_by_name(std::string_view name) -> std::optional<T> {
@@ -81,9 +350,10 @@ namespace ui {
                 .icache = {},
                 .cacheline = UI_CACHE_LINE_SIZE,
                 .mem = 4 * 1024 * 1024,
+                .physical_cores = 1,
+                .logical_cores = 1,
+                .features = {},
             };
-            res.cache.reserve(3);
-            res.icache.reserve(3);
             auto mem = read_info_by_name<std::size_t>("hw.memsize_usable");
             auto cacheline = read_info_by_name<unsigned>("hw.cachelinesize");
             auto l1c = read_info_by_name<unsigned>("hw.l1dcachesize");  
@@ -102,6 +372,23 @@ namespace ui {
             if (il3c) res.icache.push_back({ .level = 3, .size = *il3c });
             if (mem) res.mem = *mem;
             if (cacheline) res.cacheline = *cacheline;
+
+            auto physical = read_info_by_name<std::int32_t>("hw.physicalcpu");
+            auto logical = read_info_by_name<std::int32_t>("hw.logicalcpu");
+            if (physical && *physical > 0) res.physical_cores = static_cast<unsigned>(*physical);
+            if (logical && *logical > 0) res.logical_cores = static_cast<unsigned>(*logical);
+
+            #if defined(UI_CPU_ARM64) || defined(UI_CPU_ARM32)
+            auto has = [](std::string_view name) {
+                auto v = read_info_by_name<std::int32_t>(name);
+                return v && *v != 0;
+            };
+            res.features.neon = true;
+            res.features.neon_fp16 = has("hw.optional.arm.FEAT_FP16");
+            res.features.neon_dotprod = has("hw.optional.arm.FEAT_DotProd");
+            res.features.neon_bf16 = has("hw.optional.arm.FEAT_BF16");
+            res.features.neon_i8mm = has("hw.optional.arm.FEAT_I8MM");
+            #endif
             return res;
         }
         #elif UI_CPU_API == UI_CPU_API_ID_WIN
@@ -111,9 +398,10 @@ namespace ui {
                 .icache = {},
                 .cacheline = UI_CACHE_LINE_SIZE,
                 .mem = 4 * 1024 * 1024,
+                .physical_cores = 1,
+                .logical_cores = 1,
+                .features = {},
             };
-            res.cache.reserve(3);
-            res.icache.reserve(3);
 
             // Get total physical memory using GlobalMemoryStatusEx.
             MEMORYSTATUSEX memStatus = {};
@@ -130,17 +418,33 @@ namespace ui {
 
                 std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(len / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
                 if (GetLogicalProcessorInformation(buffer.data(), &len)) {
+                    unsigned physical = 0;
+                    unsigned logical = 0;
+                    unsigned nodes = 0;
                     for (const auto& info : buffer) {
+                        if (info.Relationship == RelationNumaNode) ++nodes;
+                        if (info.Relationship == RelationProcessorCore) {
+                            ++physical;
+                            for (auto mask = info.ProcessorMask; mask != 0; mask &= mask - 1) ++logical;
+                        }
                         if (info.Relationship == RelationCache) {
                             int level = info.Cache.Level;
                             std::size_t size = info.Cache.Size;
                             // For Windows, info.Cache.Type may be:
                             // CacheUnified, CacheData, or CacheInstruction.
+                            unsigned shared_by = 0;
+                            for (auto mask = info.ProcessorMask; mask != 0; mask &= mask - 1) ++shared_by;
+                            auto const cache = CacheInfo {
+                                .level = static_cast<std::uint8_t>(level),
+                                .size = static_cast<unsigned>(size),
+                                .shared_by = std::max(shared_by, 1u)
+                            };
+                            // The same level is listed once per instance; keep only the first one.
                             if (info.Cache.Type == CacheUnified || info.Cache.Type == CacheData) {
-                                res.cache.push_back(CacheInfo { .level = static_cast<std::uint8_t>(level), .size = static_cast<unsigned>(size)});
+                                if (res.cache.at_level(cache.level) == 0) res.cache.push_back(cache);
                             }
                             if (info.Cache.Type == CacheInstruction) {
-                                res.icache.push_back(CacheInfo{ .level = static_cast<std::uint8_t>(level), .size = static_cast<unsigned>(size) });
+                                if (res.icache.at_level(cache.level) == 0) res.icache.push_back(cache);
                             }
                             // Use the reported cache line size if available.
                             if (info.Cache.LineSize > 0) {
@@ -148,21 +452,89 @@ namespace ui {
                             }
                         }
                     }
+                    if (physical > 0) res.physical_cores = physical;
+                    if (logical > 0) res.logical_cores = logical;
+                    if (nodes > 0) res.numa_nodes = nodes;
                 }
             }
 
+            #if defined(UI_CPU_ARM64) || defined(UI_CPU_ARM32)
+            res.features.neon = true;
+            res.features.neon_dotprod = IsProcessorFeaturePresent(43 /*PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE*/) != FALSE;
+            #endif
+
             return res;
         }
         #elif UI_CPU_API == UI_CPU_API_ID_LINUX
+        // Reads a small sysfs file into the buffer and strips the trailing newline.
+        inline static auto read_sys_file(char const* path, std::span<char> buff) noexcept -> std::optional<std::string_view> {
+            auto* file = std::fopen(path, "r");
+            if (file == nullptr) return {};
+            auto len = std::fread(buff.data(), 1, buff.size() - 1, file);
+            std::fclose(file);
+            while (len > 0 && (buff[len - 1] == '\n' || buff[len - 1] == ' ')) --len;
+            return std::string_view(buff.data(), len);
+        }
+
+        inline static auto parse_sys_uint(std::string_view s) noexcept -> std::optional<std::size_t> {
+            if (s.empty()) return {};
+            auto res = std::size_t{};
+            auto i = std::size_t{};
+            for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; ++i) res = res * 10 + static_cast<std::size_t>(s[i] - '0');
+            if (i == 0) return {};
+            // Sizes are reported as "48K" or "2M".
+            if (i < s.size()) {
+                switch (s[i]) {
+                    case 'K': res *= 1024; break;
+                    case 'M': res *= 1024 * 1024; break;
+                    case 'G': res *= 1024 * 1024 * 1024; break;
+                    default: break;
+                }
+            }
+            return res;
+        }
+
+        inline static auto read_sys_uint(char const* path) noexcept -> std::optional<std::size_t> {
+            char buff[64];
+            auto s = read_sys_file(path, buff);
+            if (!s) return {};
+            return parse_sys_uint(*s);
+        }
+
+        // Calls `fn` for every processor in a cpu list like "0-3,8,10-11".
+        template <typename Fn>
+        inline static auto for_each_in_cpu_list(std::string_view s, Fn&& fn) -> void {
+            while (!s.empty()) {
+                auto const comma = s.find(',');
+                auto range = s.substr(0, comma);
+                s = comma == std::string_view::npos ? std::string_view{} : s.substr(comma + 1);
+
+                auto const dash = range.find('-');
+                auto const first = parse_sys_uint(range.substr(0, dash));
+                if (!first) continue;
+                auto last = first;
+                if (dash != std::string_view::npos) last = parse_sys_uint(range.substr(dash + 1));
+                if (!last) continue;
+                for (auto i = *first; i <= *last; ++i) fn(static_cast<unsigned>(i));
+            }
+        }
+
+        inline static auto count_cpu_list(std::string_view s) -> unsigned {
+            auto res = 0u;
+            for_each_in_cpu_list(s, [&res](unsigned) { ++res; });
+            return res;
+        }
+
         inline static auto cpu_info_helper() -> CpuInfo {
             auto res = CpuInfo {
                 .cache = {},
                 .icache = {},
                 .cacheline = UI_CACHE_LINE_SIZE,
                 .mem = 4 * 1024 * 1024,
+                .physical_cores = 1,
+                .logical_cores = 1,
+                .features = {},
             };
-            res.cache.reserve(3);
-            res.icache.reserve(3);
             // Get total memory using sysinfo
             struct sysinfo info;
             if (sysinfo(&info) == 0) {
@@ -208,6 +580,61 @@ namespace ui {
                 res.icache.push_back({ 3, static_cast<unsigned>(l3i) });
             #endif
 
+            // Number of processors sharing each cache level, taken from the first processor.
+            for (auto index = 0u; index < 8; ++index) {
+                char path[128];
+                char buff[512];
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/level", index);
+                auto level = read_sys_uint(path);
+                if (!level) break;
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/type", index);
+                auto type = read_sys_file(path, buff);
+                auto is_instruction = type && *type == "Instruction";
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%u/shared_cpu_list", index);
+                auto list = read_sys_file(path, buff);
+                if (!list) continue;
+                auto const shared_by = std::max(count_cpu_list(*list), 1u);
+
+                auto& levels = is_instruction ? res.icache : res.cache;
+                for (auto& c: levels) {
+                    if (c.level == *level) c.shared_by = shared_by;
+                }
+            }
+
+            {
+                char buff[256];
+                auto nodes = read_sys_file("/sys/devices/system/node/online", buff);
+                if (nodes) res.numa_nodes = std::max(count_cpu_list(*nodes), 1u);
+            }
+
+            long online = sysconf(_SC_NPROCESSORS_ONLN);
+            if (online > 0) {
+                res.logical_cores = static_cast<unsigned>(online);
+                res.physical_cores = res.logical_cores;
+                #if defined(UI_CPU_X86)
+                res.physical_cores = std::max(res.logical_cores / x86_threads_per_core(), 1u);
+                #endif
+            }
+
+            #if defined(UI_CPU_HAS_AUXV) && (defined(UI_CPU_ARM64) || defined(UI_CPU_ARM32))
+            auto const hwcap = getauxval(AT_HWCAP);
+            auto const hwcap2 = getauxval(AT_HWCAP2);
+            #if defined(UI_CPU_ARM64)
+            // Bit positions from <asm/hwcap.h>; spelled out since older headers lack the newer ones.
+            res.features.neon = (hwcap & (1ul << 1)) != 0;          // HWCAP_ASIMD
+            res.features.neon_fp16 = (hwcap & (1ul << 10)) != 0;    // HWCAP_ASIMDHP
+            res.features.neon_dotprod = (hwcap & (1ul << 20)) != 0; // HWCAP_ASIMDDP
+            res.features.sve = (hwcap & (1ul << 22)) != 0;          // HWCAP_SVE
+            res.features.neon_i8mm = (hwcap2 & (1ul << 13)) != 0;   // HWCAP2_I8MM
+            res.features.neon_bf16 = (hwcap2 & (1ul << 14)) != 0;   // HWCAP2_BF16
+            #else
+            res.features.neon = (hwcap & (1ul << 12)) != 0;         // HWCAP_NEON
+            (void)hwcap2;
+            #endif
+            #endif
+
             return res;
         }
         #else
@@ -217,19 +644,213 @@ namespace ui {
                 .icache = {},
                 .cacheline = UI_CACHE_LINE_SIZE,
                 .mem = 4 * 1024 * 1024,
+                .physical_cores = 1,
+                .logical_cores = 1,
+                .features = {},
             };
             return res;
         }
         #endif
+        inline auto make_cpu_info() noexcept -> CpuInfo {
+            auto res = cpu_info_helper();
+            detect_compile_time_features(res.features);
+            #if defined(UI_CPU_X86)
+            detect_x86_features(res.features);
+            #endif
+            if (res.logical_cores < res.physical_cores) res.logical_cores = res.physical_cores;
+            return res;
+        }
     } // namespace interanl
 
-    inline static auto cpu_info() noexcept {
-        return internal::cpu_info_helper();
+    // The OS and the CPU are queried once; later calls return the cached result without
+    // any syscalls or allocations, so it is safe to call from hot loops.
+    inline auto cpu_info() noexcept -> CpuInfo const& {
+        static auto const info = internal::make_cpu_info();
+        return info;
+    }
+
+    namespace internal {
+        // Used when the OS does not expose the topology: one node, no sharing information.
+        inline auto synthesize_cpu_topology(CpuInfo const& info) -> CpuTopology {
+            auto res = CpuTopology{};
+            auto const threads = std::max(info.logical_cores / std::max(info.physical_cores, 1u), 1u);
+            auto node = NumaNode{ .id = 0, .mem = info.mem, .cpus = {} };
+            for (auto core = 0u; core < info.physical_cores; ++core) {
+                auto c = CoreInfo{ .id = core, .package = 0, .node = 0, .cpus = {} };
+                for (auto t = 0u; t < threads; ++t) {
+                    c.cpus.push_back(core * threads + t);
+                    node.cpus.push_back(core * threads + t);
+                }
+                res.cores.push_back(std::move(c));
+            }
+            res.nodes.push_back(std::move(node));
+            return res;
+        }
+
+        #if UI_CPU_API == UI_CPU_API_ID_LINUX
+        inline auto cpu_topology_helper() -> CpuTopology {
+            auto res = CpuTopology{};
+            char path[128];
+            char buff[1024];
+
+            auto online = read_sys_file("/sys/devices/system/cpu/online", buff);
+            if (!online) return synthesize_cpu_topology(cpu_info());
+
+            auto cpus = std::vector<unsigned>{};
+            for_each_in_cpu_list(*online, [&cpus](unsigned cpu) { cpus.push_back(cpu); });
+
+            auto const contains = [](std::vector<unsigned> const& v, unsigned cpu) {
+                return std::find(v.begin(), v.end(), cpu) != v.end();
+            };
+
+            for (auto cpu: cpus) {
+                // SMT siblings; every sibling list is recorded once.
+                auto seen = false;
+                for (auto const& c: res.cores) seen = seen || contains(c.cpus, cpu);
+                if (!seen) {
+                    auto core = CoreInfo{ .id = cpu, .package = 0, .node = 0, .cpus = {} };
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+                    if (auto v = read_sys_uint(path)) core.id = static_cast<unsigned>(*v);
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+                    if (auto v = read_sys_uint(path)) core.package = static_cast<unsigned>(*v);
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+                    if (auto list = read_sys_file(path, buff)) {
+                        for_each_in_cpu_list(*list, [&core](unsigned c) { core.cpus.push_back(c); });
+                    }
+                    if (core.cpus.empty()) core.cpus.push_back(cpu);
+                    res.cores.push_back(std::move(core));
+                }
+
+                // Data and unified caches; an instance is identified by its level and the processors sharing it.
+                for (auto index = 0u; index < 8; ++index) {
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+                    auto level = read_sys_uint(path);
+                    if (!level) break;
+
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu, index);
+                    auto type = read_sys_file(path, buff);
+                    if (type && *type == "Instruction") continue;
+
+                    auto domain = CacheDomain{ .level = static_cast<std::uint8_t>(*level), .size = 0, .line_size = UI_CACHE_LINE_SIZE, .cpus = {} };
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+                    if (auto list = read_sys_file(path, buff)) {
+                        for_each_in_cpu_list(*list, [&domain](unsigned c) { domain.cpus.push_back(c); });
+                    }
+                    if (domain.cpus.empty()) domain.cpus.push_back(cpu);
+
+                    auto duplicate = false;
+                    for (auto const& c: res.caches) {
+                        duplicate = duplicate || (c.level == domain.level && c.cpus == domain.cpus);
+                    }
+                    if (duplicate) continue;
+
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+                    if (auto v = read_sys_uint(path)) domain.size = static_cast<unsigned>(*v);
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/coherency_line_size", cpu, index);
+                    if (auto v = read_sys_uint(path)) domain.line_size = static_cast<unsigned>(*v);
+                    res.caches.push_back(std::move(domain));
+                }
+            }
+
+            if (auto nodes = read_sys_file("/sys/devices/system/node/online", buff)) {
+                auto ids = std::vector<unsigned>{};
+                for_each_in_cpu_list(*nodes, [&ids](unsigned n) { ids.push_back(n); });
+                for (auto id: ids) {
+                    auto node = NumaNode{ .id = id, .mem = 0, .cpus = {} };
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", id);
+                    if (auto list = read_sys_file(path, buff)) {
+                        for_each_in_cpu_list(*list, [&node](unsigned c) { node.cpus.push_back(c); });
+                    }
+
+                    // "Node 0 MemTotal:       16318412 kB"
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/meminfo", id);
+                    if (auto meminfo = read_sys_file(path, buff)) {
+                        auto pos = meminfo->find("MemTotal:");
+                        if (pos != std::string_view::npos) {
+                            auto rest = meminfo->substr(pos + 9);
+                            rest.remove_prefix(std::min(rest.find_first_not_of(' '), rest.size()));
+                            if (auto kb = parse_sys_uint(rest)) node.mem = *kb * 1024;
+                        }
+                    }
+
+                    for (auto& core: res.cores) {
+                        if (contains(node.cpus, core.cpus.front())) core.node = id;
+                    }
+                    res.nodes.push_back(std::move(node));
+                }
+            }
+
+            if (res.nodes.empty()) {
+                auto node = NumaNode{ .id = 0, .mem = cpu_info().mem, .cpus = cpus };
+                res.nodes.push_back(std::move(node));
+            }
+            return res;
+        }
+        #elif UI_CPU_API == UI_CPU_API_ID_WIN
+        inline auto cpu_topology_helper() -> CpuTopology {
+            auto res = CpuTopology{};
+            DWORD len = 0;
+            if (GetLogicalProcessorInformation(nullptr, &len) != FALSE || GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+                return synthesize_cpu_topology(cpu_info());
+            }
+
+            std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(len / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+            if (!GetLogicalProcessorInformation(buffer.data(), &len)) return synthesize_cpu_topology(cpu_info());
+
+            auto const to_cpus = [](ULONG_PTR mask) {
+                auto cpus = std::vector<unsigned>{};
+                for (auto i = 0u; mask != 0; ++i, mask >>= 1) {
+                    if (mask & 1) cpus.push_back(i);
+                }
+                return cpus;
+            };
+
+            for (auto const& info: buffer) {
+                if (info.Relationship == RelationProcessorCore) {
+                    auto core = CoreInfo{ .id = static_cast<unsigned>(res.cores.size()), .package = 0, .node = 0, .cpus = to_cpus(info.ProcessorMask) };
+                    res.cores.push_back(std::move(core));
+                } else if (info.Relationship == RelationCache) {
+                    if (info.Cache.Type != CacheUnified && info.Cache.Type != CacheData) continue;
+                    res.caches.push_back(CacheDomain {
+                        .level = static_cast<std::uint8_t>(info.Cache.Level),
+                        .size = static_cast<unsigned>(info.Cache.Size),
+                        .line_size = info.Cache.LineSize,
+                        .cpus = to_cpus(info.ProcessorMask)
+                    });
+                } else if (info.Relationship == RelationNumaNode) {
+                    auto node = NumaNode{ .id = static_cast<unsigned>(info.NumaNode.NodeNumber), .mem = 0, .cpus = to_cpus(info.ProcessorMask) };
+                    ULONGLONG bytes = 0;
+                    if (GetNumaAvailableMemoryNodeEx(static_cast<USHORT>(node.id), &bytes)) node.mem = static_cast<std::size_t>(bytes);
+                    res.nodes.push_back(std::move(node));
+                }
+            }
+
+            for (auto& core: res.cores) {
+                for (auto const& node: res.nodes) {
+                    if (std::find(node.cpus.begin(), node.cpus.end(), core.cpus.front()) != node.cpus.end()) core.node = node.id;
+                }
+            }
+            if (res.cores.empty()) return synthesize_cpu_topology(cpu_info());
+            return res;
+        }
+        #else
+        inline auto cpu_topology_helper() -> CpuTopology {
+            return synthesize_cpu_topology(cpu_info());
+        }
+        #endif
+    } // namespace internal
+
+    // Cores, their SMT siblings, cache sharing and NUMA nodes. Queried once and cached; meant for
+    // partitioning work so that each worker's working set fits its share of the L2/L3.
+    inline auto cpu_topology() -> CpuTopology const& {
+        static auto const topology = internal::cpu_topology_helper();
+        return topology;
     }
 
 } // ui
 
 #undef UI_CPU_API
+#undef UI_CPU_HAS_AUXV
 #undef UI_CPU_API_ID_LINUX
 #undef UI_CPU_API_ID_WIN
 #undef UI_CPU_API_ID_BSD
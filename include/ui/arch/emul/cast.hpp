@@ -18,6 +18,9 @@ namespace ui::emul {
     template <typename To, std::size_t N, typename From>
     UI_ALWAYS_INLINE auto cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
         if constexpr (std::same_as<To, From>) return v;
+        if constexpr (::ui::internal::is_fp8<To> || ::ui::internal::is_fp8<From>) {
+            return ::ui::internal::cast_float8<To, false>(v);
+        }
         return map([](auto v_) { 
             if constexpr (std::floating_point<From>) {
                 static constexpr auto min = std::numeric_limits<To>::min();
@@ -50,6 +53,12 @@ namespace ui::emul {
         }, v);
     }
 
+    template <typename To, std::size_t N, std::floating_point From>
+        requires ::ui::internal::is_fp8<To>
+    UI_ALWAYS_INLINE auto sat_cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
+        return ::ui::internal::cast_float8<To, true>(v);
+    }
+
     // reinterpret cast
     template <typename To, std::size_t N, typename From>
         requires (sizeof(To) == sizeof(From))
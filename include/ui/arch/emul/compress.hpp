@@ -0,0 +1,150 @@
+#ifndef AMT_UI_ARCH_EMUL_COMPRESS_HPP
+#define AMT_UI_ARCH_EMUL_COMPRESS_HPP
+
+#include "cast.hpp"
+#include "masked.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ui::emul {
+
+    namespace internal {
+        using namespace ::ui::internal;
+
+        // Byte shuffle tables used by the native backends. Entry `m` of `compress_lut` moves the
+        // lanes selected by the bit mask `m` to the front; entry `m` of `expand_lut` moves the
+        // leading lanes to the positions selected by `m`. Unused bytes hold 0x80, which both
+        // `pshufb` and `tbl`/`swizzle` turn into zero.
+        template <std::size_t Lanes, std::size_t LaneBytes>
+        alignas(16) inline constexpr auto compress_lut = [] {
+            std::array<std::array<std::uint8_t, Lanes * LaneBytes>, (1u << Lanes)> res{};
+            for (auto m = 0u; m < res.size(); ++m) {
+                res[m].fill(0x80);
+                auto k = 0u;
+                for (auto i = 0u; i < Lanes; ++i) {
+                    if (!((m >> i) & 1)) continue;
+                    for (auto b = 0u; b < LaneBytes; ++b) {
+                        res[m][k * LaneBytes + b] = static_cast<std::uint8_t>(i * LaneBytes + b);
+                    }
+                    ++k;
+                }
+            }
+            return res;
+        }();
+
+        template <std::size_t Lanes, std::size_t LaneBytes>
+        alignas(16) inline constexpr auto expand_lut = [] {
+            std::array<std::array<std::uint8_t, Lanes * LaneBytes>, (1u << Lanes)> res{};
+            for (auto m = 0u; m < res.size(); ++m) {
+                res[m].fill(0x80);
+                auto k = 0u;
+                for (auto i = 0u; i < Lanes; ++i) {
+                    if (!((m >> i) & 1)) continue;
+                    for (auto b = 0u; b < LaneBytes; ++b) {
+                        res[m][i * LaneBytes + b] = static_cast<std::uint8_t>(k * LaneBytes + b);
+                    }
+                    ++k;
+                }
+            }
+            return res;
+        }();
+
+        // 16 byte lanes are compressed as two halves; entry `k` closes the gap between the
+        // `k` packed bytes of the low half and the packed bytes of the high half at offset 8.
+        alignas(16) inline constexpr auto compress_merge_lut = [] {
+            std::array<std::array<std::uint8_t, 16>, 9> res{};
+            for (auto k = 0u; k < res.size(); ++k) {
+                for (auto j = 0u; j < 16; ++j) {
+                    auto from = j < k ? j : j + 8 - k;
+                    res[k][j] = static_cast<std::uint8_t>(from < 16 ? from : 0x80);
+                }
+            }
+            return res;
+        }();
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE constexpr auto active_count(mask_t<N, T> const& mask) noexcept -> std::size_t {
+            auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return (std::size_t{} + ... + static_cast<std::size_t>(mask[Is] != 0));
+            };
+            return helper(std::make_index_sequence<N>{});
+        }
+    } // namespace internal
+
+// MARK: Compress
+    /**
+     * @brief Packs the active lanes to the front, preserving their order; the remaining lanes are zero.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto compress(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> Vec<N, T> {
+        auto res = Vec<N, T>{};
+        auto k = std::size_t{};
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) res[k++] = v[i];
+        }
+        return res;
+    }
+
+    /**
+     * @brief Writes the active lanes contiguously to `out` and returns how many were written.
+     * Memory past the written lanes is left untouched.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto compress_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> std::size_t {
+        auto k = std::size_t{};
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) out[k++] = v[i];
+        }
+        return k;
+    }
+// !MARK
+
+// MARK: Expand
+    /**
+     * @brief Inverse of `compress`; the leading lanes of `v` are spread over the active lanes
+     * in order, inactive lanes are taken from `src`.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto expand(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        auto res = src;
+        auto k = std::size_t{};
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) res[i] = v[k++];
+        }
+        return res;
+    }
+
+    /**
+     * @brief Expands contiguous elements of `in`; only as many elements as there are active lanes are read.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto expand_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        auto res = src;
+        auto k = std::size_t{};
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) res[i] = in[k++];
+        }
+        return res;
+    }
+// !MARK
+
+} // namespace ui::emul
+
+#endif // AMT_UI_ARCH_EMUL_COMPRESS_HPP
@@ -0,0 +1,84 @@
+#ifndef AMT_UI_ARCH_EMUL_GATHER_HPP
+#define AMT_UI_ARCH_EMUL_GATHER_HPP
+
+#include "cast.hpp"
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace ui::emul {
+
+// MARK: Gather
+    /**
+     * @brief Indexed load; lane `i` is `base[indices[i]]`.
+     */
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE static constexpr auto gather(
+        T const* UI_RESTRICT base,
+        Vec<N, I> const& indices
+    ) noexcept -> Vec<N, T> {
+        auto res = Vec<N, T>{};
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((res[Is] = base[static_cast<std::ptrdiff_t>(indices[Is])]),...);
+        };
+        helper(std::make_index_sequence<N>{});
+        return res;
+    }
+
+    /**
+     * @brief Masked indexed load; inactive lanes are taken from `src` and their
+     * addresses are never touched.
+     */
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE static constexpr auto gather(
+        T const* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        auto res = src;
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((mask[Is] ? (res[Is] = base[static_cast<std::ptrdiff_t>(indices[Is])], 0) : 0),...);
+        };
+        helper(std::make_index_sequence<N>{});
+        return res;
+    }
+// !MARK
+
+// MARK: Scatter
+    /**
+     * @brief Indexed store; `base[indices[i]] = v[i]`. Lanes are written from
+     * the lowest to the highest so the highest lane wins on duplicate indices.
+     */
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE static constexpr auto scatter(
+        T* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        Vec<N, T> const& v
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((base[static_cast<std::ptrdiff_t>(indices[Is])] = v[Is]),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
+
+    /**
+     * @brief Masked indexed store; only active lanes are written.
+     */
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE static constexpr auto scatter(
+        T* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((mask[Is] ? (base[static_cast<std::ptrdiff_t>(indices[Is])] = v[Is], 0) : 0),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
+// !MARK
+
+} // namespace ui::emul
+
+#endif // AMT_UI_ARCH_EMUL_GATHER_HPP
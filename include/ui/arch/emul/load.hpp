@@ -3,6 +3,9 @@
 
 #include "cast.hpp"
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace ui::emul {
@@ -73,6 +76,78 @@ namespace ui::emul {
         };
         helper(std::make_index_sequence<N>{});
     }
+
+    namespace internal {
+        // Byte shuffle tables for interleaving `K` streams of `Size`-byte lanes held in 16-byte
+        // registers. Entry `[r][s]` gathers the bytes that stream `s` contributes to output
+        // register `r`; every other byte is 0x80, which `pshufb` and `swizzle` turn into zero.
+        template <std::size_t K, std::size_t Size>
+        alignas(16) inline constexpr auto interleave_lut = [] {
+            std::array<std::array<std::array<std::uint8_t, 16>, K>, K> res{};
+            for (auto r = 0u; r < K; ++r) {
+                for (auto s = 0u; s < K; ++s) res[r][s].fill(0x80);
+                for (auto j = 0u; j < 16; ++j) {
+                    auto byte = r * 16 + j;
+                    auto elem = byte / Size;
+                    auto stream = elem % K;
+                    auto lane = elem / K;
+                    res[r][stream][j] = static_cast<std::uint8_t>(lane * Size + byte % Size);
+                }
+            }
+            return res;
+        }();
+    } // namespace internal
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((
+                data[2 * Is + 0] = a[Is],
+                data[2 * Is + 1] = b[Is]
+            ),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((
+                data[3 * Is + 0] = a[Is],
+                data[3 * Is + 1] = b[Is],
+                data[3 * Is + 2] = c[Is]
+            ),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c,
+        Vec<N, T> const& d
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((
+                data[4 * Is + 0] = a[Is],
+                data[4 * Is + 1] = b[Is],
+                data[4 * Is + 2] = c[Is],
+                data[4 * Is + 3] = d[Is]
+            ),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
 } // namespace ui::emul
 
 #endif // AMT_ARCH_EMUL_LOAD_HPP
@@ -0,0 +1,138 @@
+#ifndef AMT_UI_ARCH_EMUL_MASKED_HPP
+#define AMT_UI_ARCH_EMUL_MASKED_HPP
+
+#include "cast.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace ui::emul {
+
+    namespace internal {
+        using namespace ::ui::internal;
+
+        // Whether `Size` bytes starting at `ptr` stay within one page. Reading past the end of a
+        // buffer is then harmless, except under the address sanitizer which reports it.
+        template <std::size_t Size>
+        UI_ALWAYS_INLINE auto can_overread(void const* ptr) noexcept -> bool {
+            #ifdef UI_HAS_ADDRESS_SANITIZER
+            (void)ptr;
+            return false;
+            #else
+            static_assert(Size <= UI_PAGE_SIZE);
+            auto const offset = reinterpret_cast<std::uintptr_t>(ptr) & (UI_PAGE_SIZE - 1);
+            return offset <= UI_PAGE_SIZE - Size;
+            #endif
+        }
+
+        // Copies `bytes` (< 2 * Chunk) using power-of-two fixed-size pieces, so each `memcpy`
+        // lowers to a single move and no library call is emitted.
+        template <std::size_t Chunk>
+        UI_ALWAYS_INLINE auto copy_bytes(
+            std::uint8_t* UI_RESTRICT dst,
+            std::uint8_t const* UI_RESTRICT src,
+            std::size_t bytes
+        ) noexcept -> void {
+            static_assert(std::has_single_bit(Chunk));
+            if (bytes & Chunk) {
+                std::memcpy(dst, src, Chunk);
+                dst += Chunk;
+                src += Chunk;
+            }
+            if constexpr (Chunk > 1) copy_bytes<Chunk / 2>(dst, src, bytes);
+        }
+
+        // Mask with the first `count` lanes active; sliding window over [~0 x N, 0 x N].
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto tail_mask(std::size_t count) noexcept -> mask_t<N, T> {
+            using mtype = mask_inner_t<T>;
+            alignas(64) static constexpr auto table = []{
+                std::array<mtype, 2 * N> res{};
+                for (auto i = 0ul; i < N; ++i) res[i] = static_cast<mtype>(~mtype{});
+                return res;
+            }();
+            return mask_t<N, T>::load(table.data() + N - std::min(count, N), N);
+        }
+    } // namespace internal
+
+// MARK: Masked Load
+    /**
+     * @brief Loads the active lanes; inactive lanes are taken from `src` and their memory is never read.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto masked_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        auto res = src;
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((mask[Is] ? (res[Is] = in[Is], 0) : 0),...);
+        };
+        helper(std::make_index_sequence<N>{});
+        return res;
+    }
+
+    /**
+     * @brief Loads the first `min(count, N)` lanes and zeroes the rest.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static auto masked_load(
+        T const* UI_RESTRICT in,
+        std::size_t count
+    ) noexcept -> Vec<N, T> {
+        if (count >= N) return Vec<N, T>::load(in, N);
+        auto res = Vec<N, T>{};
+        internal::copy_bytes<std::bit_floor(N * sizeof(T))>(
+            reinterpret_cast<std::uint8_t*>(res.data()),
+            reinterpret_cast<std::uint8_t const*>(in),
+            count * sizeof(T)
+        );
+        return res;
+    }
+// !MARK
+
+// MARK: Masked Store
+    /**
+     * @brief Stores the active lanes; memory of inactive lanes is left untouched.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto masked_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> void {
+        auto const helper = [&]<std::size_t... Is>(std::index_sequence<Is...>){
+            ((mask[Is] ? (out[Is] = v[Is], 0) : 0),...);
+        };
+        helper(std::make_index_sequence<N>{});
+    }
+
+    /**
+     * @brief Stores the first `min(count, N)` lanes.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static auto masked_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        std::size_t count
+    ) noexcept -> void {
+        if (count >= N) {
+            std::memcpy(out, v.data(), sizeof(v));
+            return;
+        }
+        internal::copy_bytes<std::bit_floor(N * sizeof(T))>(
+            reinterpret_cast<std::uint8_t*>(out),
+            reinterpret_cast<std::uint8_t const*>(v.data()),
+            count * sizeof(T)
+        );
+    }
+// !MARK
+
+} // namespace ui::emul
+
+#endif // AMT_UI_ARCH_EMUL_MASKED_HPP
@@ -5,6 +5,9 @@
 #include "ui/arch/basic.hpp"
 #include "ui/base.hpp"
 #include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace ui::emul {
 
@@ -273,6 +276,103 @@ namespace ui::emul {
     }
 // !MARK
 
+// MARK: High-half Multiplication
+    namespace internal {
+        // Upper half of the full product. 64-bit lanes use `int128` when the compiler has it and
+        // 32-bit limbs otherwise.
+        template <std::integral T>
+        UI_ALWAYS_INLINE static constexpr auto mul_high_helper(T l, T r) noexcept -> T {
+            static constexpr auto bits = sizeof(T) * 8;
+            if constexpr (sizeof(T) < 8) {
+                using result_t = widening_result_t<T>;
+                return static_cast<T>((static_cast<result_t>(l) * static_cast<result_t>(r)) >> bits);
+            } else {
+                #ifdef UI_HAS_INT128
+                using result_t = std::conditional_t<std::is_signed_v<T>, int128_t, uint128_t>;
+                return static_cast<T>((static_cast<result_t>(l) * static_cast<result_t>(r)) >> bits);
+                #else
+                auto const a = static_cast<std::uint64_t>(l);
+                auto const b = static_cast<std::uint64_t>(r);
+                auto const ll = (a & 0xffff'ffff) * (b & 0xffff'ffff);
+                auto const lh = (a & 0xffff'ffff) * (b >> 32);
+                auto const hl = (a >> 32) * (b & 0xffff'ffff);
+                auto const mid = (ll >> 32) + (lh & 0xffff'ffff) + (hl & 0xffff'ffff);
+                auto hi = (a >> 32) * (b >> 32) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+                if constexpr (std::is_signed_v<T>) {
+                    // A negative operand reads as itself plus 2^64 when unsigned.
+                    if (l < 0) hi -= b;
+                    if (r < 0) hi -= a;
+                }
+                return static_cast<T>(hi);
+                #endif
+            }
+        }
+    } // namespace internal
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE static constexpr auto mul_high(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> Vec<N, T> {
+        return map([](auto l, auto r) -> T {
+            return internal::mul_high_helper<T>(l, r);
+        }, lhs, rhs);
+    }
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE static constexpr auto mul_wide(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> std::pair<Vec<N, T> /*low*/, Vec<N, T> /*high*/> {
+        return { mul(lhs, rhs), mul_high(lhs, rhs) };
+    }
+// !MARK
+
+// MARK: Dot-Product Accumulate
+    /**
+     * @brief Adds the products of each pair of adjacent lanes to one accumulator lane;
+     * `acc[i] + lhs[2i] * rhs[2i] + lhs[2i + 1] * rhs[2i + 1]`. A product of two `bfloat16` is
+     * exact in `float`, so only the additions round.
+     */
+    template <std::size_t N, std::size_t M>
+        requires (M == 2 * N)
+    UI_ALWAYS_INLINE static constexpr auto dot_acc(
+        Vec<N, float> const& acc,
+        Vec<M, bfloat16> const& lhs,
+        Vec<M, bfloat16> const& rhs
+    ) noexcept -> Vec<N, float> {
+        auto res = acc;
+        for (auto i = 0ul; i < N; ++i) {
+            res[i] += float(lhs[2 * i]) * float(rhs[2 * i]);
+            res[i] += float(lhs[2 * i + 1]) * float(rhs[2 * i + 1]);
+        }
+        return res;
+    }
+
+    /**
+     * @brief Adds the products of each group of four adjacent 8-bit lanes to one 32-bit
+     * accumulator lane; `acc[i] + lhs[4i] * rhs[4i] + ... + lhs[4i + 3] * rhs[4i + 3]`.
+     * The products and their sum are exact; only the accumulation wraps.
+     */
+    template <std::size_t N, std::size_t M, typename A, typename L, typename R>
+        requires (M == 4 * N && internal::int8_dot<A, L, R>)
+    UI_ALWAYS_INLINE static constexpr auto dot_acc(
+        Vec<N, A> const& acc,
+        Vec<M, L> const& lhs,
+        Vec<M, R> const& rhs
+    ) noexcept -> Vec<N, A> {
+        auto res = acc;
+        for (auto i = 0ul; i < N; ++i) {
+            auto sum = std::int32_t{};
+            for (auto k = 4 * i; k < 4 * i + 4; ++k) {
+                sum += std::int32_t(lhs[k]) * std::int32_t(rhs[k]);
+            }
+            res[i] = static_cast<A>(static_cast<std::uint32_t>(res[i]) + static_cast<std::uint32_t>(sum));
+        }
+        return res;
+    }
+// !MARK
+
 } // namespace ui::emul
 
 #endif // AMT_ARCH_EMUL_MUL_HPP
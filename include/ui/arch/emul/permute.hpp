@@ -3,6 +3,8 @@
 
 #include "cast.hpp"
 #include "../../maths.hpp"
+#include <cstddef>
+#include <cstdint>
 
 namespace ui::emul {
 
@@ -43,6 +45,23 @@ namespace ui::emul {
             return Vec<R, T>::load(x[Is]...);
         #endif
     }
+
+    /**
+     * @brief Runtime byte lookup; lane `i` is `table[indices[i]]`, or zero when the index is out of range.
+     */
+    template <std::size_t M, std::size_t N, typename T>
+        requires (sizeof(T) == 1)
+    UI_ALWAYS_INLINE static constexpr auto lookup(
+        Vec<M, T> const& table,
+        Vec<N, std::uint8_t> const& indices
+    ) noexcept -> Vec<N, T> {
+        auto res = Vec<N, T>{};
+        for (auto i = 0ul; i < N; ++i) {
+            auto idx = static_cast<std::size_t>(indices[i]);
+            res[i] = idx < M ? table[idx] : T{};
+        }
+        return res;
+    }
 } // ui::emul
 
 #endif // AMT_UI_ARCH_EMUL_PERMUTE_HPP 
@@ -2,6 +2,7 @@
 #define AMT_ARCH_EMUL_SHIFT_HPP
 
 #include "cast.hpp"
+#include <cassert>
 #include <concepts>
 #include <type_traits>
 #include <utility>
@@ -459,6 +460,30 @@ namespace ui::emul {
         }, a, b);
     }
 // !MARK
+// MARK: Shift by a runtime count
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE static constexpr auto shift_left(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        assert(s < sizeof(T) * 8);
+        return map([s](auto v_) {
+            return static_cast<T>(v_ << s);
+        }, v);
+    }
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE static constexpr auto shift_right(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        assert(s < sizeof(T) * 8);
+        return map([s](auto v_) {
+            return static_cast<T>(v_ >> s);
+        }, v);
+    }
+// !MARK
+
 // MARK: Shift Lane
     template <unsigned Shift, std::size_t N, typename T>
         requires (Shift <= N)
@@ -1073,13 +1073,23 @@ namespace ui::wasm {
 
     template <typename To, std::size_t N, typename From>
     UI_ALWAYS_INLINE auto cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
-        return internal::CastImpl<To, false, true>{}(v);
+        if constexpr (::ui::internal::is_fp8<To> || ::ui::internal::is_fp8<From>) {
+            return ::ui::internal::cast_float8<To, false>(v);
+        } else {
+            return internal::CastImpl<To, false, true>{}(v);
+        }
     }
 
     template <typename To, std::size_t N, std::integral From>
     UI_ALWAYS_INLINE auto sat_cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
         return internal::CastImpl<To, true, true>{}(v);
     }
+
+    template <typename To, std::size_t N, std::floating_point From>
+        requires ::ui::internal::is_fp8<To>
+    UI_ALWAYS_INLINE auto sat_cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
+        return ::ui::internal::cast_float8<To, true>(v);
+    }
 } // namespace ui::wasm
 
 #endif // AMT_UI_ARCH_WASM_CAST_HPP
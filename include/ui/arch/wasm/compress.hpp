@@ -0,0 +1,171 @@
+#ifndef AMT_UI_ARCH_WASM_COMPRESS_HPP
+#define AMT_UI_ARCH_WASM_COMPRESS_HPP
+
+#include "cast.hpp"
+#include "bit.hpp"
+#include "masked.hpp"
+#include "../emul/compress.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ui::wasm {
+
+    namespace internal {
+        using namespace ::ui::internal;
+        using emul::internal::compress_lut;
+        using emul::internal::expand_lut;
+        using emul::internal::compress_merge_lut;
+
+        template <std::size_t N, typename T>
+        static constexpr bool has_native_compress = N * sizeof(T) == 16;
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto lane_bits(mask_t<N, T> const& m) noexcept -> unsigned {
+            auto v = std::bit_cast<v128_t>(m);
+            if constexpr (sizeof(T) == 1) return static_cast<unsigned>(wasm_i8x16_bitmask(v));
+            else if constexpr (sizeof(T) == 2) return static_cast<unsigned>(wasm_i16x8_bitmask(v));
+            else if constexpr (sizeof(T) == 4) return static_cast<unsigned>(wasm_i32x4_bitmask(v));
+            else return static_cast<unsigned>(wasm_i64x2_bitmask(v));
+        }
+
+        UI_ALWAYS_INLINE auto load_lut(std::uint8_t const* p) noexcept -> v128_t {
+            return wasm_v128_load(p);
+        }
+
+        // Joins two 8-byte table entries; the high one is offset by `offset` bytes.
+        UI_ALWAYS_INLINE auto load_lut_halves(
+            std::uint8_t const* lo,
+            std::uint8_t const* hi,
+            std::uint8_t offset
+        ) noexcept -> v128_t {
+            auto h = wasm_i8x16_add(wasm_v128_load64_zero(hi), wasm_u8x16_splat(offset));
+            return wasm_i64x2_shuffle(wasm_v128_load64_zero(lo), h, 0, 2);
+        }
+
+        template <typename T>
+        UI_ALWAYS_INLINE auto compress_bytes(v128_t v, unsigned bits) noexcept -> v128_t {
+            if constexpr (sizeof(T) == 1) {
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto idx = load_lut_halves(compress_lut<8, 1>[lo].data(), compress_lut<8, 1>[hi].data(), 8);
+                auto t = wasm_i8x16_swizzle(v, idx);
+                return wasm_i8x16_swizzle(t, load_lut(compress_merge_lut[std::popcount(lo)].data()));
+            } else {
+                return wasm_i8x16_swizzle(v, load_lut(compress_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+
+        // Inactive lanes are garbage; callers blend them with the source.
+        template <typename T>
+        UI_ALWAYS_INLINE auto expand_bytes(v128_t v, unsigned bits) noexcept -> v128_t {
+            if constexpr (sizeof(T) == 1) {
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto offset = static_cast<std::uint8_t>(std::popcount(lo));
+                auto idx = load_lut_halves(expand_lut<8, 1>[lo].data(), expand_lut<8, 1>[hi].data(), offset);
+                return wasm_i8x16_swizzle(v, idx);
+            } else {
+                return wasm_i8x16_swizzle(v, load_lut(expand_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto active_count(mask_t<N, T> const& mask) noexcept -> std::size_t {
+            if constexpr (has_native_compress<N, T>) {
+                return static_cast<std::size_t>(std::popcount(lane_bits<N, T>(mask)));
+            } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+                return active_count<N / 2, T>(mask.lo) + active_count<N / 2, T>(mask.hi);
+            } else {
+                return emul::internal::active_count<N, T>(mask);
+            }
+        }
+    } // namespace internal
+
+// MARK: Compress
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            auto res = compress_bytes<T>(std::bit_cast<v128_t>(v), lane_bits<N, T>(mask));
+            return std::bit_cast<Vec<N, T>>(res);
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto res = Vec<N, T>{};
+            auto lo = compress(v.lo, mask.lo);
+            auto hi = compress(v.hi, mask.hi);
+            auto n = active_count<N / 2, T>(mask.lo);
+            std::memcpy(res.data(), lo.data(), sizeof(lo));
+            std::memcpy(res.data() + n, hi.data(), sizeof(hi));
+            return res;
+        } else {
+            return emul::compress(v, mask);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> std::size_t {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            auto n = active_count<N, T>(mask);
+            masked_store(out, compress(v, mask), n);
+            return n;
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto n = compress_store(out, v.lo, mask.lo);
+            return n + compress_store(out + n, v.hi, mask.hi);
+        } else {
+            return emul::compress_store(out, v, mask);
+        }
+    }
+// !MARK
+
+// MARK: Expand
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            auto res = expand_bytes<T>(std::bit_cast<v128_t>(v), lane_bits<N, T>(mask));
+            return bitwise_select(mask, std::bit_cast<Vec<N, T>>(res), src);
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            static constexpr auto half = N / 2;
+            auto n = active_count<half, T>(mask.lo);
+            auto rest = Vec<half, T>::load(v.data() + n, half);
+            return join(expand(v.lo, mask.lo, src.lo), expand(rest, mask.hi, src.hi));
+        } else {
+            return emul::expand(v, mask, src);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_compress<N, T>) {
+            return expand(masked_load<N>(in, active_count<N, T>(mask)), mask, src);
+        } else if constexpr (N > 1 && N * sizeof(T) > 16) {
+            auto lo = expand_load(in, mask.lo, src.lo);
+            auto hi = expand_load(in + active_count<N / 2, T>(mask.lo), mask.hi, src.hi);
+            return join(lo, hi);
+        } else {
+            return emul::expand_load(in, mask, src);
+        }
+    }
+// !MARK
+
+} // namespace ui::wasm
+
+#endif // AMT_UI_ARCH_WASM_COMPRESS_HPP
@@ -22,6 +22,8 @@ namespace ui::wasm {
                     }
                 } else if constexpr (std::same_as<T, float16> || std::same_as<T, bfloat16>) {
                     return rcast<T>(load<N>(std::bit_cast<std::uint16_t>(val)));
+                } else if constexpr (::ui::internal::is_fp8<T>) {
+                    return rcast<T>(load<N>(std::bit_cast<std::uint8_t>(val)));
                 } else {
                     using utype = std::make_unsigned_t<T>;
                     if constexpr (sizeof(T) == 1) {
@@ -755,6 +757,105 @@ namespace ui::wasm {
             strided_load(data + N / 2 * 4, a.hi, b.hi, c.hi, d.hi);
         }
     }
+
+    namespace internal {
+        using emul::internal::interleave_lut;
+
+        // Output register `r` collects its bytes from every stream with one `swizzle` each;
+        // only the first `Bytes` bytes of the interleaved result are written.
+        template <std::size_t K, std::size_t Bytes, typename T, typename... Vs>
+        UI_ALWAYS_INLINE auto interleaved_store(T* UI_RESTRICT data, Vs const&... vs) noexcept -> void {
+            auto const& lut = interleave_lut<K, sizeof(T)>;
+            v128_t const streams[] = {
+                [&] {
+                    if constexpr (sizeof(vs) == 16) return wasm_v128_load(vs.data());
+                    else return wasm_v128_load64_zero(vs.data());
+                }()...
+            };
+            auto* out = reinterpret_cast<std::uint8_t*>(data);
+            for (auto r = 0u; r < Bytes / 16; ++r) {
+                auto res = wasm_i64x2_const(0, 0);
+                for (auto s = 0u; s < K; ++s) {
+                    res = wasm_v128_or(res, wasm_i8x16_swizzle(streams[s], wasm_v128_load(lut[r][s].data())));
+                }
+                wasm_v128_store(out + 16 * r, res);
+            }
+            if constexpr (Bytes % 16 != 0) {
+                static constexpr auto r = Bytes / 16;
+                auto res = wasm_i64x2_const(0, 0);
+                for (auto s = 0u; s < K; ++s) {
+                    res = wasm_v128_or(res, wasm_i8x16_swizzle(streams[s], wasm_v128_load(lut[r][s].data())));
+                }
+                wasm_v128_store64_lane(out + 16 * r, res, 0);
+            }
+        }
+    } // namespace internal
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<2, 2 * size>(data, a, b);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo);
+            strided_store(data + N / 2 * 2, a.hi, b.hi);
+        } else {
+            emul::strided_store(data, a, b);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<3, 3 * size>(data, a, b, c);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo, c.lo);
+            strided_store(data + N / 2 * 3, a.hi, b.hi, c.hi);
+        } else {
+            emul::strided_store(data, a, b, c);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c,
+        Vec<N, T> const& d
+    ) noexcept -> void {
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+            data[3] = d.val;
+        } else if constexpr (size == 8 || size == 16) {
+            internal::interleaved_store<4, 4 * size>(data, a, b, c, d);
+        } else if constexpr (size > 16) {
+            strided_store(data, a.lo, b.lo, c.lo, d.lo);
+            strided_store(data + N / 2 * 4, a.hi, b.hi, c.hi, d.hi);
+        } else {
+            emul::strided_store(data, a, b, c, d);
+        }
+    }
 } // namespace ui::wasm
 
 #undef SWAP_HI_LOW_32
@@ -4,6 +4,8 @@
 #include "cast.hpp"
 #include "../emul/mul.hpp"
 #include "add.hpp"
+#include "shift.hpp"
+#include "logical.hpp"
 #include "ui/base.hpp"
 
 namespace ui::wasm {
@@ -415,6 +417,82 @@ namespace ui::wasm {
         );
     }
 // !MARK
+
+// MARK: High-half Multiplication
+    using emul::mul_high;
+
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto mul_wide(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> std::pair<Vec<N, T> /*low*/, Vec<N, T> /*high*/> {
+        return { mul(lhs, rhs), mul_high(lhs, rhs) };
+    }
+// !MARK
+
+// MARK: Dot-Product Accumulate
+    /**
+     * @brief Adds the products of each pair of adjacent lanes to one accumulator lane;
+     * `acc[i] + lhs[2i] * rhs[2i] + lhs[2i + 1] * rhs[2i + 1]`.
+     */
+    template <std::size_t N, std::size_t M>
+        requires (M == 2 * N)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, float> const& acc,
+        Vec<M, bfloat16> const& lhs,
+        Vec<M, bfloat16> const& rhs
+    ) noexcept -> Vec<N, float> {
+        if constexpr (N == 1) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else {
+            // The even lanes are the low halves of the 32-bit lanes and the odd lanes the high
+            // halves, so both widen in place without a shuffle.
+            auto const mask = Vec<N, std::uint32_t>::load(0xffff'0000);
+            auto const l = std::bit_cast<Vec<N, std::uint32_t>>(lhs);
+            auto const r = std::bit_cast<Vec<N, std::uint32_t>>(rhs);
+            auto const even = [](auto const& v) { return std::bit_cast<Vec<N, float>>(shift_left<16>(v)); };
+            auto const odd = [&mask](auto const& v) { return std::bit_cast<Vec<N, float>>(bitwise_and(v, mask)); };
+            auto const res = fused_mul_acc(acc, even(l), even(r), op::add_t{});
+            return fused_mul_acc(res, odd(l), odd(r), op::add_t{});
+        }
+    }
+
+    /**
+     * @brief Adds the products of each group of four adjacent 8-bit lanes to one 32-bit
+     * accumulator lane; `acc[i] + lhs[4i] * rhs[4i] + ... + lhs[4i + 3] * rhs[4i + 3]`.
+     * The even and odd bytes are widened in place and multiplied with `i32x4.dot_i16x8_s`.
+     */
+    template <std::size_t N, std::size_t M, typename A, typename L, typename R>
+        requires (M == 4 * N && ::ui::internal::int8_dot<A, L, R>)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, A> const& acc,
+        Vec<M, L> const& lhs,
+        Vec<M, R> const& rhs
+    ) noexcept -> Vec<N, A> {
+        if constexpr (N < 4) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else if constexpr (N == 4) {
+            // Byte 0 and 2 of every 32-bit lane become the even 16-bit lanes, byte 1 and 3 the odd
+            // ones; each dot product then sums two of the four products.
+            auto const even = []<typename T>(Vec<M, T> const& v) {
+                if constexpr (std::is_signed_v<T>) return wasm_i16x8_shr(wasm_i16x8_shl(to_vec(v), 8), 8);
+                else return wasm_u16x8_shr(wasm_i16x8_shl(to_vec(v), 8), 8);
+            };
+            auto const odd = []<typename T>(Vec<M, T> const& v) {
+                if constexpr (std::is_signed_v<T>) return wasm_i16x8_shr(to_vec(v), 8);
+                else return wasm_u16x8_shr(to_vec(v), 8);
+            };
+            auto const e = wasm_i32x4_dot_i16x8(even(lhs), even(rhs));
+            auto const o = wasm_i32x4_dot_i16x8(odd(lhs), odd(rhs));
+            return from_vec<A>(wasm_i32x4_add(to_vec(acc), wasm_i32x4_add(e, o)));
+        } else {
+            return join(
+                dot_acc(acc.lo, lhs.lo, rhs.lo),
+                dot_acc(acc.hi, lhs.hi, rhs.hi)
+            );
+        }
+    }
+// !MARK
 } // namespace ui::wasm
 
 #endif // AMT_UI_ARCH_WASM_MUL_HPP
@@ -1,10 +1,41 @@
 #ifndef AMT_UI_ARCH_WASM_PERMUTE_HPP
 #define AMT_UI_ARCH_WASM_PERMUTE_HPP
 
+#include "cast.hpp"
 #include "../emul/permute.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 namespace ui::wasm {
     using emul::shuffle;
+
+    template <std::size_t M, std::size_t N, typename T>
+        requires (sizeof(T) == 1)
+    UI_ALWAYS_INLINE auto lookup(
+        Vec<M, T> const& table,
+        Vec<N, std::uint8_t> const& indices
+    ) noexcept -> Vec<N, T> {
+        if constexpr (M % 16 == 0 && M <= 64 && N == 16) {
+            // `swizzle` zeroes indices >= 16, so chunk `j` is indexed with `idx - 16 * j`; the
+            // wrapped-around indices of the other chunks are out of range as well.
+            auto const idx = std::bit_cast<v128_t>(indices);
+            auto res = wasm_i64x2_const(0, 0);
+            auto const helper = [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+                ((res = wasm_v128_or(res, wasm_i8x16_swizzle(
+                    wasm_v128_load(table.data() + 16 * Js),
+                    wasm_i8x16_sub(idx, wasm_u8x16_splat(static_cast<std::uint8_t>(16 * Js)))
+                ))),...);
+            };
+            helper(std::make_index_sequence<M / 16>{});
+            return std::bit_cast<Vec<N, T>>(res);
+        } else if constexpr (M % 16 == 0 && M <= 64 && N > 16) {
+            return join(lookup(table, indices.lo), lookup(table, indices.hi));
+        } else {
+            return emul::lookup(table, indices);
+        }
+    }
 } // namespace ui::wasm
 
-#endif // AMT_UI_ARCH_WASM_PERMUTE_HPP 
+#endif // AMT_UI_ARCH_WASM_PERMUTE_HPP
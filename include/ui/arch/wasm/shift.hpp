@@ -389,6 +389,67 @@ namespace ui::wasm {
     }
 // !MARK
 
+// MARK: Shift by a runtime count
+    template <bool Merge = true, std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_left(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        static constexpr auto bits = sizeof(v);
+        if constexpr (N == 1) {
+            return emul::shift_left(v, s);
+        } else {
+            if constexpr (bits == sizeof(v128_t)) {
+                auto m = to_vec(v);
+                if constexpr (sizeof(T) == 1) return from_vec<T>(wasm_i8x16_shl(m, s));
+                else if constexpr (sizeof(T) == 2) return from_vec<T>(wasm_i16x8_shl(m, s));
+                else if constexpr (sizeof(T) == 4) return from_vec<T>(wasm_i32x4_shl(m, s));
+                else if constexpr (sizeof(T) == 8) return from_vec<T>(wasm_i64x2_shl(m, s));
+            } else if constexpr (bits * 2 == sizeof(v128_t) && Merge) {
+                return shift_left(from_vec<T>(fit_to_vec(v)), s).lo;
+            }
+
+            return join(
+                shift_left<false>(v.lo, s),
+                shift_left<false>(v.hi, s)
+            );
+        }
+    }
+
+    template <bool Merge = true, std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_right(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        static constexpr auto bits = sizeof(v);
+        if constexpr (N == 1) {
+            return emul::shift_right(v, s);
+        } else {
+            if constexpr (bits == sizeof(v128_t)) {
+                auto m = to_vec(v);
+                if constexpr (std::is_signed_v<T>) {
+                    if constexpr (sizeof(T) == 1) return from_vec<T>(wasm_i8x16_shr(m, s));
+                    else if constexpr (sizeof(T) == 2) return from_vec<T>(wasm_i16x8_shr(m, s));
+                    else if constexpr (sizeof(T) == 4) return from_vec<T>(wasm_i32x4_shr(m, s));
+                    else if constexpr (sizeof(T) == 8) return from_vec<T>(wasm_i64x2_shr(m, s));
+                } else {
+                    if constexpr (sizeof(T) == 1) return from_vec<T>(wasm_u8x16_shr(m, s));
+                    else if constexpr (sizeof(T) == 2) return from_vec<T>(wasm_u16x8_shr(m, s));
+                    else if constexpr (sizeof(T) == 4) return from_vec<T>(wasm_u32x4_shr(m, s));
+                    else if constexpr (sizeof(T) == 8) return from_vec<T>(wasm_u64x2_shr(m, s));
+                }
+            } else if constexpr (bits * 2 == sizeof(v128_t) && Merge) {
+                return shift_right(from_vec<T>(fit_to_vec(v)), s).lo;
+            }
+
+            return join(
+                shift_right<false>(v.lo, s),
+                shift_right<false>(v.hi, s)
+            );
+        }
+    }
+// !MARK
+
 // MARK: Shift Lane
     template <unsigned Shift, std::size_t N, typename T>
         requires (Shift <= N)
@@ -76,6 +76,9 @@ namespace ui::x86 {
                      return std::bit_cast<__m512i>(v);
                      #endif
                  }
+             } else if constexpr (::ui::internal::is_fp8<T>) {
+                 // Only moved as bits; arithmetic goes through `cast`.
+                 return to_vec(std::bit_cast<Vec<N, std::uint8_t>>(v));
              } else {
                  static_assert(
                      sizeof(T) == sizeof(float)   ||
@@ -145,6 +148,8 @@ namespace ui::x86 {
                     return _mm512_castsi256_si512(to_vec(v));
                     #endif
                 }
+             } else if constexpr (::ui::internal::is_fp8<T>) {
+                return fit_to_vec(std::bit_cast<Vec<N, std::uint8_t>>(v));
              } else {
                  static_assert(
                      sizeof(T) == sizeof(float)   ||
@@ -185,7 +190,7 @@ namespace ui::x86 {
     #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE2
     template <typename T, std::size_t N = sizeof(__m128i) / sizeof(T)>
     UI_ALWAYS_INLINE constexpr auto from_vec(__m128i v) noexcept -> Vec<N, T> {
-        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16>, "cannot convvert to unreleated types");
+        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16> || ::ui::internal::is_fp8<T>, "cannot convvert to unreleated types");
         return std::bit_cast<Vec<N, T>>(v); 
     }
     #endif
@@ -193,7 +198,7 @@ namespace ui::x86 {
     #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
     template <typename T, std::size_t N = sizeof(__m256i) / sizeof(T)>
     UI_ALWAYS_INLINE constexpr auto from_vec(__m256i v) noexcept -> Vec<N, T> {
-        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16>, "cannot convvert to unreleated types");
+        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16> || ::ui::internal::is_fp8<T>, "cannot convvert to unreleated types");
         return std::bit_cast<Vec<N, T>>(v); 
     }
     #endif
@@ -201,7 +206,7 @@ namespace ui::x86 {
     #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
     template <typename T, std::size_t N = sizeof(__m512i) / sizeof(T)>
     UI_ALWAYS_INLINE constexpr auto from_vec(__m512i v) noexcept -> Vec<N, T> {
-        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16>, "cannot convvert to unreleated types");
+        static_assert(std::integral<T> || std::same_as<T, float16> || std::same_as<T, bfloat16> || ::ui::internal::is_fp8<T>, "cannot convvert to unreleated types");
         return std::bit_cast<Vec<N, T>>(v); 
     }
     #endif
@@ -280,8 +285,11 @@ namespace ui::x86 {
             } else {
                 if constexpr (is_case_invocable<N, M, decltype(v)>) {
                     auto temp = m.template match<N>(v);
-                    if constexpr (::ui::internal::is_vec<decltype(temp)>) return temp;
-                    else return from_vec<To>(temp);
+                    if constexpr (::ui::internal::is_vec<decltype(temp)>) {
+                        // Half-width chunks are converted duplicated into a full register.
+                        if constexpr (decltype(temp)::elements == 2 * N) return temp.lo;
+                        else return temp;
+                    } else return from_vec<To>(temp);
                 } else {
                     return join(cast_iter_chunk<To, Saturating>(v.lo, m), cast_iter_chunk<To, Saturating>(v.hi, m));
                 }
@@ -954,6 +962,89 @@ namespace ui::x86 {
             }
         }
 
+        // F16C converts 4, 8 (or 16 with AVX512F) lanes per instruction; without it the conversion
+        // is done with integer bit manipulation.
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto float32_to_float16(
+            Vec<N, float> const& v
+        ) noexcept -> Vec<N, float16> {
+            #ifdef UI_HAS_F16C
+            static constexpr auto rounding = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+            constexpr auto fn = [](auto const& v_) {
+                if constexpr (sizeof(v_) == sizeof(__m128)) {
+                    return std::bit_cast<Vec<8, float16>>(_mm_cvtps_ph(to_vec(v_), rounding));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                if constexpr (sizeof(v_) == sizeof(__m256)) {
+                    return std::bit_cast<Vec<8, float16>>(_mm256_cvtps_ph(to_vec(v_), rounding));
+                }
+                #endif
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                if constexpr (sizeof(v_) == sizeof(__m512)) {
+                    return std::bit_cast<Vec<16, float16>>(_mm512_cvtps_ph(to_vec(v_), rounding));
+                }
+                #endif
+            };
+            return cast_iter_chunk<float16, false>(
+                v,
+                Matcher {
+                    case_maker<2> = [fn](auto const& v_) {
+                        return fn(join(v_, v_)).lo;
+                    },
+                    case_maker<4> = fn
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                    , case_maker<8> = fn
+                    #endif
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                    , case_maker<16> = fn
+                    #endif
+                }
+            );
+            #else
+            return cast_float32_to_float16(v);
+            #endif
+        }
+
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto float16_to_float32(
+            Vec<N, float16> const& v
+        ) noexcept -> Vec<N, float> {
+            #ifdef UI_HAS_F16C
+            constexpr auto fn = [](auto const& v_) {
+                if constexpr (sizeof(v_) == sizeof(std::uint64_t)) {
+                    return std::bit_cast<Vec<4, float>>(_mm_cvtph_ps(fit_to_vec(v_)));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                if constexpr (sizeof(v_) == sizeof(__m128i)) {
+                    return std::bit_cast<Vec<8, float>>(_mm256_cvtph_ps(to_vec(v_)));
+                }
+                #endif
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                if constexpr (sizeof(v_) == sizeof(__m256i)) {
+                    return std::bit_cast<Vec<16, float>>(_mm512_cvtph_ps(to_vec(v_)));
+                }
+                #endif
+            };
+            return cast_iter_chunk<float, false>(
+                v,
+                Matcher {
+                    case_maker<2> = [fn](auto const& v_) {
+                        return fn(join(v_, v_));
+                    },
+                    case_maker<4> = fn
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                    , case_maker<8> = fn
+                    #endif
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                    , case_maker<16> = fn
+                    #endif
+                }
+            );
+            #else
+            return cast_float16_to_float32(v);
+            #endif
+        }
+
         template <typename To, bool Saturating = false, bool ClampFp = true>
         struct CastImpl {
             template <std::size_t N>
@@ -962,7 +1053,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1042,7 +1133,7 @@ namespace ui::x86 {
                                 case_maker<16> = [](auto const& v_) {
                                     return cast_helper<To>(v_, [](__m128i m) {
                                         #if UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_AVX
-                                        return _mm_cvtepi8_epi32(m);
+                                        return _mm_cvtepi8_epi16(m);
                                         #elif UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_SKX
                                         return _mm256_cvtepi8_epi16(m);
                                         #endif
@@ -1131,7 +1222,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1166,7 +1257,7 @@ namespace ui::x86 {
                                 case_maker<16> = [](auto const& v_) {
                                     return cast_helper<To>(v_, [](__m128i m) {
                                         #if UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_AVX
-                                        return _mm_cvtepu8_epi32(m);
+                                        return _mm_cvtepu8_epi16(m);
                                         #elif UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_SKX
                                         return _mm256_cvtepu8_epi16(m);
                                         #endif
@@ -1247,7 +1338,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1415,7 +1506,7 @@ namespace ui::x86 {
             ) noexcept -> Vec<N, To> {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1552,7 +1643,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1756,7 +1847,7 @@ namespace ui::x86 {
             ) noexcept -> Vec<N, To> {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -1956,7 +2047,7 @@ namespace ui::x86 {
                             }
                             #endif
 
-                            #if UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_SKX
+                            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
                             if constexpr (sizeof(To) == sizeof(__m512)) {
                                 return _mm512_cvtepu32_epi64(m);
                             }
@@ -1987,7 +2078,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -2082,7 +2173,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
-                   return cast_float32_to_float16(temp);
+                   return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                    auto temp = CastImpl<float, Saturating>{}(v);
                    return cast_float32_to_bfloat16(temp);
@@ -2176,7 +2267,7 @@ namespace ui::x86 {
                 Vec<N, float> const& v
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
-                    return cast_float32_to_float16(v);
+                    return float32_to_float16(v);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                     return cast_float32_to_bfloat16(v);
                 } else if constexpr (std::same_as<To, float>) {
@@ -2188,8 +2279,8 @@ namespace ui::x86 {
                             auto t0 = join(v_.lo, v_.lo);
                             auto t1 = join(v_.hi, v_.hi);
                             return join(
-                                from_vec<To>(_mm_cvtps_pd(to_vec(t0))).lo,
-                                from_vec<To>(_mm_cvtps_pd(to_vec(t1))).lo
+                                from_vec<To>(_mm_cvtps_pd(to_vec(t0))),
+                                from_vec<To>(_mm_cvtps_pd(to_vec(t1)))
                             );
                         }
                         #else
@@ -2271,7 +2362,7 @@ namespace ui::x86 {
             ) noexcept {
                 if constexpr (std::same_as<To, float16>) {
                     auto temp = CastImpl<float>{}(v);
-                    return cast_float32_to_float16(temp);
+                    return float32_to_float16(temp);
                 } else if constexpr (std::same_as<To, bfloat16>) {
                     auto temp = CastImpl<float>{}(v);
                     return cast_float32_to_bfloat16(temp);
@@ -2280,12 +2371,11 @@ namespace ui::x86 {
                 } else if constexpr (std::same_as<To, float>) {
                     constexpr auto fn = [](auto const& v_) {
                         auto m = to_vec(v_);
-                        #if UI_CPU_SSE_LEVEL < UI_CPU_SSE_LEVEL_AVX
                         if constexpr (sizeof(v_) == sizeof(__m128)) {
                             return from_vec<To>(_mm_cvtpd_ps(m)).lo;
                         }
-                        #else
-                        if constexpr (sizeof(v_) == sizeof(__m128)) {
+                        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                        if constexpr (sizeof(v_) == sizeof(__m256)) {
                             return from_vec<To>(_mm256_cvtpd_ps(m));
                         }
                         #endif
@@ -2302,9 +2392,11 @@ namespace ui::x86 {
                                 return Vec<1, To>{ .val = static_cast<To>(v_.val) };
                             },
                             case_maker<2> = fn
-                            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
                             , case_maker<4> = fn
-                            , case_maker8> = fn
+                            #endif
+                            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                            , case_maker<8> = fn
                             #endif
                         }
                      );
@@ -2407,7 +2499,7 @@ namespace ui::x86 {
                 if constexpr (std::same_as<To, float16>) {
                     return v;
                 } else if constexpr (std::same_as<To, float>) {
-                    return cast_float16_to_float32(v);
+                    return float16_to_float32(v);
                 } else {
                     auto temp = CastImpl<float>{}(v);
                     return CastImpl<To>{}(temp);
@@ -2432,7 +2524,11 @@ namespace ui::x86 {
 
     template <typename To, std::size_t N, typename From>
     UI_ALWAYS_INLINE auto cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
-        return internal::CastImpl<To, false>{}(v);
+        if constexpr (::ui::internal::is_fp8<To> || ::ui::internal::is_fp8<From>) {
+            return ::ui::internal::cast_float8<To, false>(v);
+        } else {
+            return internal::CastImpl<To, false>{}(v);
+        }
     }
 
     template <typename To, std::size_t N, std::integral From>
@@ -2440,6 +2536,12 @@ namespace ui::x86 {
         return internal::CastImpl<To, true>{}(v);
     }
 
+    template <typename To, std::size_t N, std::floating_point From>
+        requires ::ui::internal::is_fp8<To>
+    UI_ALWAYS_INLINE auto sat_cast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
+        return ::ui::internal::cast_float8<To, true>(v);
+    }
+
     // retinterpret cast
     template <typename To, std::size_t N, typename From>
     UI_ALWAYS_INLINE constexpr auto rcast(Vec<N, From> const& v) noexcept -> Vec<N, To> {
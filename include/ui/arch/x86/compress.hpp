@@ -0,0 +1,322 @@
+#ifndef AMT_UI_ARCH_X86_COMPRESS_HPP
+#define AMT_UI_ARCH_X86_COMPRESS_HPP
+
+#include "cast.hpp"
+#include "bit.hpp"
+#include "masked.hpp"
+#include "../emul/compress.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ui::x86 {
+
+    namespace internal {
+        using namespace ::ui::internal;
+        using emul::internal::compress_lut;
+        using emul::internal::expand_lut;
+        using emul::internal::compress_merge_lut;
+
+        UI_ALWAYS_INLINE auto load_lut(std::uint8_t const* p) noexcept -> __m128i {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        }
+
+        UI_ALWAYS_INLINE auto load_lut_half(std::uint8_t const* p) noexcept -> __m128i {
+            return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(p));
+        }
+
+        template <std::size_t N, typename T>
+        static constexpr bool has_native_compress = [] {
+            [[maybe_unused]] constexpr auto size = N * sizeof(T);
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (sizeof(T) >= 4 && (size == 16 || size == 32 || size == 64)) return true;
+            #endif
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2 && defined(__BMI2__)
+            if constexpr (sizeof(T) >= 4 && size == 32) return true;
+            #endif
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSSE3
+            return size == 16;
+            #else
+            return false;
+            #endif
+        }();
+
+        // One bit per lane, lane 0 in the lowest bit.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto lane_bits(mask_t<N, T> const& m) noexcept -> unsigned {
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (size == 16) {
+                auto v = std::bit_cast<__m128i>(m);
+                if constexpr (sizeof(T) == 1) return static_cast<unsigned>(_mm_movemask_epi8(v));
+                else if constexpr (sizeof(T) == 2) return static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(v, _mm_setzero_si128())));
+                else if constexpr (sizeof(T) == 4) return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(v)));
+                else return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(v)));
+            } else {
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+                if constexpr (size == 32 && sizeof(T) >= 4) {
+                    auto v = std::bit_cast<__m256i>(m);
+                    if constexpr (sizeof(T) == 4) return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+                    else return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+                }
+                #endif
+                auto res = 0u;
+                for (auto i = 0u; i < N; ++i) res |= static_cast<unsigned>(m[i] != 0) << i;
+                return res;
+            }
+        }
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto active_count(mask_t<N, T> const& mask) noexcept -> std::size_t {
+            if constexpr (N * sizeof(T) == 16 || N * sizeof(T) == 32) {
+                return static_cast<std::size_t>(std::popcount(lane_bits<N, T>(mask)));
+            } else if constexpr (N > 1 && N * sizeof(T) > 32) {
+                return active_count<N / 2, T>(mask.lo) + active_count<N / 2, T>(mask.hi);
+            } else {
+                return emul::internal::active_count<N, T>(mask);
+            }
+        }
+
+        template <typename T>
+        UI_ALWAYS_INLINE auto compress_bytes(__m128i v, unsigned bits) noexcept -> __m128i {
+            if constexpr (sizeof(T) == 1) {
+                // 2^16 entries would not fit in cache, so each half is compressed on its own
+                // and the gap between the halves is closed by a second shuffle.
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto idx = _mm_unpacklo_epi64(
+                    load_lut_half(compress_lut<8, 1>[lo].data()),
+                    _mm_add_epi8(load_lut_half(compress_lut<8, 1>[hi].data()), _mm_set1_epi8(8))
+                );
+                auto t = _mm_shuffle_epi8(v, idx);
+                return _mm_shuffle_epi8(t, load_lut(compress_merge_lut[std::popcount(lo)].data()));
+            } else {
+                return _mm_shuffle_epi8(v, load_lut(compress_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+
+        // Inactive lanes are garbage; callers blend them with the source.
+        template <typename T>
+        UI_ALWAYS_INLINE auto expand_bytes(__m128i v, unsigned bits) noexcept -> __m128i {
+            if constexpr (sizeof(T) == 1) {
+                auto lo = bits & 0xff;
+                auto hi = bits >> 8;
+                auto offset = static_cast<char>(std::popcount(lo));
+                auto idx = _mm_unpacklo_epi64(
+                    load_lut_half(expand_lut<8, 1>[lo].data()),
+                    _mm_add_epi8(load_lut_half(expand_lut<8, 1>[hi].data()), _mm_set1_epi8(offset))
+                );
+                return _mm_shuffle_epi8(v, idx);
+            } else {
+                return _mm_shuffle_epi8(v, load_lut(expand_lut<16 / sizeof(T), sizeof(T)>[bits].data()));
+            }
+        }
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2 && defined(__BMI2__)
+        // Permutation indices for `vpermd`: `pext` packs the identity indices of the active
+        // lanes (compress) and `pdep` spreads them over the active lanes (expand).
+        UI_ALWAYS_INLINE auto permute_indices(unsigned bits, bool is_compress) noexcept -> __m256i {
+            static constexpr std::uint64_t identity = 0x0706'0504'0302'0100;
+            auto const lanes = _pdep_u64(bits, 0x0101'0101'0101'0101) * 0xff;
+            auto const idx = is_compress ? _pext_u64(identity, lanes) : _pdep_u64(identity, lanes);
+            return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(idx)));
+        }
+
+        // Bit mask over the eight 32-bit halves; a 64-bit lane covers two of them.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto dword_bits(mask_t<N, T> const& m) noexcept -> unsigned {
+            return static_cast<unsigned>(_mm256_movemask_ps(std::bit_cast<__m256>(m)));
+        }
+        #endif
+    } // namespace internal
+
+// MARK: Compress
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        using ret_t = Vec<N, T>;
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (has_native_compress<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (sizeof(T) >= 4) {
+                auto k = to_mem_kmask<N, T>(mask);
+                if constexpr (size == 16) {
+                    auto a = std::bit_cast<__m128i>(v);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm_maskz_compress_epi32(k, a));
+                    else return std::bit_cast<ret_t>(_mm_maskz_compress_epi64(k, a));
+                } else if constexpr (size == 32) {
+                    auto a = std::bit_cast<__m256i>(v);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm256_maskz_compress_epi32(k, a));
+                    else return std::bit_cast<ret_t>(_mm256_maskz_compress_epi64(k, a));
+                } else {
+                    auto a = std::bit_cast<__m512i>(v);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm512_maskz_compress_epi32(k, a));
+                    else return std::bit_cast<ret_t>(_mm512_maskz_compress_epi64(k, a));
+                }
+            } else
+            #endif
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2 && defined(__BMI2__)
+            if constexpr (size == 32) {
+                auto bits = dword_bits<N, T>(mask);
+                auto res = _mm256_permutevar8x32_epi32(std::bit_cast<__m256i>(v), permute_indices(bits, true));
+                auto tail = tail_mask<8, std::uint32_t>(static_cast<std::size_t>(std::popcount(bits)));
+                return std::bit_cast<ret_t>(_mm256_and_si256(res, std::bit_cast<__m256i>(tail)));
+            } else
+            #endif
+            if constexpr (size == 16) {
+                return std::bit_cast<ret_t>(compress_bytes<T>(std::bit_cast<__m128i>(v), lane_bits<N, T>(mask)));
+            }
+        } else if constexpr (N > 1 && size > 16) {
+            auto res = Vec<N, T>{};
+            auto lo = compress(v.lo, mask.lo);
+            auto hi = compress(v.hi, mask.hi);
+            auto n = active_count<N / 2, T>(mask.lo);
+            std::memcpy(res.data(), lo.data(), sizeof(lo));
+            std::memcpy(res.data() + n, hi.data(), sizeof(hi));
+            return res;
+        } else {
+            return emul::compress(v, mask);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto compress_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> std::size_t {
+        using namespace internal;
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (has_native_compress<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (sizeof(T) >= 4) {
+                auto k = to_mem_kmask<N, T>(mask);
+                if constexpr (size == 16) {
+                    auto a = std::bit_cast<__m128i>(v);
+                    if constexpr (sizeof(T) == 4) _mm_mask_compressstoreu_epi32(out, k, a);
+                    else _mm_mask_compressstoreu_epi64(out, k, a);
+                } else if constexpr (size == 32) {
+                    auto a = std::bit_cast<__m256i>(v);
+                    if constexpr (sizeof(T) == 4) _mm256_mask_compressstoreu_epi32(out, k, a);
+                    else _mm256_mask_compressstoreu_epi64(out, k, a);
+                } else {
+                    auto a = std::bit_cast<__m512i>(v);
+                    if constexpr (sizeof(T) == 4) _mm512_mask_compressstoreu_epi32(out, k, a);
+                    else _mm512_mask_compressstoreu_epi64(out, k, a);
+                }
+                return static_cast<std::size_t>(std::popcount(static_cast<unsigned>(k)));
+            } else
+            #endif
+            {
+                auto n = active_count<N, T>(mask);
+                masked_store(out, compress(v, mask), n);
+                return n;
+            }
+        } else if constexpr (N > 1 && size > 16) {
+            auto n = compress_store(out, v.lo, mask.lo);
+            return n + compress_store(out + n, v.hi, mask.hi);
+        } else {
+            return emul::compress_store(out, v, mask);
+        }
+    }
+// !MARK
+
+// MARK: Expand
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand(
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        using ret_t = Vec<N, T>;
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (has_native_compress<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (sizeof(T) >= 4) {
+                auto k = to_mem_kmask<N, T>(mask);
+                if constexpr (size == 16) {
+                    auto a = std::bit_cast<__m128i>(v);
+                    auto s = std::bit_cast<__m128i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm_mask_expand_epi32(s, k, a));
+                    else return std::bit_cast<ret_t>(_mm_mask_expand_epi64(s, k, a));
+                } else if constexpr (size == 32) {
+                    auto a = std::bit_cast<__m256i>(v);
+                    auto s = std::bit_cast<__m256i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm256_mask_expand_epi32(s, k, a));
+                    else return std::bit_cast<ret_t>(_mm256_mask_expand_epi64(s, k, a));
+                } else {
+                    auto a = std::bit_cast<__m512i>(v);
+                    auto s = std::bit_cast<__m512i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm512_mask_expand_epi32(s, k, a));
+                    else return std::bit_cast<ret_t>(_mm512_mask_expand_epi64(s, k, a));
+                }
+            } else
+            #endif
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2 && defined(__BMI2__)
+            if constexpr (size == 32) {
+                auto res = _mm256_permutevar8x32_epi32(std::bit_cast<__m256i>(v), permute_indices(dword_bits<N, T>(mask), false));
+                return bitwise_select(mask, std::bit_cast<ret_t>(res), src);
+            } else
+            #endif
+            if constexpr (size == 16) {
+                auto res = expand_bytes<T>(std::bit_cast<__m128i>(v), lane_bits<N, T>(mask));
+                return bitwise_select(mask, std::bit_cast<ret_t>(res), src);
+            }
+        } else if constexpr (N > 1 && size > 16) {
+            static constexpr auto half = N / 2;
+            auto n = active_count<N / 2, T>(mask.lo);
+            auto rest = Vec<half, T>::load(v.data() + n, half);
+            return join(expand(v.lo, mask.lo, src.lo), expand(rest, mask.hi, src.hi));
+        } else {
+            return emul::expand(v, mask, src);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto expand_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        static constexpr auto size = N * sizeof(T);
+        if constexpr (has_native_compress<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (sizeof(T) >= 4) {
+                using ret_t = Vec<N, T>;
+                auto k = to_mem_kmask<N, T>(mask);
+                if constexpr (size == 16) {
+                    auto s = std::bit_cast<__m128i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm_mask_expandloadu_epi32(s, k, in));
+                    else return std::bit_cast<ret_t>(_mm_mask_expandloadu_epi64(s, k, in));
+                } else if constexpr (size == 32) {
+                    auto s = std::bit_cast<__m256i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm256_mask_expandloadu_epi32(s, k, in));
+                    else return std::bit_cast<ret_t>(_mm256_mask_expandloadu_epi64(s, k, in));
+                } else {
+                    auto s = std::bit_cast<__m512i>(src);
+                    if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm512_mask_expandloadu_epi32(s, k, in));
+                    else return std::bit_cast<ret_t>(_mm512_mask_expandloadu_epi64(s, k, in));
+                }
+            } else
+            #endif
+            {
+                return expand(masked_load<N>(in, active_count<N, T>(mask)), mask, src);
+            }
+        } else if constexpr (N > 1 && size > 16) {
+            auto lo = expand_load(in, mask.lo, src.lo);
+            auto hi = expand_load(in + active_count<N / 2, T>(mask.lo), mask.hi, src.hi);
+            return join(lo, hi);
+        } else {
+            return emul::expand_load(in, mask, src);
+        }
+    }
+// !MARK
+
+} // namespace ui::x86
+
+#endif // AMT_UI_ARCH_X86_COMPRESS_HPP
@@ -0,0 +1,434 @@
+#ifndef AMT_UI_ARCH_X86_GATHER_HPP
+#define AMT_UI_ARCH_X86_GATHER_HPP
+
+#include "cast.hpp"
+#include "../emul/gather.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+namespace ui::x86 {
+
+    namespace internal {
+        using namespace ::ui::internal;
+
+        // Hardware gathers/scatters only exist for 32/64-bit lanes addressed by 32/64-bit indices.
+        // 32-bit indices are sign-extended by the hardware, so they must stay below 2^31.
+        template <typename T, typename I>
+        static constexpr bool has_native_gather = (sizeof(T) == 4 || sizeof(T) == 8)
+            && (sizeof(I) == 4 || sizeof(I) == 8)
+            && !is_fp16<T>;
+
+        template <std::size_t N, typename I>
+        UI_ALWAYS_INLINE auto to_index_vec(Vec<N, I> const& v) noexcept {
+            if constexpr (N * sizeof(I) == 8) {
+                return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(v.data()));
+            } else {
+                return to_vec(v);
+            }
+        }
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto to_kmask(mask_t<N, T> const& m) noexcept {
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (sizeof(T) == 4) {
+                if constexpr (size == sizeof(__m128)) return _mm_movepi32_mask(to_vec(m));
+                else if constexpr (size == sizeof(__m256)) return _mm256_movepi32_mask(to_vec(m));
+                else return _mm512_movepi32_mask(to_vec(m));
+            } else {
+                if constexpr (size == sizeof(__m128)) return _mm_movepi64_mask(to_vec(m));
+                else if constexpr (size == sizeof(__m256)) return _mm256_movepi64_mask(to_vec(m));
+                else return _mm512_movepi64_mask(to_vec(m));
+            }
+        }
+        #endif
+    } // namespace internal
+
+// MARK: Gather
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE auto gather(
+        T const* UI_RESTRICT base,
+        Vec<N, I> const& indices
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        if constexpr (has_native_gather<T, I>) {
+            using ret_t = Vec<N, T>;
+            auto const* i32_ptr = reinterpret_cast<int const*>(base);
+            auto const* i64_ptr = reinterpret_cast<long long const*>(base);
+
+            if constexpr (sizeof(I) == 4 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<ret_t>(_mm_i32gather_ps(base, idx, 4));
+                    else return std::bit_cast<ret_t>(_mm_i32gather_epi32(i32_ptr, idx, 4));
+                } else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<ret_t>(_mm256_i32gather_ps(base, idx, 4));
+                    else return std::bit_cast<ret_t>(_mm256_i32gather_epi32(i32_ptr, idx, 4));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 16) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<ret_t>(_mm512_i32gather_ps(idx, base, 4));
+                    else return std::bit_cast<ret_t>(_mm512_i32gather_epi32(idx, i32_ptr, 4));
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 4 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    auto idx = to_index_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm_i32gather_pd(base, idx, 8));
+                    else return std::bit_cast<ret_t>(_mm_i32gather_epi64(i64_ptr, idx, 8));
+                } else if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm256_i32gather_pd(base, idx, 8));
+                    else return std::bit_cast<ret_t>(_mm256_i32gather_epi64(i64_ptr, idx, 8));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm512_i32gather_pd(idx, base, 8));
+                    else return std::bit_cast<ret_t>(_mm512_i32gather_epi64(idx, i64_ptr, 8));
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm_i64gather_pd(base, idx, 8));
+                    else return std::bit_cast<ret_t>(_mm_i64gather_epi64(i64_ptr, idx, 8));
+                } else if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm256_i64gather_pd(base, idx, 8));
+                    else return std::bit_cast<ret_t>(_mm256_i64gather_epi64(i64_ptr, idx, 8));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, double>) return std::bit_cast<ret_t>(_mm512_i64gather_pd(idx, base, 8));
+                    else return std::bit_cast<ret_t>(_mm512_i64gather_epi64(idx, i64_ptr, 8));
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 4) {
+                // 64-bit indices produce half a register of 32-bit lanes.
+                if constexpr (N == 2) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<Vec<4, T>>(_mm_i64gather_ps(base, idx, 4)).lo;
+                    else return std::bit_cast<Vec<4, T>>(_mm_i64gather_epi32(i32_ptr, idx, 4)).lo;
+                } else if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<ret_t>(_mm256_i64gather_ps(base, idx, 4));
+                    else return std::bit_cast<ret_t>(_mm256_i64gather_epi32(i32_ptr, idx, 4));
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    if constexpr (std::same_as<T, float>) return std::bit_cast<ret_t>(_mm512_i64gather_ps(idx, base, 4));
+                    else return std::bit_cast<ret_t>(_mm512_i64gather_epi32(idx, i32_ptr, 4));
+                }
+                #endif
+            }
+
+            if constexpr (N > 1 && N * std::max(sizeof(T), sizeof(I)) > UI_NATIVE_SIZE) {
+                return join(gather(base, indices.lo), gather(base, indices.hi));
+            }
+        }
+        #endif
+        return emul::gather(base, indices);
+    }
+
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE auto gather(
+        T const* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        if constexpr (has_native_gather<T, I>) {
+            using ret_t = Vec<N, T>;
+            auto const* i32_ptr = reinterpret_cast<int const*>(base);
+            auto const* i64_ptr = reinterpret_cast<long long const*>(base);
+
+            if constexpr (sizeof(I) == 4 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, float>) {
+                        return std::bit_cast<ret_t>(_mm_mask_i32gather_ps(to_vec(src), base, idx, _mm_castsi128_ps(m), 4));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm_mask_i32gather_epi32(to_vec(src), i32_ptr, idx, m, 4));
+                    }
+                } else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, float>) {
+                        return std::bit_cast<ret_t>(_mm256_mask_i32gather_ps(to_vec(src), base, idx, _mm256_castsi256_ps(m), 4));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm256_mask_i32gather_epi32(to_vec(src), i32_ptr, idx, m, 4));
+                    }
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 16) {
+                    auto idx = to_vec(indices);
+                    auto k = to_kmask<N, T>(mask);
+                    if constexpr (std::same_as<T, float>) {
+                        return std::bit_cast<ret_t>(_mm512_mask_i32gather_ps(std::bit_cast<__m512>(src), k, idx, base, 4));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm512_mask_i32gather_epi32(to_vec(src), k, idx, i32_ptr, 4));
+                    }
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 4 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    auto idx = to_index_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm_mask_i32gather_pd(to_vec(src), base, idx, _mm_castsi128_pd(m), 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm_mask_i32gather_epi64(to_vec(src), i64_ptr, idx, m, 8));
+                    }
+                } else if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm256_mask_i32gather_pd(to_vec(src), base, idx, _mm256_castsi256_pd(m), 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm256_mask_i32gather_epi64(to_vec(src), i64_ptr, idx, m, 8));
+                    }
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    auto k = to_kmask<N, T>(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm512_mask_i32gather_pd(std::bit_cast<__m512d>(src), k, idx, base, 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm512_mask_i32gather_epi64(to_vec(src), k, idx, i64_ptr, 8));
+                    }
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm_mask_i64gather_pd(to_vec(src), base, idx, _mm_castsi128_pd(m), 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm_mask_i64gather_epi64(to_vec(src), i64_ptr, idx, m, 8));
+                    }
+                } else if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm256_mask_i64gather_pd(to_vec(src), base, idx, _mm256_castsi256_pd(m), 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm256_mask_i64gather_epi64(to_vec(src), i64_ptr, idx, m, 8));
+                    }
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    auto k = to_kmask<N, T>(mask);
+                    if constexpr (std::same_as<T, double>) {
+                        return std::bit_cast<ret_t>(_mm512_mask_i64gather_pd(std::bit_cast<__m512d>(src), k, idx, base, 8));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm512_mask_i64gather_epi64(to_vec(src), k, idx, i64_ptr, 8));
+                    }
+                }
+                #endif
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    auto idx = to_vec(indices);
+                    auto m = to_vec(mask);
+                    if constexpr (std::same_as<T, float>) {
+                        return std::bit_cast<ret_t>(_mm256_mask_i64gather_ps(to_vec(src), base, idx, _mm_castsi128_ps(m), 4));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm256_mask_i64gather_epi32(to_vec(src), i32_ptr, idx, m, 4));
+                    }
+                }
+                #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                else if constexpr (N == 8) {
+                    auto idx = to_vec(indices);
+                    auto k = to_kmask<N, T>(mask);
+                    if constexpr (std::same_as<T, float>) {
+                        return std::bit_cast<ret_t>(_mm512_mask_i64gather_ps(std::bit_cast<__m256>(src), k, idx, base, 4));
+                    } else {
+                        return std::bit_cast<ret_t>(_mm512_mask_i64gather_epi32(to_vec(src), k, idx, i32_ptr, 4));
+                    }
+                }
+                #endif
+            }
+
+            if constexpr (N > 1 && N * std::max(sizeof(T), sizeof(I)) > UI_NATIVE_SIZE) {
+                return join(
+                    gather(base, indices.lo, mask.lo, src.lo),
+                    gather(base, indices.hi, mask.hi, src.hi)
+                );
+            }
+        }
+        #endif
+        return emul::gather(base, indices, mask, src);
+    }
+// !MARK
+
+// MARK: Scatter
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE auto scatter(
+        T* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        Vec<N, T> const& v
+    ) noexcept -> void {
+        using namespace internal;
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+        if constexpr (has_native_gather<T, I>) {
+            auto* i32_ptr = reinterpret_cast<int*>(base);
+            auto* i64_ptr = reinterpret_cast<long long*>(base);
+
+            if constexpr (sizeof(I) == 4 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, float>) _mm_i32scatter_ps(base, to_vec(indices), to_vec(v), 4);
+                    else _mm_i32scatter_epi32(i32_ptr, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, float>) _mm256_i32scatter_ps(base, to_vec(indices), to_vec(v), 4);
+                    else _mm256_i32scatter_epi32(i32_ptr, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 16) {
+                    if constexpr (std::same_as<T, float>) _mm512_i32scatter_ps(base, to_vec(indices), std::bit_cast<__m512>(v), 4);
+                    else _mm512_i32scatter_epi32(i32_ptr, to_vec(indices), to_vec(v), 4);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 4 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    if constexpr (std::same_as<T, double>) _mm_i32scatter_pd(base, to_index_vec(indices), to_vec(v), 8);
+                    else _mm_i32scatter_epi64(i64_ptr, to_index_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, double>) _mm256_i32scatter_pd(base, to_vec(indices), to_vec(v), 8);
+                    else _mm256_i32scatter_epi64(i64_ptr, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, double>) _mm512_i32scatter_pd(base, to_vec(indices), std::bit_cast<__m512d>(v), 8);
+                    else _mm512_i32scatter_epi64(i64_ptr, to_vec(indices), to_vec(v), 8);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    if constexpr (std::same_as<T, double>) _mm_i64scatter_pd(base, to_vec(indices), to_vec(v), 8);
+                    else _mm_i64scatter_epi64(i64_ptr, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, double>) _mm256_i64scatter_pd(base, to_vec(indices), to_vec(v), 8);
+                    else _mm256_i64scatter_epi64(i64_ptr, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, double>) _mm512_i64scatter_pd(base, to_vec(indices), std::bit_cast<__m512d>(v), 8);
+                    else _mm512_i64scatter_epi64(i64_ptr, to_vec(indices), to_vec(v), 8);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, float>) _mm256_i64scatter_ps(base, to_vec(indices), to_vec(v), 4);
+                    else _mm256_i64scatter_epi32(i32_ptr, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, float>) _mm512_i64scatter_ps(base, to_vec(indices), std::bit_cast<__m256>(v), 4);
+                    else _mm512_i64scatter_epi32(i32_ptr, to_vec(indices), to_vec(v), 4);
+                    return;
+                }
+            }
+
+            if constexpr (N > 1 && N * std::max(sizeof(T), sizeof(I)) > UI_NATIVE_SIZE) {
+                scatter(base, indices.lo, v.lo);
+                scatter(base, indices.hi, v.hi);
+                return;
+            }
+        }
+        #endif
+        emul::scatter(base, indices, v);
+    }
+
+    template <std::size_t N, typename T, std::integral I>
+    UI_ALWAYS_INLINE auto scatter(
+        T* UI_RESTRICT base,
+        Vec<N, I> const& indices,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> void {
+        using namespace internal;
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+        if constexpr (has_native_gather<T, I> && N * sizeof(T) >= sizeof(__m128)) {
+            auto* i32_ptr = reinterpret_cast<int*>(base);
+            auto* i64_ptr = reinterpret_cast<long long*>(base);
+            auto k = to_kmask<N, T>(mask);
+
+            if constexpr (sizeof(I) == 4 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, float>) _mm_mask_i32scatter_ps(base, k, to_vec(indices), to_vec(v), 4);
+                    else _mm_mask_i32scatter_epi32(i32_ptr, k, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, float>) _mm256_mask_i32scatter_ps(base, k, to_vec(indices), to_vec(v), 4);
+                    else _mm256_mask_i32scatter_epi32(i32_ptr, k, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 16) {
+                    if constexpr (std::same_as<T, float>) _mm512_mask_i32scatter_ps(base, k, to_vec(indices), std::bit_cast<__m512>(v), 4);
+                    else _mm512_mask_i32scatter_epi32(i32_ptr, k, to_vec(indices), to_vec(v), 4);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 4 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    if constexpr (std::same_as<T, double>) _mm_mask_i32scatter_pd(base, k, to_index_vec(indices), to_vec(v), 8);
+                    else _mm_mask_i32scatter_epi64(i64_ptr, k, to_index_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, double>) _mm256_mask_i32scatter_pd(base, k, to_vec(indices), to_vec(v), 8);
+                    else _mm256_mask_i32scatter_epi64(i64_ptr, k, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, double>) _mm512_mask_i32scatter_pd(base, k, to_vec(indices), std::bit_cast<__m512d>(v), 8);
+                    else _mm512_mask_i32scatter_epi64(i64_ptr, k, to_vec(indices), to_vec(v), 8);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 8) {
+                if constexpr (N == 2) {
+                    if constexpr (std::same_as<T, double>) _mm_mask_i64scatter_pd(base, k, to_vec(indices), to_vec(v), 8);
+                    else _mm_mask_i64scatter_epi64(i64_ptr, k, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, double>) _mm256_mask_i64scatter_pd(base, k, to_vec(indices), to_vec(v), 8);
+                    else _mm256_mask_i64scatter_epi64(i64_ptr, k, to_vec(indices), to_vec(v), 8);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, double>) _mm512_mask_i64scatter_pd(base, k, to_vec(indices), std::bit_cast<__m512d>(v), 8);
+                    else _mm512_mask_i64scatter_epi64(i64_ptr, k, to_vec(indices), to_vec(v), 8);
+                    return;
+                }
+            } else if constexpr (sizeof(I) == 8 && sizeof(T) == 4) {
+                if constexpr (N == 4) {
+                    if constexpr (std::same_as<T, float>) _mm256_mask_i64scatter_ps(base, k, to_vec(indices), to_vec(v), 4);
+                    else _mm256_mask_i64scatter_epi32(i32_ptr, k, to_vec(indices), to_vec(v), 4);
+                    return;
+                } else if constexpr (N == 8) {
+                    if constexpr (std::same_as<T, float>) _mm512_mask_i64scatter_ps(base, k, to_vec(indices), std::bit_cast<__m256>(v), 4);
+                    else _mm512_mask_i64scatter_epi32(i32_ptr, k, to_vec(indices), to_vec(v), 4);
+                    return;
+                }
+            }
+
+            if constexpr (N > 1 && N * std::max(sizeof(T), sizeof(I)) > UI_NATIVE_SIZE) {
+                scatter(base, indices.lo, v.lo, mask.lo);
+                scatter(base, indices.hi, v.hi, mask.hi);
+                return;
+            }
+        }
+        #endif
+        emul::scatter(base, indices, v, mask);
+    }
+// !MARK
+
+} // namespace ui::x86
+
+#endif // AMT_UI_ARCH_X86_GATHER_HPP
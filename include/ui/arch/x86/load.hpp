@@ -2,7 +2,10 @@
 #define AMT_ARCH_X86_LOAD_HPP
 
 #include "cast.hpp"
+#include "../emul/load.hpp"
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <utility>
 
 namespace ui::x86 {
@@ -53,6 +56,8 @@ namespace ui::x86 {
                 #endif
             } else if constexpr (std::same_as<T, float16> || std::same_as<T, bfloat16>) {
                 return rcast<T>(load<N>(std::bit_cast<std::uint16_t>(val)));
+            } else if constexpr (::ui::internal::is_fp8<T>) {
+                return rcast<T>(load<N>(std::bit_cast<std::uint8_t>(val)));
             } else {
                 auto temp = static_cast<std::make_signed_t<T>>(val);
                 if constexpr (size == sizeof(__m128)) {
@@ -635,6 +640,163 @@ namespace ui::x86 {
             strided_load(data + N / 2 * 4, a.hi, b.hi, c.hi, d.hi);
         }
     }
+
+    namespace internal {
+        using emul::internal::interleave_lut;
+
+        template <std::size_t Size>
+        UI_ALWAYS_INLINE auto unpack_lo(__m128i a, __m128i b) noexcept -> __m128i {
+            if constexpr (Size == 1) return _mm_unpacklo_epi8(a, b);
+            else if constexpr (Size == 2) return _mm_unpacklo_epi16(a, b);
+            else if constexpr (Size == 4) return _mm_unpacklo_epi32(a, b);
+            else return _mm_unpacklo_epi64(a, b);
+        }
+
+        template <std::size_t Size>
+        UI_ALWAYS_INLINE auto unpack_hi(__m128i a, __m128i b) noexcept -> __m128i {
+            if constexpr (Size == 1) return _mm_unpackhi_epi8(a, b);
+            else if constexpr (Size == 2) return _mm_unpackhi_epi16(a, b);
+            else if constexpr (Size == 4) return _mm_unpackhi_epi32(a, b);
+            else return _mm_unpackhi_epi64(a, b);
+        }
+
+        // Full register, or a half register in the low 64 bits with the upper half zeroed.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto to_interleave_reg(Vec<N, T> const& v) noexcept -> __m128i {
+            if constexpr (N * sizeof(T) == sizeof(__m128i)) return std::bit_cast<__m128i>(v);
+            else return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(v.data()));
+        }
+
+        template <typename T>
+        UI_ALWAYS_INLINE auto store_reg(T* UI_RESTRICT data, __m128i v) noexcept -> void {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data), v);
+        }
+    } // namespace internal
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b
+    ) noexcept -> void {
+        using namespace internal;
+        static constexpr auto size = N * sizeof(T);
+        static constexpr auto lanes = sizeof(__m128i) / sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+        } else if constexpr (size == sizeof(__m128i)) {
+            auto ta = to_interleave_reg(a);
+            auto tb = to_interleave_reg(b);
+            store_reg(data, unpack_lo<sizeof(T)>(ta, tb));
+            store_reg(data + lanes, unpack_hi<sizeof(T)>(ta, tb));
+        } else if constexpr (size * 2 == sizeof(__m128i)) {
+            store_reg(data, unpack_lo<sizeof(T)>(to_interleave_reg(a), to_interleave_reg(b)));
+        } else if constexpr (size > sizeof(__m128i)) {
+            strided_store(data, a.lo, b.lo);
+            strided_store(data + N / 2 * 2, a.hi, b.hi);
+        } else {
+            emul::strided_store(data, a, b);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c
+    ) noexcept -> void {
+        using namespace internal;
+        static constexpr auto size = N * sizeof(T);
+        static constexpr auto lanes = sizeof(__m128i) / sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+        } else if constexpr (size > sizeof(__m128i)) {
+            strided_store(data, a.lo, b.lo, c.lo);
+            strided_store(data + N / 2 * 3, a.hi, b.hi, c.hi);
+        } else {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSSE3
+            if constexpr (size == sizeof(__m128i) || size * 2 == sizeof(__m128i)) {
+                // There is no 3-way unpack; every output register collects its bytes from the
+                // three streams with one `pshufb` each.
+                auto const& lut = interleave_lut<3, sizeof(T)>;
+                __m128i const streams[] = { to_interleave_reg(a), to_interleave_reg(b), to_interleave_reg(c) };
+                auto const out = [&](std::size_t r) {
+                    auto res = _mm_setzero_si128();
+                    for (auto s = 0u; s < 3; ++s) {
+                        auto m = _mm_load_si128(reinterpret_cast<__m128i const*>(lut[r][s].data()));
+                        res = _mm_or_si128(res, _mm_shuffle_epi8(streams[s], m));
+                    }
+                    return res;
+                };
+                if constexpr (size == sizeof(__m128i)) {
+                    store_reg(data, out(0));
+                    store_reg(data + lanes, out(1));
+                    store_reg(data + 2 * lanes, out(2));
+                } else {
+                    // 24 bytes; the second register is only half used.
+                    store_reg(data, out(0));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(data + lanes), out(1));
+                }
+                return;
+            }
+            #endif
+            emul::strided_store(data, a, b, c);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto strided_store(
+        T* UI_RESTRICT data,
+        Vec<N, T> const& a,
+        Vec<N, T> const& b,
+        Vec<N, T> const& c,
+        Vec<N, T> const& d
+    ) noexcept -> void {
+        using namespace internal;
+        static constexpr auto size = N * sizeof(T);
+        static constexpr auto lanes = sizeof(__m128i) / sizeof(T);
+        if constexpr (N == 1) {
+            data[0] = a.val;
+            data[1] = b.val;
+            data[2] = c.val;
+            data[3] = d.val;
+        } else if constexpr (size == sizeof(__m128i)) {
+            auto ta = to_interleave_reg(a);
+            auto tb = to_interleave_reg(b);
+            auto tc = to_interleave_reg(c);
+            auto td = to_interleave_reg(d);
+            auto ab_lo = unpack_lo<sizeof(T)>(ta, tb); // a0, b0, a1, b1, ...
+            auto ab_hi = unpack_hi<sizeof(T)>(ta, tb);
+            auto cd_lo = unpack_lo<sizeof(T)>(tc, td); // c0, d0, c1, d1, ...
+            auto cd_hi = unpack_hi<sizeof(T)>(tc, td);
+            if constexpr (sizeof(T) == 8) {
+                store_reg(data, ab_lo);
+                store_reg(data + lanes, cd_lo);
+                store_reg(data + 2 * lanes, ab_hi);
+                store_reg(data + 3 * lanes, cd_hi);
+            } else {
+                // Unpacking the (a, b) and (c, d) pairs as double-width lanes yields a0, b0, c0, d0, ...
+                store_reg(data, unpack_lo<2 * sizeof(T)>(ab_lo, cd_lo));
+                store_reg(data + lanes, unpack_hi<2 * sizeof(T)>(ab_lo, cd_lo));
+                store_reg(data + 2 * lanes, unpack_lo<2 * sizeof(T)>(ab_hi, cd_hi));
+                store_reg(data + 3 * lanes, unpack_hi<2 * sizeof(T)>(ab_hi, cd_hi));
+            }
+        } else if constexpr (size * 2 == sizeof(__m128i)) {
+            auto ab = unpack_lo<sizeof(T)>(to_interleave_reg(a), to_interleave_reg(b));
+            auto cd = unpack_lo<sizeof(T)>(to_interleave_reg(c), to_interleave_reg(d));
+            store_reg(data, unpack_lo<2 * sizeof(T)>(ab, cd));
+            store_reg(data + lanes, unpack_hi<2 * sizeof(T)>(ab, cd));
+        } else if constexpr (size > sizeof(__m128i)) {
+            strided_store(data, a.lo, b.lo, c.lo, d.lo);
+            strided_store(data + N / 2 * 4, a.hi, b.hi, c.hi, d.hi);
+        } else {
+            emul::strided_store(data, a, b, c, d);
+        }
+    }
 } // namespace ui::x86
 
 #endif // AMT_ARCH_X86_LOAD_HPP
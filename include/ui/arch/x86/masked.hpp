@@ -0,0 +1,269 @@
+#ifndef AMT_UI_ARCH_X86_MASKED_HPP
+#define AMT_UI_ARCH_X86_MASKED_HPP
+
+#include "cast.hpp"
+#include "bit.hpp"
+#include "../emul/masked.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ui::x86 {
+
+    namespace internal {
+        using namespace ::ui::internal;
+        using emul::internal::can_overread;
+        using emul::internal::tail_mask;
+
+        // AVX `vmaskmov` covers 32/64-bit lanes of xmm/ymm registers regardless of the element
+        // type since it only moves bits; AVX-512 (with BW) covers every lane width.
+        template <std::size_t N, typename T>
+        static constexpr bool has_native_masked_mem = [] {
+            [[maybe_unused]] constexpr auto size = N * sizeof(T);
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            return size == 16 || size == 32 || size == 64;
+            #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            return (size == 16 || size == 32) && (sizeof(T) == 4 || sizeof(T) == 8);
+            #else
+            return false;
+            #endif
+        }();
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto to_mem_kmask(mask_t<N, T> const& m) noexcept {
+            static constexpr auto size = N * sizeof(T);
+            using reg_t = std::conditional_t<size == 16, __m128i, std::conditional_t<size == 32, __m256i, __m512i>>;
+            auto v = std::bit_cast<reg_t>(m);
+            if constexpr (size == 16) {
+                if constexpr (sizeof(T) == 1) return _mm_movepi8_mask(v);
+                else if constexpr (sizeof(T) == 2) return _mm_movepi16_mask(v);
+                else if constexpr (sizeof(T) == 4) return _mm_movepi32_mask(v);
+                else return _mm_movepi64_mask(v);
+            } else if constexpr (size == 32) {
+                if constexpr (sizeof(T) == 1) return _mm256_movepi8_mask(v);
+                else if constexpr (sizeof(T) == 2) return _mm256_movepi16_mask(v);
+                else if constexpr (sizeof(T) == 4) return _mm256_movepi32_mask(v);
+                else return _mm256_movepi64_mask(v);
+            } else {
+                if constexpr (sizeof(T) == 1) return _mm512_movepi8_mask(v);
+                else if constexpr (sizeof(T) == 2) return _mm512_movepi16_mask(v);
+                else if constexpr (sizeof(T) == 4) return _mm512_movepi32_mask(v);
+                else return _mm512_movepi64_mask(v);
+            }
+        }
+
+        template <std::size_t N, typename K>
+        UI_ALWAYS_INLINE auto to_tail_kmask(std::size_t count) noexcept -> K {
+            if constexpr (N >= 64) return static_cast<K>(count >= 64 ? ~std::uint64_t{} : (std::uint64_t{1} << count) - 1);
+            else return static_cast<K>((std::uint64_t{1} << count) - 1);
+        }
+
+        template <std::size_t N, typename T, typename K>
+        UI_ALWAYS_INLINE auto masked_load_k(
+            T const* UI_RESTRICT in,
+            K k,
+            Vec<N, T> const& src
+        ) noexcept -> Vec<N, T> {
+            using ret_t = Vec<N, T>;
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (size == 16) {
+                auto s = std::bit_cast<__m128i>(src);
+                if constexpr (sizeof(T) == 1) return std::bit_cast<ret_t>(_mm_mask_loadu_epi8(s, k, in));
+                else if constexpr (sizeof(T) == 2) return std::bit_cast<ret_t>(_mm_mask_loadu_epi16(s, k, in));
+                else if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm_mask_loadu_epi32(s, k, in));
+                else return std::bit_cast<ret_t>(_mm_mask_loadu_epi64(s, k, in));
+            } else if constexpr (size == 32) {
+                auto s = std::bit_cast<__m256i>(src);
+                if constexpr (sizeof(T) == 1) return std::bit_cast<ret_t>(_mm256_mask_loadu_epi8(s, k, in));
+                else if constexpr (sizeof(T) == 2) return std::bit_cast<ret_t>(_mm256_mask_loadu_epi16(s, k, in));
+                else if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm256_mask_loadu_epi32(s, k, in));
+                else return std::bit_cast<ret_t>(_mm256_mask_loadu_epi64(s, k, in));
+            } else {
+                auto s = std::bit_cast<__m512i>(src);
+                if constexpr (sizeof(T) == 1) return std::bit_cast<ret_t>(_mm512_mask_loadu_epi8(s, k, in));
+                else if constexpr (sizeof(T) == 2) return std::bit_cast<ret_t>(_mm512_mask_loadu_epi16(s, k, in));
+                else if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm512_mask_loadu_epi32(s, k, in));
+                else return std::bit_cast<ret_t>(_mm512_mask_loadu_epi64(s, k, in));
+            }
+        }
+
+        template <std::size_t N, typename T, typename K>
+        UI_ALWAYS_INLINE auto masked_store_k(
+            T* UI_RESTRICT out,
+            Vec<N, T> const& v,
+            K k
+        ) noexcept -> void {
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (size == 16) {
+                auto s = std::bit_cast<__m128i>(v);
+                if constexpr (sizeof(T) == 1) _mm_mask_storeu_epi8(out, k, s);
+                else if constexpr (sizeof(T) == 2) _mm_mask_storeu_epi16(out, k, s);
+                else if constexpr (sizeof(T) == 4) _mm_mask_storeu_epi32(out, k, s);
+                else _mm_mask_storeu_epi64(out, k, s);
+            } else if constexpr (size == 32) {
+                auto s = std::bit_cast<__m256i>(v);
+                if constexpr (sizeof(T) == 1) _mm256_mask_storeu_epi8(out, k, s);
+                else if constexpr (sizeof(T) == 2) _mm256_mask_storeu_epi16(out, k, s);
+                else if constexpr (sizeof(T) == 4) _mm256_mask_storeu_epi32(out, k, s);
+                else _mm256_mask_storeu_epi64(out, k, s);
+            } else {
+                auto s = std::bit_cast<__m512i>(v);
+                if constexpr (sizeof(T) == 1) _mm512_mask_storeu_epi8(out, k, s);
+                else if constexpr (sizeof(T) == 2) _mm512_mask_storeu_epi16(out, k, s);
+                else if constexpr (sizeof(T) == 4) _mm512_mask_storeu_epi32(out, k, s);
+                else _mm512_mask_storeu_epi64(out, k, s);
+            }
+        }
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+        // `vmaskmov` zeroes inactive lanes and suppresses their faults.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto maskmov_load(
+            T const* UI_RESTRICT in,
+            mask_t<N, T> const& mask
+        ) noexcept -> Vec<N, T> {
+            using ret_t = Vec<N, T>;
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (size == 16) {
+                auto m = std::bit_cast<__m128i>(mask);
+                if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm_maskload_ps(reinterpret_cast<float const*>(in), m));
+                else return std::bit_cast<ret_t>(_mm_maskload_pd(reinterpret_cast<double const*>(in), m));
+            } else {
+                auto m = std::bit_cast<__m256i>(mask);
+                if constexpr (sizeof(T) == 4) return std::bit_cast<ret_t>(_mm256_maskload_ps(reinterpret_cast<float const*>(in), m));
+                else return std::bit_cast<ret_t>(_mm256_maskload_pd(reinterpret_cast<double const*>(in), m));
+            }
+        }
+
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto maskmov_store(
+            T* UI_RESTRICT out,
+            Vec<N, T> const& v,
+            mask_t<N, T> const& mask
+        ) noexcept -> void {
+            static constexpr auto size = N * sizeof(T);
+            if constexpr (size == 16) {
+                auto m = std::bit_cast<__m128i>(mask);
+                if constexpr (sizeof(T) == 4) _mm_maskstore_ps(reinterpret_cast<float*>(out), m, std::bit_cast<__m128>(v));
+                else _mm_maskstore_pd(reinterpret_cast<double*>(out), m, std::bit_cast<__m128d>(v));
+            } else {
+                auto m = std::bit_cast<__m256i>(mask);
+                if constexpr (sizeof(T) == 4) _mm256_maskstore_ps(reinterpret_cast<float*>(out), m, std::bit_cast<__m256>(v));
+                else _mm256_maskstore_pd(reinterpret_cast<double*>(out), m, std::bit_cast<__m256d>(v));
+            }
+        }
+        #endif
+    } // namespace internal
+
+// MARK: Masked Load
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_load(
+        T const* UI_RESTRICT in,
+        mask_t<N, T> const& mask,
+        Vec<N, T> const& src = {}
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if constexpr (has_native_masked_mem<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            return masked_load_k(in, to_mem_kmask<N, T>(mask), src);
+            #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            return bitwise_select(mask, maskmov_load(in, mask), src);
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            return join(
+                masked_load(in, mask.lo, src.lo),
+                masked_load(in + N / 2, mask.hi, src.hi)
+            );
+        } else {
+            if constexpr (N * sizeof(T) == sizeof(__m128)) {
+                // Inactive lanes may be read as long as the read cannot cross into an unmapped page.
+                if (can_overread<N * sizeof(T)>(in)) {
+                    return bitwise_select(mask, Vec<N, T>::load(in, N), src);
+                }
+            }
+            return emul::masked_load(in, mask, src);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_load(
+        T const* UI_RESTRICT in,
+        std::size_t count
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        if (count >= N) return Vec<N, T>::load(in, N);
+        if constexpr (has_native_masked_mem<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            using k_t = decltype(to_mem_kmask<N, T>(mask_t<N, T>{}));
+            return masked_load_k(in, to_tail_kmask<N, k_t>(count), Vec<N, T>{});
+            #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            return maskmov_load(in, tail_mask<N, T>(count));
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            static constexpr auto half = N / 2;
+            if (count <= half) return join(masked_load<half>(in, count), Vec<half, T>{});
+            return join(Vec<half, T>::load(in, half), masked_load<half>(in + half, count - half));
+        } else {
+            return emul::masked_load<N>(in, count);
+        }
+    }
+// !MARK
+
+// MARK: Masked Store
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        mask_t<N, T> const& mask
+    ) noexcept -> void {
+        using namespace internal;
+        if constexpr (has_native_masked_mem<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            masked_store_k(out, v, to_mem_kmask<N, T>(mask));
+            #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            maskmov_store(out, v, mask);
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            masked_store(out, v.lo, mask.lo);
+            masked_store(out + N / 2, v.hi, mask.hi);
+        } else {
+            emul::masked_store(out, v, mask);
+        }
+    }
+
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE auto masked_store(
+        T* UI_RESTRICT out,
+        Vec<N, T> const& v,
+        std::size_t count
+    ) noexcept -> void {
+        using namespace internal;
+        if (count >= N) {
+            std::memcpy(out, v.data(), sizeof(v));
+            return;
+        }
+        if constexpr (has_native_masked_mem<N, T>) {
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            using k_t = decltype(to_mem_kmask<N, T>(mask_t<N, T>{}));
+            masked_store_k(out, v, to_tail_kmask<N, k_t>(count));
+            #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            maskmov_store(out, v, tail_mask<N, T>(count));
+            #endif
+        } else if constexpr (N > 1 && N * sizeof(T) > UI_NATIVE_SIZE) {
+            static constexpr auto half = N / 2;
+            if (count <= half) {
+                masked_store(out, v.lo, count);
+            } else {
+                std::memcpy(out, v.lo.data(), sizeof(v.lo));
+                masked_store(out + half, v.hi, count - half);
+            }
+        } else {
+            emul::masked_store(out, v, count);
+        }
+    }
+// !MARK
+
+} // namespace ui::x86
+
+#endif // AMT_UI_ARCH_X86_MASKED_HPP
@@ -766,7 +766,7 @@ namespace ui::x86 {
                                 auto t1 = _mm_srli_epi16(a, 8); // logical shift right by 8
                                 auto t2 = _mm_min_epu8(a, t1);
                                 auto t3 = _mm_minpos_epu16(t2);
-                                return static_cast<T>(_mm_cvtsi128_si32(t2));
+                                return static_cast<T>(_mm_cvtsi128_si32(t3));
                             }
                         }
                     } else if constexpr (sizeof(T) == 2) {
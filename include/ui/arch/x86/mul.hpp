@@ -4,11 +4,14 @@
 #include "cast.hpp"
 #include "add.hpp"
 #include "sub.hpp"
+#include "shift.hpp"
+#include "logical.hpp"
 #include "../emul/mul.hpp"
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 namespace ui::x86 {
 
@@ -56,9 +59,16 @@ namespace ui::x86 {
                        return from_vec<T>(_mm_mullo_epi16(a, b)); 
                     } else if constexpr (sizeof(T) == 4) {
                         return from_vec<T>(_mm_mullo_epi32(a, b));
-                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
                     } else if constexpr (sizeof(T) == 8) {
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
                         return from_vec<T>(_mm_mullo_epi64(a, b));
+                    #else
+                        // lo(a) * lo(b) + ((lo(a) * hi(b) + hi(a) * lo(b)) << 32)
+                        auto b_swap = _mm_shuffle_epi32(b, _MM_SHUFFLE(2,3, 0,1));
+                        auto crossprod = _mm_mullo_epi32(a, b_swap);
+                        auto sumcross = _mm_add_epi32(crossprod, _mm_srli_epi64(crossprod, 32));
+                        auto prodll = _mm_mul_epu32(a, b);
+                        return from_vec<T>(_mm_add_epi64(prodll, _mm_slli_epi64(sumcross, 32)));
                     #endif
                     }
                 }
@@ -259,11 +269,14 @@ namespace ui::x86 {
                     return cast<T>(fused_mul_acc(cast<float>(acc), cast<float>(lhs), cast<float>(rhs), op));
                 }
             } else if constexpr (bits * 2 == sizeof(__m128)) {
+                auto ta = fit_to_vec(acc);
                 auto tl = fit_to_vec(lhs);
                 auto tr = fit_to_vec(rhs);
-                return mul(
+                return fused_mul_acc(
+                    from_vec<T>(ta),
                     from_vec<T>(tl),
-                    from_vec<T>(tr)
+                    from_vec<T>(tr),
+                    op
                 ).lo;
             }
 
@@ -334,11 +347,14 @@ namespace ui::x86 {
                     return cast<T>(fused_mul_acc(cast<float>(acc), cast<float>(lhs), cast<float>(rhs), op));
                 }
             } else if constexpr (bits * 2 == sizeof(__m128)) {
+                auto ta = fit_to_vec(acc);
                 auto tl = fit_to_vec(lhs);
                 auto tr = fit_to_vec(rhs);
-                return mul(
+                return fused_mul_acc(
+                    from_vec<T>(ta),
                     from_vec<T>(tl),
-                    from_vec<T>(tr)
+                    from_vec<T>(tr),
+                    op
                 ).lo;
             }
 
@@ -578,6 +594,299 @@ namespace ui::x86 {
         );
     }
 // !MARK
+
+// MARK: High-half Multiplication
+    namespace internal {
+        // Full 128-bit products of 64-bit lanes from four `pmuludq` partial products; returns the
+        // low half and writes the high half to `hi`. A negative operand reads as itself plus 2^64
+        // when unsigned, so the signed high half subtracts the other operand for every negative one.
+        template <bool Signed>
+        UI_ALWAYS_INLINE auto mul_wide_64(__m128i a, __m128i b, __m128i& hi) noexcept -> __m128i {
+            auto const mask = _mm_set1_epi64x(0xffff'ffff);
+            auto const a_hi = _mm_srli_epi64(a, 32);
+            auto const b_hi = _mm_srli_epi64(b, 32);
+            auto const ll = _mm_mul_epu32(a, b);
+            auto const lh = _mm_mul_epu32(a, b_hi);
+            auto const hl = _mm_mul_epu32(a_hi, b);
+            auto const hh = _mm_mul_epu32(a_hi, b_hi);
+
+            auto mid = _mm_add_epi64(_mm_srli_epi64(ll, 32), _mm_and_si128(lh, mask));
+            mid = _mm_add_epi64(mid, _mm_and_si128(hl, mask));
+            hi = _mm_add_epi64(hh, _mm_srli_epi64(lh, 32));
+            hi = _mm_add_epi64(hi, _mm_srli_epi64(hl, 32));
+            hi = _mm_add_epi64(hi, _mm_srli_epi64(mid, 32));
+            auto const lo = _mm_or_si128(_mm_slli_epi64(mid, 32), _mm_and_si128(ll, mask));
+
+            if constexpr (Signed) {
+                auto const sa = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3,3, 1,1));
+                auto const sb = _mm_shuffle_epi32(_mm_srai_epi32(b, 31), _MM_SHUFFLE(3,3, 1,1));
+                hi = _mm_sub_epi64(hi, _mm_and_si128(sa, b));
+                hi = _mm_sub_epi64(hi, _mm_and_si128(sb, a));
+            }
+            return lo;
+        }
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        template <bool Signed>
+        UI_ALWAYS_INLINE auto mul_wide_64(__m256i a, __m256i b, __m256i& hi) noexcept -> __m256i {
+            auto const mask = _mm256_set1_epi64x(0xffff'ffff);
+            auto const a_hi = _mm256_srli_epi64(a, 32);
+            auto const b_hi = _mm256_srli_epi64(b, 32);
+            auto const ll = _mm256_mul_epu32(a, b);
+            auto const lh = _mm256_mul_epu32(a, b_hi);
+            auto const hl = _mm256_mul_epu32(a_hi, b);
+            auto const hh = _mm256_mul_epu32(a_hi, b_hi);
+
+            auto mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_and_si256(lh, mask));
+            mid = _mm256_add_epi64(mid, _mm256_and_si256(hl, mask));
+            hi = _mm256_add_epi64(hh, _mm256_srli_epi64(lh, 32));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(hl, 32));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(mid, 32));
+            auto const lo = _mm256_or_si256(_mm256_slli_epi64(mid, 32), _mm256_and_si256(ll, mask));
+
+            if constexpr (Signed) {
+                auto const sa = _mm256_shuffle_epi32(_mm256_srai_epi32(a, 31), _MM_SHUFFLE(3,3, 1,1));
+                auto const sb = _mm256_shuffle_epi32(_mm256_srai_epi32(b, 31), _MM_SHUFFLE(3,3, 1,1));
+                hi = _mm256_sub_epi64(hi, _mm256_and_si256(sa, b));
+                hi = _mm256_sub_epi64(hi, _mm256_and_si256(sb, a));
+            }
+            return lo;
+        }
+        #endif
+    } // namespace internal
+
+    template <bool Merge = true, std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto mul_high(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> Vec<N, T> {
+        static constexpr auto bits = sizeof(lhs);
+        if constexpr (N == 1) {
+            return emul::mul_high(lhs, rhs);
+        } else if constexpr (sizeof(T) == 8) {
+            if constexpr (bits == sizeof(__m128i)) {
+                auto hi = decltype(to_vec(lhs)){};
+                internal::mul_wide_64<std::is_signed_v<T>>(to_vec(lhs), to_vec(rhs), hi);
+                return from_vec<T>(hi);
+            }
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            else if constexpr (bits == sizeof(__m256i)) {
+                auto hi = decltype(to_vec(lhs)){};
+                internal::mul_wide_64<std::is_signed_v<T>>(to_vec(lhs), to_vec(rhs), hi);
+                return from_vec<T>(hi);
+            }
+            #endif
+            else {
+                return join(
+                    mul_high(lhs.lo, rhs.lo),
+                    mul_high(lhs.hi, rhs.hi)
+                );
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            // 16-bit products; the high byte is the result.
+            using wide_t = internal::widening_result_t<T>;
+            return cast<T>(shift_right<8>(mul(cast<wide_t>(lhs), cast<wide_t>(rhs))));
+        } else {
+            if constexpr (bits == sizeof(__m128i)) {
+                auto a = to_vec(lhs);
+                auto b = to_vec(rhs);
+                if constexpr (sizeof(T) == 2) {
+                    if constexpr (std::is_signed_v<T>) return from_vec<T>(_mm_mulhi_epi16(a, b));
+                    else return from_vec<T>(_mm_mulhi_epu16(a, b));
+                } else {
+                    // `pmuludq` multiplies lanes 0 and 2; lanes 1 and 3 are shifted down first.
+                    auto const wide_mul = [](__m128i x, __m128i y) {
+                        if constexpr (std::is_signed_v<T>) return _mm_mul_epi32(x, y);
+                        else return _mm_mul_epu32(x, y);
+                    };
+                    auto even = wide_mul(a, b);
+                    auto odd = wide_mul(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+                    return from_vec<T>(_mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xcc));
+                }
+            } else if constexpr (bits * 2 == sizeof(__m128i) && Merge) {
+                return mul_high(from_vec<T>(fit_to_vec(lhs)), from_vec<T>(fit_to_vec(rhs))).lo;
+            }
+
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            if constexpr (bits == sizeof(__m256i)) {
+                auto a = to_vec(lhs);
+                auto b = to_vec(rhs);
+                if constexpr (sizeof(T) == 2) {
+                    if constexpr (std::is_signed_v<T>) return from_vec<T>(_mm256_mulhi_epi16(a, b));
+                    else return from_vec<T>(_mm256_mulhi_epu16(a, b));
+                } else {
+                    auto const wide_mul = [](__m256i x, __m256i y) {
+                        if constexpr (std::is_signed_v<T>) return _mm256_mul_epi32(x, y);
+                        else return _mm256_mul_epu32(x, y);
+                    };
+                    auto even = wide_mul(a, b);
+                    auto odd = wide_mul(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+                    return from_vec<T>(_mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa));
+                }
+            }
+            #endif
+
+            if constexpr (bits > sizeof(__m128i)) {
+                return join(
+                    mul_high<false>(lhs.lo, rhs.lo),
+                    mul_high<false>(lhs.hi, rhs.hi)
+                );
+            } else {
+                return emul::mul_high(lhs, rhs);
+            }
+        }
+    }
+
+    /**
+     * @brief Full double-width product of every lane, returned as the low and the high halves.
+     */
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto mul_wide(
+        Vec<N, T> const& lhs,
+        Vec<N, T> const& rhs
+    ) noexcept -> std::pair<Vec<N, T> /*low*/, Vec<N, T> /*high*/> {
+        static constexpr auto bits = sizeof(lhs);
+        if constexpr (N > 1 && sizeof(T) == 8) {
+            if constexpr (bits == sizeof(__m128i)) {
+                auto hi = decltype(to_vec(lhs)){};
+                auto lo = internal::mul_wide_64<std::is_signed_v<T>>(to_vec(lhs), to_vec(rhs), hi);
+                return { from_vec<T>(lo), from_vec<T>(hi) };
+            }
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            else if constexpr (bits == sizeof(__m256i)) {
+                auto hi = decltype(to_vec(lhs)){};
+                auto lo = internal::mul_wide_64<std::is_signed_v<T>>(to_vec(lhs), to_vec(rhs), hi);
+                return { from_vec<T>(lo), from_vec<T>(hi) };
+            }
+            #endif
+            else {
+                auto [ll, lh] = mul_wide(lhs.lo, rhs.lo);
+                auto [hl, hh] = mul_wide(lhs.hi, rhs.hi);
+                return { join(ll, hl), join(lh, hh) };
+            }
+        } else {
+            return { mul(lhs, rhs), mul_high(lhs, rhs) };
+        }
+    }
+// !MARK
+
+// MARK: Dot-Product Accumulate
+    /**
+     * @brief Adds the products of each pair of adjacent lanes to one accumulator lane;
+     * `acc[i] + lhs[2i] * rhs[2i] + lhs[2i + 1] * rhs[2i + 1]`. Uses `vdpbf16ps` with
+     * AVX512-BF16, which treats subnormal inputs and outputs as zero.
+     */
+    template <std::size_t N, std::size_t M>
+        requires (M == 2 * N)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, float> const& acc,
+        Vec<M, bfloat16> const& lhs,
+        Vec<M, bfloat16> const& rhs
+    ) noexcept -> Vec<N, float> {
+        if constexpr (N == 1) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else {
+            #if defined(UI_HAS_AVX512_BF16) && UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            static constexpr auto bits = sizeof(acc);
+            if constexpr (bits == sizeof(__m128)) {
+                return from_vec(_mm_dpbf16_ps(to_vec(acc), std::bit_cast<__m128bh>(lhs), std::bit_cast<__m128bh>(rhs)));
+            } else if constexpr (bits == sizeof(__m256)) {
+                return from_vec(_mm256_dpbf16_ps(to_vec(acc), std::bit_cast<__m256bh>(lhs), std::bit_cast<__m256bh>(rhs)));
+            } else if constexpr (bits == sizeof(__m512)) {
+                return std::bit_cast<Vec<N, float>>(_mm512_dpbf16_ps(to_vec(acc), std::bit_cast<__m512bh>(lhs), std::bit_cast<__m512bh>(rhs)));
+            }
+            #endif
+            // The even lanes are the low halves of the 32-bit lanes and the odd lanes the high
+            // halves, so both widen in place without a shuffle.
+            auto const mask = Vec<N, std::uint32_t>::load(0xffff'0000);
+            auto const l = std::bit_cast<Vec<N, std::uint32_t>>(lhs);
+            auto const r = std::bit_cast<Vec<N, std::uint32_t>>(rhs);
+            auto const even = [](auto const& v) { return std::bit_cast<Vec<N, float>>(shift_left<16>(v)); };
+            auto const odd = [&mask](auto const& v) { return std::bit_cast<Vec<N, float>>(bitwise_and(v, mask)); };
+            auto const res = fused_mul_acc(acc, even(l), even(r), op::add_t{});
+            return fused_mul_acc(res, odd(l), odd(r), op::add_t{});
+        }
+    }
+
+    /**
+     * @brief Adds the products of each group of four adjacent 8-bit lanes to one 32-bit
+     * accumulator lane; `acc[i] + lhs[4i] * rhs[4i] + ... + lhs[4i + 3] * rhs[4i + 3]`.
+     * One signed and one unsigned operand map to `vpdpbusd` with AVX512-VNNI or AVX-VNNI.
+     * Otherwise the even and odd bytes are widened in place and multiplied with `pmaddwd`,
+     * which is exact, unlike `pmaddubsw` that saturates the sum of two products at 16 bits.
+     */
+    template <std::size_t N, std::size_t M, typename A, typename L, typename R>
+        requires (M == 4 * N && ::ui::internal::int8_dot<A, L, R>)
+    UI_ALWAYS_INLINE auto dot_acc(
+        Vec<N, A> const& acc,
+        Vec<M, L> const& lhs,
+        Vec<M, R> const& rhs
+    ) noexcept -> Vec<N, A> {
+        static constexpr auto bits = sizeof(acc);
+        if constexpr (N == 1 || bits < sizeof(__m128i)) {
+            return emul::dot_acc(acc, lhs, rhs);
+        } else if constexpr (std::is_signed_v<L> && !std::is_signed_v<R>) {
+            // `vpdpbusd` takes the unsigned operand first.
+            return dot_acc(acc, rhs, lhs);
+        } else {
+            [[maybe_unused]] static constexpr auto mixed = std::is_signed_v<L> != std::is_signed_v<R>;
+
+            #if defined(UI_HAS_AVX512_VNNI) && UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (mixed) {
+                if constexpr (bits == sizeof(__m128i)) {
+                    return from_vec<A>(_mm_dpbusd_epi32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                } else if constexpr (bits == sizeof(__m256i)) {
+                    return from_vec<A>(_mm256_dpbusd_epi32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                } else if constexpr (bits == sizeof(__m512i)) {
+                    return from_vec<A>(_mm512_dpbusd_epi32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                }
+            }
+            #elif defined(UI_HAS_AVX_VNNI) && UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            if constexpr (mixed) {
+                if constexpr (bits == sizeof(__m128i)) {
+                    return from_vec<A>(_mm_dpbusd_avx_epi32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                } else if constexpr (bits == sizeof(__m256i)) {
+                    return from_vec<A>(_mm256_dpbusd_avx_epi32(to_vec(acc), to_vec(lhs), to_vec(rhs)));
+                }
+            }
+            #endif
+
+            // Byte 0 and 2 of every 32-bit lane become the even 16-bit lanes, byte 1 and 3 the odd
+            // ones; each `pmaddwd` then sums two of the four products.
+            #define UI_DOT_EVEN(P, T, V) (std::is_signed_v<T> ? _##P##_srai_epi16(_##P##_slli_epi16(V, 8), 8) : _##P##_srli_epi16(_##P##_slli_epi16(V, 8), 8))
+            #define UI_DOT_ODD(P, T, V)  (std::is_signed_v<T> ? _##P##_srai_epi16(V, 8) : _##P##_srli_epi16(V, 8))
+            #define UI_DOT_OP(P) \
+                auto const l = to_vec(lhs); \
+                auto const r = to_vec(rhs); \
+                auto const even = _##P##_madd_epi16(UI_DOT_EVEN(P, L, l), UI_DOT_EVEN(P, R, r)); \
+                auto const odd = _##P##_madd_epi16(UI_DOT_ODD(P, L, l), UI_DOT_ODD(P, R, r)); \
+                return from_vec<A>(_##P##_add_epi32(to_vec(acc), _##P##_add_epi32(even, odd)));
+
+            if constexpr (bits == sizeof(__m128i)) {
+                UI_DOT_OP(mm)
+            }
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            if constexpr (bits == sizeof(__m256i)) {
+                UI_DOT_OP(mm256)
+            }
+            #endif
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            if constexpr (bits == sizeof(__m512i)) {
+                UI_DOT_OP(mm512)
+            }
+            #endif
+
+            #undef UI_DOT_OP
+            #undef UI_DOT_ODD
+            #undef UI_DOT_EVEN
+
+            return join(
+                dot_acc(acc.lo, lhs.lo, rhs.lo),
+                dot_acc(acc.hi, lhs.hi, rhs.hi)
+            );
+        }
+    }
+// !MARK
 } // namespace ui::x86
 
 #endif // AMT_UI_ARCH_X86_MUL_HPP
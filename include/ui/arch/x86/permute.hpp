@@ -1,10 +1,119 @@
 #ifndef AMT_UI_ARCH_X86_PERMUTE_HPP
 #define AMT_UI_ARCH_X86_PERMUTE_HPP
 
+#include "cast.hpp"
 #include "../emul/permute.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 namespace ui::x86 {
     using emul::shuffle;
+
+    namespace internal {
+        using namespace ::ui::internal;
+
+        // `pshufb` only looks at the low four bits and the sign bit. Each 16-byte chunk `j` of the
+        // table is indexed with `idx - 16 * j`; the saturating add of 0x70 keeps the low bits of
+        // in-range indices and sets the sign bit of every other one, zeroing that lane.
+        template <std::size_t M, typename T>
+        UI_ALWAYS_INLINE auto lookup_chunks(
+            Vec<M, T> const& table,
+            __m128i idx
+        ) noexcept -> __m128i {
+            auto const* t = reinterpret_cast<__m128i const*>(table.data());
+            auto const bias = _mm_set1_epi8(0x70);
+            auto res = _mm_setzero_si128();
+            auto const helper = [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+                ((res = _mm_or_si128(res, _mm_shuffle_epi8(
+                    _mm_loadu_si128(t + Js),
+                    _mm_adds_epu8(_mm_sub_epi8(idx, _mm_set1_epi8(static_cast<char>(16 * Js))), bias)
+                ))),...);
+            };
+            helper(std::make_index_sequence<M / 16>{});
+            return res;
+        }
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        // `vpshufb` works within 128-bit lanes, so every chunk is broadcast to both lanes.
+        template <std::size_t M, typename T>
+        UI_ALWAYS_INLINE auto lookup_chunks(
+            Vec<M, T> const& table,
+            __m256i idx
+        ) noexcept -> __m256i {
+            auto const* t = reinterpret_cast<__m128i const*>(table.data());
+            auto const bias = _mm256_set1_epi8(0x70);
+            auto res = _mm256_setzero_si256();
+            auto const helper = [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+                ((res = _mm256_or_si256(res, _mm256_shuffle_epi8(
+                    _mm256_broadcastsi128_si256(_mm_loadu_si128(t + Js)),
+                    _mm256_adds_epu8(_mm256_sub_epi8(idx, _mm256_set1_epi8(static_cast<char>(16 * Js))), bias)
+                ))),...);
+            };
+            helper(std::make_index_sequence<M / 16>{});
+            return res;
+        }
+        #endif
+    } // namespace internal
+
+    template <std::size_t M, std::size_t N, typename T>
+        requires (sizeof(T) == 1)
+    UI_ALWAYS_INLINE auto lookup(
+        Vec<M, T> const& table,
+        Vec<N, std::uint8_t> const& indices
+    ) noexcept -> Vec<N, T> {
+        using namespace internal;
+        using ret_t = Vec<N, T>;
+        static constexpr bool is_chunked = (M % 16 == 0) && M <= 64;
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX && defined(__AVX512VBMI__)
+        // `vpermb` covers a table as wide as the index register; `vpermi2b` one twice as wide.
+        if constexpr (N == 16 && (M == 16 || M == 32)) {
+            auto idx = std::bit_cast<__m128i>(indices);
+            auto k = _mm_cmplt_epu8_mask(idx, _mm_set1_epi8(static_cast<char>(M)));
+            if constexpr (M == 16) {
+                return std::bit_cast<ret_t>(_mm_maskz_permutexvar_epi8(k, idx, std::bit_cast<__m128i>(table)));
+            } else {
+                auto lo = std::bit_cast<__m128i>(table.lo);
+                auto hi = std::bit_cast<__m128i>(table.hi);
+                return std::bit_cast<ret_t>(_mm_maskz_permutex2var_epi8(k, lo, idx, hi));
+            }
+        } else if constexpr (N == 32 && (M == 32 || M == 64)) {
+            auto idx = std::bit_cast<__m256i>(indices);
+            auto k = _mm256_cmplt_epu8_mask(idx, _mm256_set1_epi8(static_cast<char>(M)));
+            if constexpr (M == 32) {
+                return std::bit_cast<ret_t>(_mm256_maskz_permutexvar_epi8(k, idx, std::bit_cast<__m256i>(table)));
+            } else {
+                auto lo = std::bit_cast<__m256i>(table.lo);
+                auto hi = std::bit_cast<__m256i>(table.hi);
+                return std::bit_cast<ret_t>(_mm256_maskz_permutex2var_epi8(k, lo, idx, hi));
+            }
+        } else if constexpr (N == 64 && M == 64) {
+            auto idx = std::bit_cast<__m512i>(indices);
+            auto k = _mm512_cmplt_epu8_mask(idx, _mm512_set1_epi8(static_cast<char>(M)));
+            return std::bit_cast<ret_t>(_mm512_maskz_permutexvar_epi8(k, idx, std::bit_cast<__m512i>(table)));
+        } else
+        #endif
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        if constexpr (is_chunked && N == 32) {
+            return std::bit_cast<ret_t>(lookup_chunks(table, std::bit_cast<__m256i>(indices)));
+        } else
+        #endif
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSSE3
+        if constexpr (is_chunked && N == 16) {
+            return std::bit_cast<ret_t>(lookup_chunks(table, std::bit_cast<__m128i>(indices)));
+        } else if constexpr (is_chunked && N == 8) {
+            auto idx = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(indices.data()));
+            return std::bit_cast<Vec<16, T>>(lookup_chunks(table, idx)).lo;
+        } else
+        #endif
+        if constexpr (is_chunked && N > 16) {
+            return join(lookup(table, indices.lo), lookup(table, indices.hi));
+        } else {
+            return emul::lookup(table, indices);
+        }
+    }
 } // namespace ui::x86
 
-#endif // AMT_UI_ARCH_X86_PERMUTE_HPP 
+#endif // AMT_UI_ARCH_X86_PERMUTE_HPP
@@ -6,6 +6,7 @@
 #include "logical.hpp"
 #include <algorithm>
 #include <bit>
+#include <cassert>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -836,6 +837,142 @@ namespace ui::x86 {
     }
 // !MARK
 
+// MARK: Shift by a runtime count
+    namespace internal {
+        // `psllw`-style shifts take one count for every lane. Bytes are shifted as words and
+        // masked; arithmetic shifts without a native instruction flip the sign bits around a
+        // logical shift.
+        template <bool Left, typename T>
+        UI_ALWAYS_INLINE auto shift_by_count(__m128i a, unsigned s) noexcept -> __m128i {
+            auto const c = _mm_cvtsi32_si128(static_cast<int>(s));
+            if constexpr (sizeof(T) == 1) {
+                if constexpr (Left) {
+                    return _mm_and_si128(_mm_sll_epi16(a, c), _mm_set1_epi8(static_cast<char>(0xff << s)));
+                } else {
+                    auto const mask = _mm_set1_epi8(static_cast<char>(0xff >> s));
+                    if constexpr (std::is_signed_v<T>) {
+                        auto const sign = _mm_cmpgt_epi8(_mm_setzero_si128(), a);
+                        auto const res = _mm_and_si128(_mm_srl_epi16(_mm_xor_si128(a, sign), c), mask);
+                        return _mm_xor_si128(res, sign);
+                    } else {
+                        return _mm_and_si128(_mm_srl_epi16(a, c), mask);
+                    }
+                }
+            } else if constexpr (sizeof(T) == 2) {
+                if constexpr (Left) return _mm_sll_epi16(a, c);
+                else if constexpr (std::is_signed_v<T>) return _mm_sra_epi16(a, c);
+                else return _mm_srl_epi16(a, c);
+            } else if constexpr (sizeof(T) == 4) {
+                if constexpr (Left) return _mm_sll_epi32(a, c);
+                else if constexpr (std::is_signed_v<T>) return _mm_sra_epi32(a, c);
+                else return _mm_srl_epi32(a, c);
+            } else {
+                if constexpr (Left) return _mm_sll_epi64(a, c);
+                else if constexpr (std::is_signed_v<T>) {
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                    return _mm_sra_epi64(a, c);
+                    #else
+                    auto const sign = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                    return _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(a, sign), c), sign);
+                    #endif
+                } else {
+                    return _mm_srl_epi64(a, c);
+                }
+            }
+        }
+
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+        template <bool Left, typename T>
+        UI_ALWAYS_INLINE auto shift_by_count(__m256i a, unsigned s) noexcept -> __m256i {
+            auto const c = _mm_cvtsi32_si128(static_cast<int>(s));
+            if constexpr (sizeof(T) == 1) {
+                if constexpr (Left) {
+                    return _mm256_and_si256(_mm256_sll_epi16(a, c), _mm256_set1_epi8(static_cast<char>(0xff << s)));
+                } else {
+                    auto const mask = _mm256_set1_epi8(static_cast<char>(0xff >> s));
+                    if constexpr (std::is_signed_v<T>) {
+                        auto const sign = _mm256_cmpgt_epi8(_mm256_setzero_si256(), a);
+                        auto const res = _mm256_and_si256(_mm256_srl_epi16(_mm256_xor_si256(a, sign), c), mask);
+                        return _mm256_xor_si256(res, sign);
+                    } else {
+                        return _mm256_and_si256(_mm256_srl_epi16(a, c), mask);
+                    }
+                }
+            } else if constexpr (sizeof(T) == 2) {
+                if constexpr (Left) return _mm256_sll_epi16(a, c);
+                else if constexpr (std::is_signed_v<T>) return _mm256_sra_epi16(a, c);
+                else return _mm256_srl_epi16(a, c);
+            } else if constexpr (sizeof(T) == 4) {
+                if constexpr (Left) return _mm256_sll_epi32(a, c);
+                else if constexpr (std::is_signed_v<T>) return _mm256_sra_epi32(a, c);
+                else return _mm256_srl_epi32(a, c);
+            } else {
+                if constexpr (Left) return _mm256_sll_epi64(a, c);
+                else if constexpr (std::is_signed_v<T>) {
+                    #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+                    return _mm256_sra_epi64(a, c);
+                    #else
+                    auto const sign = _mm256_shuffle_epi32(_mm256_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                    return _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(a, sign), c), sign);
+                    #endif
+                } else {
+                    return _mm256_srl_epi64(a, c);
+                }
+            }
+        }
+        #endif
+
+        template <bool Left, std::size_t N, std::integral T>
+        UI_ALWAYS_INLINE auto shift_by_count(Vec<N, T> const& v, unsigned s) noexcept -> Vec<N, T> {
+            static constexpr auto size = sizeof(v);
+            if constexpr (N == 1) {
+                if constexpr (Left) return emul::shift_left(v, s);
+                else return emul::shift_right(v, s);
+            } else if constexpr (size == sizeof(__m128i)) {
+                return from_vec<T>(shift_by_count<Left, T>(to_vec(v), s));
+            } else if constexpr (size * 2 == sizeof(__m128i)) {
+                return from_vec<T>(shift_by_count<Left, T>(fit_to_vec(v), s)).lo;
+            #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            } else if constexpr (size == sizeof(__m256i)) {
+                return from_vec<T>(shift_by_count<Left, T>(to_vec(v), s));
+            #endif
+            } else if constexpr (size > sizeof(__m128i)) {
+                return join(
+                    shift_by_count<Left>(v.lo, s),
+                    shift_by_count<Left>(v.hi, s)
+                );
+            } else {
+                if constexpr (Left) return emul::shift_left(v, s);
+                else return emul::shift_right(v, s);
+            }
+        }
+    } // namespace internal
+
+    /**
+     * @brief Shifts every lane left by the same runtime count; `s` must be less than the lane width.
+     */
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_left(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        assert(s < sizeof(T) * 8);
+        return internal::shift_by_count<true>(v, s);
+    }
+
+    /**
+     * @brief Shifts every lane right by the same runtime count; arithmetic for signed lanes.
+     */
+    template <std::size_t N, std::integral T>
+    UI_ALWAYS_INLINE auto shift_right(
+        Vec<N, T> const& v,
+        unsigned s
+    ) noexcept -> Vec<N, T> {
+        assert(s < sizeof(T) * 8);
+        return internal::shift_by_count<false>(v, s);
+    }
+// !MARK
+
 // MARK: Shift Lane
     template <unsigned Shift, std::size_t N, typename T>
         requires (Shift <= N)
@@ -843,8 +980,18 @@ namespace ui::x86 {
         Vec<N, T> const& a,
         Vec<N, T> const& pad = {}
     ) noexcept -> Vec<N, T> {
-        // TODO: use `_mm_slli_si128`
-        return emul::shift_left_lane<Shift>(a, pad);
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE2
+        if constexpr (Shift > 0 && Shift < N && sizeof(a) == sizeof(__m128i)) {
+            // Vacated lanes take `pad`'s lanes at the same position.
+            static constexpr int bytes = static_cast<int>(Shift * sizeof(T));
+            auto const res = _mm_slli_si128(std::bit_cast<__m128i>(a), bytes);
+            auto const keep = _mm_slli_si128(_mm_set1_epi8(-1), bytes);
+            return std::bit_cast<Vec<N, T>>(
+                _mm_or_si128(res, _mm_andnot_si128(keep, std::bit_cast<__m128i>(pad)))
+            );
+        }
+        #endif
+        return emul::shift_right_lane<Shift>(a, pad);
     }
     template <unsigned Shift, std::size_t N, typename T>
         requires (Shift <= N)
@@ -852,7 +999,16 @@ namespace ui::x86 {
         Vec<N, T> const& a,
         Vec<N, T> const& pad = {}
     ) noexcept -> Vec<N, T> {
-        // TODO: use `_mm_slli_si128`
+        #if UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE2
+        if constexpr (Shift > 0 && Shift < N && sizeof(a) == sizeof(__m128i)) {
+            static constexpr int bytes = static_cast<int>(Shift * sizeof(T));
+            auto const res = _mm_srli_si128(std::bit_cast<__m128i>(a), bytes);
+            auto const keep = _mm_srli_si128(_mm_set1_epi8(-1), bytes);
+            return std::bit_cast<Vec<N, T>>(
+                _mm_or_si128(res, _mm_andnot_si128(keep, std::bit_cast<__m128i>(pad)))
+            );
+        }
+        #endif
         return emul::shift_left_lane<Shift>(a, pad);
     }
 // !MARK
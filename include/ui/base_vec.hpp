@@ -348,6 +348,16 @@ namespace ui {
             using type = std::uint16_t;
         };
 
+        template <>
+        struct Mask<float8_e4m3> {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct Mask<float8_e5m2> {
+            using type = std::uint8_t;
+        };
+
         template <>
         struct Mask<double> {
             using type = std::uint64_t;
@@ -504,6 +514,11 @@ namespace ui {
             return { ~mask };
         }
 
+        constexpr auto popcount() const noexcept -> size_type {
+            if constexpr (is_packed) return static_cast<size_type>(std::popcount(mask));
+            else return static_cast<size_type>(std::popcount(mask & 0x8888'8888'8888'8888));
+        }
+
         constexpr auto first_match() const noexcept -> size_type {
             auto res = static_cast<size_type>(std::countr_zero(mask));
             if constexpr (is_packed) return res;
@@ -0,0 +1,191 @@
+#ifndef AMT_UI_DISPATCH_HPP
+#define AMT_UI_DISPATCH_HPP
+
+#include "features.hpp"
+#include "arch/cpu_info.hpp"
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+// Runtime ISA dispatch
+// --------------------
+// The backend inside "arch/arch.hpp" is fixed by the compiler flags of a translation unit. To ship
+// one binary that runs at full width on every machine, the same kernel source is compiled once per
+// target (see `ui_add_dispatch_library` in "cmake/Dispatch.cmake"), each copy living inside its own
+// namespace. The caller then picks the best copy once at startup using `Dispatcher`.
+//
+// Kernel translation unit (compiled for sse41, avx2, skx, ...):
+//
+//     namespace kernels::UI_DISPATCH_TARGET {
+//         auto saxpy(float a, float const* x, float* y, std::size_t n) -> void { ... }
+//     }
+//
+// Baseline translation unit:
+//
+//     namespace kernels {
+//         namespace sse41 { auto saxpy(float, float const*, float*, std::size_t) -> void; }
+//         namespace avx2  { auto saxpy(float, float const*, float*, std::size_t) -> void; }
+//
+//         inline auto const saxpy = ui::Dispatcher<void(float, float const*, float*, std::size_t)>{
+//             { ui::IsaTarget::AVX2,  &avx2::saxpy  },
+//             { ui::IsaTarget::SSE41, &sse41::saxpy },
+//         };
+//     }
+//
+// NOTE: Only the kernel entry points should cross the translation unit boundary. Every vector
+// operation is force-inlined, so no instruction from a wider target leaks into a narrower one.
+
+#if defined(UI_NO_NATIVE_VECTOR)
+    #define UI_DISPATCH_TARGET emul
+#elif defined(UI_ARM_HAS_NEON)
+    #define UI_DISPATCH_TARGET neon
+#elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+    #define UI_DISPATCH_TARGET skx
+#elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+    #define UI_DISPATCH_TARGET avx2
+#elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+    #define UI_DISPATCH_TARGET avx
+#elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE42
+    #define UI_DISPATCH_TARGET sse42
+#elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE41
+    #define UI_DISPATCH_TARGET sse41
+#elif defined(UI_EMPSCRIPTEN)
+    #define UI_DISPATCH_TARGET wasm
+#else
+    #define UI_DISPATCH_TARGET emul
+#endif
+
+namespace ui {
+
+    // Ordered from the weakest to the strongest target so that the enum value can be used as a rank.
+    // x86, arm and wasm targets never coexist on the same machine.
+    enum class IsaTarget: std::uint8_t {
+        Emul,
+        SSE41,
+        SSE42,
+        AVX,
+        AVX2,   // AVX2 + FMA + F16C + BMI1/2 (x86-64-v3)
+        SKX,    // AVX512 F, CD, BW, DQ, VL
+        Neon,
+        Wasm
+    };
+
+    constexpr auto to_string(IsaTarget t) noexcept -> std::string_view {
+        switch (t) {
+            case IsaTarget::Emul:   return "emul";
+            case IsaTarget::SSE41:  return "sse41";
+            case IsaTarget::SSE42:  return "sse42";
+            case IsaTarget::AVX:    return "avx";
+            case IsaTarget::AVX2:   return "avx2";
+            case IsaTarget::SKX:    return "skx";
+            case IsaTarget::Neon:   return "neon";
+            case IsaTarget::Wasm:   return "wasm";
+        }
+        return "unknown";
+    }
+
+    // Target the current translation unit is compiled for.
+    static constexpr auto current_isa_target = []{
+        #if defined(UI_NO_NATIVE_VECTOR)
+            return IsaTarget::Emul;
+        #elif defined(UI_ARM_HAS_NEON)
+            return IsaTarget::Neon;
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SKX
+            return IsaTarget::SKX;
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX2
+            return IsaTarget::AVX2;
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_AVX
+            return IsaTarget::AVX;
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE42
+            return IsaTarget::SSE42;
+        #elif UI_CPU_SSE_LEVEL >= UI_CPU_SSE_LEVEL_SSE41
+            return IsaTarget::SSE41;
+        #elif defined(UI_EMPSCRIPTEN)
+            return IsaTarget::Wasm;
+        #else
+            return IsaTarget::Emul;
+        #endif
+    }();
+
+    namespace internal {
+        inline auto detect_isa_target_helper(CpuFeatures const& f) noexcept -> IsaTarget {
+            #if defined(UI_CPU_X86)
+                auto const sse42 = f.sse42 && f.popcnt;
+                auto const avx2 = f.avx2 && f.fma && f.f16c && f.bmi1 && f.bmi2;
+                auto const skx = avx2 && f.avx512f && f.avx512dq && f.avx512cd && f.avx512bw && f.avx512vl;
+
+                if (skx) return IsaTarget::SKX;
+                if (avx2) return IsaTarget::AVX2;
+                if (f.avx) return IsaTarget::AVX;
+                if (sse42) return IsaTarget::SSE42;
+                if (f.sse41) return IsaTarget::SSE41;
+                return IsaTarget::Emul;
+            #else
+                if (f.neon) return IsaTarget::Neon;
+                if (f.simd128) return IsaTarget::Wasm;
+                return IsaTarget::Emul;
+            #endif
+        }
+    } // namespace internal
+
+    // Best target supported by the running machine. The CPU is queried once and cached.
+    inline auto detect_isa_target() noexcept -> IsaTarget {
+        static auto const target = ui::internal::detect_isa_target_helper(cpu_info().features);
+        return target;
+    }
+
+    inline auto is_isa_supported(IsaTarget t) noexcept -> bool {
+        if (t == IsaTarget::Emul) return true;
+        auto const best = detect_isa_target();
+        auto const is_x86 = [](IsaTarget v) { return v >= IsaTarget::SSE41 && v <= IsaTarget::SKX; };
+        if (is_x86(t)) return is_x86(best) && t <= best;
+        return t == best;
+    }
+
+    template <typename Fn>
+    struct Dispatcher;
+
+    template <typename R, typename... Args>
+    struct Dispatcher<R(Args...)> {
+        using fn_type = R(*)(Args...);
+
+        struct Entry {
+            IsaTarget target;
+            fn_type fn;
+        };
+
+        // Picks the strongest entry the running machine supports. Entries can be given in any order.
+        Dispatcher(std::initializer_list<Entry> entries) noexcept {
+            for (auto const& e: entries) {
+                if (e.fn == nullptr || !is_isa_supported(e.target)) continue;
+                if (m_fn == nullptr || e.target > m_target) {
+                    m_fn = e.fn;
+                    m_target = e.target;
+                }
+            }
+            assert((m_fn != nullptr) && "no kernel variant is supported by this machine; provide an 'IsaTarget::Emul' fallback");
+        }
+
+        constexpr Dispatcher(Dispatcher const&) noexcept = default;
+        constexpr Dispatcher(Dispatcher &&) noexcept = default;
+        constexpr Dispatcher& operator=(Dispatcher const&) noexcept = default;
+        constexpr Dispatcher& operator=(Dispatcher &&) noexcept = default;
+        constexpr ~Dispatcher() noexcept = default;
+
+        UI_ALWAYS_INLINE auto operator()(Args... args) const -> R {
+            return m_fn(std::forward<Args>(args)...);
+        }
+
+        constexpr auto target() const noexcept -> IsaTarget { return m_target; }
+        constexpr auto get() const noexcept -> fn_type { return m_fn; }
+
+    private:
+        fn_type m_fn{nullptr};
+        IsaTarget m_target{IsaTarget::Emul};
+    };
+
+} // namespace ui
+
+#endif // AMT_UI_DISPATCH_HPP
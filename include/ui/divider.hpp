@@ -0,0 +1,162 @@
+#ifndef AMT_UI_DIVIDER_HPP
+#define AMT_UI_DIVIDER_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "modular_inv.hpp"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Division by a runtime-invariant integer
+// ---------------------------------------
+// Integer division has no SIMD instruction, and the floating-point fallback of `div` converts every
+// lane. When the divisor is known once and reused, `Divider` precomputes a magic multiplier and a
+// shift (Granlund and Montgomery, "Division by Invariant Integers using Multiplication") so that
+// every quotient costs one `mul_high`, a few adds and two shifts by the same count:
+//
+//     unsigned: t = mul_high(n, m); q = (t + ((n - t) >> s1)) >> s2
+//     signed:   q = ((n + mul_high(n, m)) >> s) - (n >> (W - 1)), then negated for a negative divisor
+//
+// When the dividend is known to be a multiple of the divisor, `exact` is cheaper still: it shifts
+// out the trailing zeros of the divisor and multiplies by the inverse of its odd part modulo 2^W.
+//
+//     auto const by = ui::Divider<std::uint32_t>(buckets);
+//     auto const bucket = by.rem(hash);
+
+namespace ui {
+
+    namespace internal {
+        // floor(hi * 2^W / d) for `hi < d`; restoring division one bit at a time so that 64-bit
+        // lanes do not need a 128-bit type.
+        template <std::unsigned_integral T>
+        constexpr auto div_wide(T hi, T d) noexcept -> T {
+            static constexpr auto bits = sizeof(T) * 8;
+            auto q = T{};
+            auto r = hi;
+            for (auto i = 0u; i < bits; ++i) {
+                auto const carry = static_cast<bool>(r >> (bits - 1));
+                r = static_cast<T>(r << 1);
+                q = static_cast<T>(q << 1);
+                if (carry || r >= d) {
+                    r = static_cast<T>(r - d);
+                    q |= 1;
+                }
+            }
+            return q;
+        }
+    } // namespace internal
+
+    /**
+     * @brief Divides vectors by a divisor fixed at construction; exact for every dividend, and
+     * truncates toward zero like the scalar `/`.
+     */
+    template <std::integral T>
+    struct Divider {
+        using value_type = T;
+        using utype = std::make_unsigned_t<T>;
+        static constexpr auto bits = static_cast<unsigned>(sizeof(T) * 8);
+
+        constexpr explicit Divider(T d) noexcept
+            : m_divisor(d)
+        {
+            assert(d != 0 && "division by zero");
+            auto const ad = d < 0 ? static_cast<utype>(utype{} - static_cast<utype>(d)) : static_cast<utype>(d);
+            // ceil(log2(|d|))
+            auto const l = ad == 1 ? 0u : bits - static_cast<unsigned>(std::countl_zero(static_cast<utype>(ad - 1)));
+
+            if constexpr (std::is_unsigned_v<T>) {
+                // m = floor(2^W * (2^l - d) / d) + 1; 2^l - d is taken modulo 2^W for l == W.
+                auto const p = l == bits ? utype{} : static_cast<utype>(utype{1} << l);
+                m_magic = static_cast<utype>(ui::internal::div_wide(static_cast<utype>(p - ad), ad) + 1);
+                m_shift1 = static_cast<std::uint8_t>(std::min(l, 1u));
+                m_shift2 = static_cast<std::uint8_t>(l == 0 ? 0 : l - 1);
+            } else {
+                // m = floor(2^(W + l - 1) / |d|) + 1 - 2^W with l >= 1; the 2^W term vanishes
+                // modulo 2^W and is restored by adding the dividend back.
+                auto const sl = std::max(l, 1u);
+                m_magic = ad == 1
+                    ? utype{1}
+                    : static_cast<utype>(ui::internal::div_wide(static_cast<utype>(utype{1} << (sl - 1)), ad) + 1);
+                m_shift1 = static_cast<std::uint8_t>(sl - 1);
+                m_sign = d < 0 ? T(-1) : T(0);
+            }
+
+            auto const tz = static_cast<unsigned>(std::countr_zero(ad));
+            m_exact_shift = static_cast<std::uint8_t>(tz);
+            m_inverse = maths::BinaryReciprocal{}(static_cast<utype>(ad >> tz));
+        }
+
+        constexpr auto divisor() const noexcept -> T { return m_divisor; }
+
+        /**
+         * @brief Quotient of every lane, truncated toward zero.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto operator()(Vec<N, T> const& n) const noexcept -> Vec<N, T> {
+            if constexpr (std::is_unsigned_v<T>) {
+                auto const t = mul_high(n, Vec<N, T>::load(m_magic));
+                return shift_right(t + shift_right(n - t, m_shift1), m_shift2);
+            } else {
+                auto const q = shift_right(n + mul_high(n, Vec<N, T>::load(static_cast<T>(m_magic))), m_shift1)
+                    - shift_right<bits - 1>(n);
+                return apply_sign(q);
+            }
+        }
+
+        UI_ALWAYS_INLINE auto operator()(T n) const noexcept -> T {
+            return (*this)(Vec<1, T>{ .val = n }).val;
+        }
+
+        /**
+         * @brief Remainder of every lane; has the sign of the dividend like the scalar `%`.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto rem(Vec<N, T> const& n) const noexcept -> Vec<N, T> {
+            return n - (*this)(n) * Vec<N, T>::load(m_divisor);
+        }
+
+        UI_ALWAYS_INLINE auto rem(T n) const noexcept -> T {
+            return rem(Vec<1, T>{ .val = n }).val;
+        }
+
+        /**
+         * @brief Quotient for dividends that are multiples of the divisor; other dividends give an
+         * unspecified result. One shift and one multiplication by the modular inverse of the odd
+         * part of the divisor.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto exact(Vec<N, T> const& n) const noexcept -> Vec<N, T> {
+            auto const q = shift_right(n, m_exact_shift) * Vec<N, T>::load(static_cast<T>(m_inverse));
+            if constexpr (std::is_unsigned_v<T>) return q;
+            else return apply_sign(q);
+        }
+
+        UI_ALWAYS_INLINE auto exact(T n) const noexcept -> T {
+            return exact(Vec<1, T>{ .val = n }).val;
+        }
+
+    private:
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto apply_sign(Vec<N, T> const& q) const noexcept -> Vec<N, T> {
+            auto const s = Vec<N, T>::load(m_sign);
+            return (q ^ s) - s;
+        }
+
+    private:
+        T m_divisor;
+        utype m_magic{};
+        utype m_inverse{};
+        T m_sign{};
+        std::uint8_t m_shift1{};
+        std::uint8_t m_shift2{};
+        std::uint8_t m_exact_shift{};
+    };
+
+} // namespace ui
+
+#endif // AMT_UI_DIVIDER_HPP
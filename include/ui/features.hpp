@@ -117,6 +117,43 @@
     #endif
 #endif
 
+// Hardware float16 <-> float conversion (`vcvtph2ps`/`vcvtps2ph`).
+#ifndef UI_HAS_F16C
+    #if defined(__F16C__)
+        #define UI_HAS_F16C
+    #endif
+
+    #if !defined(UI_HAS_F16C) && defined(UI_COMPILER_MSVC) && defined(__AVX2__)
+        #define UI_HAS_F16C
+    #endif
+#endif
+
+// Pairwise bfloat16 dot product accumulated in float (`vdpbf16ps`, `bfdot`).
+#if !defined(UI_HAS_AVX512_BF16) && defined(__AVX512BF16__)
+    #define UI_HAS_AVX512_BF16
+#endif
+
+#if !defined(UI_ARM_HAS_BF16) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+    #define UI_ARM_HAS_BF16
+#endif
+
+// Four-way 8-bit integer dot product accumulated in 32-bit lanes (`vpdpbusd`, `sdot`/`udot`, `usdot`).
+#if !defined(UI_HAS_AVX512_VNNI) && defined(__AVX512VNNI__)
+    #define UI_HAS_AVX512_VNNI
+#endif
+
+#if !defined(UI_HAS_AVX_VNNI) && defined(__AVXVNNI__)
+    #define UI_HAS_AVX_VNNI
+#endif
+
+#if !defined(UI_ARM_HAS_DOTPROD) && defined(__ARM_FEATURE_DOTPROD)
+    #define UI_ARM_HAS_DOTPROD
+#endif
+
+#if !defined(UI_ARM_HAS_I8MM) && defined(__ARM_FEATURE_MATMUL_INT8)
+    #define UI_ARM_HAS_I8MM
+#endif
+
 #ifdef __SIZEOF_INT128__
     #define UI_HAS_INT128
     namespace ui {
@@ -160,6 +197,21 @@
     #endif
 #endif
 
+#ifndef UI_HAS_ADDRESS_SANITIZER
+    #if defined(__SANITIZE_ADDRESS__)
+        #define UI_HAS_ADDRESS_SANITIZER
+    #elif defined(__has_feature)
+        #if __has_feature(address_sanitizer)
+            #define UI_HAS_ADDRESS_SANITIZER
+        #endif
+    #endif
+#endif
+
+#ifndef UI_PAGE_SIZE
+    // Smallest page size on every supported platform; reads that stay inside one page cannot fault.
+    #define UI_PAGE_SIZE 4096
+#endif
+
 #if INTPTR_MAX == INT64_MAX
     #define UI_ARCH_64BIT
 #else
@@ -93,6 +93,30 @@ namespace ui {
             std::uint8_t mantissa;
         };
 
+        // OCP 8-bit formats. E4M3 has no infinity and a single NaN per sign (S.1111.111), which
+        // frees the rest of the top binade for finite values; E5M2 follows IEEE-754 like float16.
+        template <>
+        struct FloatingPointRep<float8_e4m3> {
+            static constexpr unsigned sign_bits = 1;
+            static constexpr unsigned exponent_bits = 4;
+            static constexpr unsigned mantissa_bits = 3;
+            static constexpr unsigned bias = (1 << exponent_bits) / 2 - 1;
+            bool sign;
+            std::int8_t exponent;
+            std::uint8_t mantissa;
+        };
+
+        template <>
+        struct FloatingPointRep<float8_e5m2> {
+            static constexpr unsigned sign_bits = 1;
+            static constexpr unsigned exponent_bits = 5;
+            static constexpr unsigned mantissa_bits = 2;
+            static constexpr unsigned bias = (1 << exponent_bits) / 2 - 1;
+            bool sign;
+            std::int8_t exponent;
+            std::uint8_t mantissa;
+        };
+
         UI_ALWAYS_INLINE static constexpr auto decompose_fp(float n) noexcept -> FloatingPointRep<float> {
             auto bits = std::bit_cast<std::uint32_t>(n);
             return {
@@ -209,9 +233,10 @@ namespace ui {
             auto exp = ((magic >> 13) - ((127 /*float32 bias*/ - 15 /*float16 bias*/ + 13 /*undo the multiplication of 2^13*/ + 1 /*remove the implicit leading 1*/) << 10));
             // 7. Combine the exponent and rounded mantissa. + is used to allow rounded bit to rollover into exponent bit
             auto f16 = rounded + exp;
-            // 8. if the number could be inf or nan based on mantissa. To preserve the state, we
-            // bitwise-or with the 1 or 0 if it's nan or not. Inf has all the mantissa bits set to 0.
-            data = static_cast<base_type>((sign >> 16) | f16 | (std::isnan(f) ? 1 : 0));
+            // 8. NaN was clamped to infinity in step 3. Restore it as a quiet NaN that keeps the top
+            // of the payload, the same encoding as `vcvtps2ph`.
+            auto nan = std::isnan(f) ? (0x200 | (((bits ^ sign) >> 13) & 0x1FF)) : 0u;
+            data = static_cast<base_type>((sign >> 16) | f16 | nan);
         #undef I
         #undef F
         }
@@ -241,6 +266,8 @@ namespace ui {
             // 3. Check if the number is NaN or Infinity by checking the exponent. If the exponenet
             // has all the bits set then it's one of them.
             auto inf_or_nan = (abs >= (31 << 10)) ? (0xff << 23) : 0u;
+            // NaN is always quiet, the same as `vcvtph2ps`.
+            auto quiet = (abs > (31 << 10)) ? (1u << 22) : 0u;
             // 4. Check if the number is normal or subnormal by check if any of the bits inside the
             // exponent is set or not. If there is not bit set inside exponent, then max value will
             // be the same as the max value when all the bits are set inside the mantissa.
@@ -253,7 +280,7 @@ namespace ui {
             auto norm = ((abs << 13) + ((127 - 15) << 23));
             // 7. Choose the correct normal
             auto finite = is_norm ? norm : sub;
-            return F((sign << 16) | finite | inf_or_nan); 
+            return F((sign << 16) | finite | inf_or_nan | quiet);
         #undef I
         #undef F
         }
@@ -352,10 +379,15 @@ namespace ui {
 
         constexpr bfloat16(float f) noexcept {
             auto temp = std::bit_cast<std::uint32_t>(f);
-            // Rounding-to-even
-            auto rounding_bias = 0x7FFF + ((temp >> 16) & 1);
-            auto mantissa = ((temp + rounding_bias) & 0x7FFFFF) >> 16;
-            temp = (temp >> 16) | mantissa;
+            if (std::isnan(f)) {
+                // Rounding could carry a NaN payload into infinity; keep it a quiet NaN instead.
+                temp = (temp >> 16) | 0x40;
+            } else {
+                // Round to nearest, ties to even. A carry out of the mantissa bumps the exponent,
+                // which rounds the largest finite values to infinity.
+                auto rounding_bias = 0x7FFF + ((temp >> 16) & 1);
+                temp = (temp + rounding_bias) >> 16;
+            }
             data = std::bit_cast<base_type>(static_cast<std::uint16_t>(temp));
         }
 
@@ -442,6 +474,251 @@ namespace ui {
         }
     }
     
+    namespace internal {
+        /**
+         * @brief Rounds `f` to nearest even in the 8-bit format `T` and returns its encoding.
+         * Overflow becomes NaN (E4M3) or infinity (E5M2), or the largest finite value when
+         * `Saturating` is set. NaN is always kept.
+         */
+        template <typename T, bool Saturating = false>
+        UI_ALWAYS_INLINE static constexpr auto float32_to_float8(float f) noexcept -> std::uint8_t {
+            using rep_t = fp::FloatingPointRep<T>;
+            constexpr auto shift = 23u - rep_t::mantissa_bits;
+            constexpr auto min_normal = (127u + 1u - rep_t::bias) << 23;
+            constexpr auto overflow = Saturating ? T::max_rep() : T::overflow_rep();
+
+            auto bits = std::bit_cast<std::uint32_t>(f);
+            auto sign = static_cast<std::uint8_t>((bits >> 24) & 0x80);
+            auto abs = bits & 0x7FFF'FFFF;
+            if (abs > 0x7F80'0000) return sign | T::nan_rep();
+
+            // Fixed point with the 8-bit encoding on top and `shift` bits that rounding drops.
+            std::uint32_t fixed;
+            if (abs < min_normal) {
+                // Subnormal in `T`: scale the step between subnormals up to `1 << shift`. The
+                // truncated fraction is folded into a sticky bit so ties are still exact.
+                auto scaled = std::bit_cast<float>(abs) * std::bit_cast<float>((127u + rep_t::bias + 22u) << 23);
+                fixed = static_cast<std::uint32_t>(scaled);
+                fixed |= static_cast<float>(fixed) < scaled;
+            } else {
+                fixed = abs - ((127u - rep_t::bias) << 23);
+            }
+            // Round to nearest, ties to even; a carry out of the mantissa bumps the exponent.
+            auto code = (fixed + (1u << (shift - 1)) - 1 + ((fixed >> shift) & 1)) >> shift;
+            if (code > T::max_rep()) return sign | overflow;
+            return static_cast<std::uint8_t>(sign | code);
+        }
+
+        /**
+         * @brief Widens the 8-bit encoding `b` of `T` to float; every value is exact.
+         */
+        template <typename T>
+        UI_ALWAYS_INLINE static constexpr auto float8_to_float32(std::uint8_t b) noexcept -> float {
+            using rep_t = fp::FloatingPointRep<T>;
+            constexpr auto shift = 23u - rep_t::mantissa_bits;
+
+            auto sign = static_cast<std::uint32_t>(b & 0x80) << 24;
+            auto mag = static_cast<std::uint32_t>(b & 0x7F);
+            std::uint32_t bits;
+            if (mag > T::max_rep()) {
+                bits = (T::has_infinity && mag == T::overflow_rep()) ? 0x7F80'0000 : 0x7FC0'0000;
+            } else if (mag >= (1u << rep_t::mantissa_bits)) {
+                bits = (mag << shift) + ((127u - rep_t::bias) << 23);
+            } else {
+                // Subnormals are `mag * 2^(1 - bias - mantissa_bits)`.
+                auto scale = std::bit_cast<float>((127u + 1u - rep_t::bias - rep_t::mantissa_bits) << 23);
+                bits = std::bit_cast<std::uint32_t>(static_cast<float>(mag) * scale);
+            }
+            return std::bit_cast<float>(sign | bits);
+        }
+    } // namespace internal
+
+    struct alignas(sizeof(std::uint8_t)) float8_e4m3 {
+        using base_type = std::uint8_t;
+        using fp_rep = fp::FloatingPointRep<float8_e4m3>;
+
+        static constexpr bool has_infinity = false;
+
+        static constexpr auto min_rep() noexcept -> base_type { return 0x08; }
+        static constexpr auto max_rep() noexcept -> base_type { return 0x7E; }
+        static constexpr auto nan_rep() noexcept -> base_type { return 0x7F; }
+        // Encoding of a rounded magnitude that no longer fits; E4M3 has no infinity.
+        static constexpr auto overflow_rep() noexcept -> base_type { return 0x7F; }
+
+        base_type data;
+
+        constexpr float8_e4m3() noexcept = default;
+        constexpr float8_e4m3(float8_e4m3 const&) noexcept = default;
+        constexpr float8_e4m3(float8_e4m3 &&) noexcept = default;
+        constexpr float8_e4m3& operator=(float8_e4m3 const&) noexcept = default;
+        constexpr float8_e4m3& operator=(float8_e4m3 &&) noexcept = default;
+        constexpr ~float8_e4m3() noexcept = default;
+
+        constexpr float8_e4m3(float f) noexcept
+            : data(internal::float32_to_float8<float8_e4m3>(f))
+        {}
+
+        constexpr float8_e4m3(double f) noexcept
+            : float8_e4m3(static_cast<float>(f))
+        {}
+
+        constexpr float8_e4m3(std::convertible_to<float> auto v) noexcept
+            : float8_e4m3(static_cast<float>(v))
+        {}
+
+        explicit constexpr operator float() const noexcept {
+            return internal::float8_to_float32<float8_e4m3>(data);
+        }
+
+        explicit constexpr operator double() const noexcept {
+            return static_cast<double>(static_cast<float>(*this));
+        }
+
+        template <typename T>
+            requires (std::convertible_to<float, T>)
+        explicit constexpr operator T() const noexcept {
+            return static_cast<T>(static_cast<float>(*this));
+        }
+
+        friend constexpr auto operator-(float8_e4m3 val) noexcept -> float8_e4m3 {
+            return std::bit_cast<float8_e4m3>(static_cast<base_type>(val.data ^ 0x80));
+        }
+
+        friend constexpr auto operator==(float8_e4m3 lhs, float8_e4m3 rhs) noexcept -> bool {
+            return float(lhs) == float(rhs);
+        }
+
+        constexpr auto is_nan() const noexcept -> bool {
+            return (data & 0x7F) == nan_rep();
+        }
+
+        constexpr auto is_inf() const noexcept -> bool {
+            return false;
+        }
+
+        constexpr auto is_neg() const noexcept -> bool {
+            return data & 0x80;
+        }
+
+        constexpr auto abs() const noexcept -> float8_e4m3 {
+            return std::bit_cast<float8_e4m3>(static_cast<base_type>(data & 0x7F));
+        }
+    };
+
+    struct alignas(sizeof(std::uint8_t)) float8_e5m2 {
+        using base_type = std::uint8_t;
+        using fp_rep = fp::FloatingPointRep<float8_e5m2>;
+
+        static constexpr bool has_infinity = true;
+
+        static constexpr auto min_rep() noexcept -> base_type { return 0x04; }
+        static constexpr auto max_rep() noexcept -> base_type { return 0x7B; }
+        static constexpr auto nan_rep() noexcept -> base_type { return 0x7E; }
+        // Encoding of a rounded magnitude that no longer fits: infinity.
+        static constexpr auto overflow_rep() noexcept -> base_type { return 0x7C; }
+
+        base_type data;
+
+        constexpr float8_e5m2() noexcept = default;
+        constexpr float8_e5m2(float8_e5m2 const&) noexcept = default;
+        constexpr float8_e5m2(float8_e5m2 &&) noexcept = default;
+        constexpr float8_e5m2& operator=(float8_e5m2 const&) noexcept = default;
+        constexpr float8_e5m2& operator=(float8_e5m2 &&) noexcept = default;
+        constexpr ~float8_e5m2() noexcept = default;
+
+        constexpr float8_e5m2(float f) noexcept
+            : data(internal::float32_to_float8<float8_e5m2>(f))
+        {}
+
+        constexpr float8_e5m2(double f) noexcept
+            : float8_e5m2(static_cast<float>(f))
+        {}
+
+        constexpr float8_e5m2(std::convertible_to<float> auto v) noexcept
+            : float8_e5m2(static_cast<float>(v))
+        {}
+
+        explicit constexpr operator float() const noexcept {
+            return internal::float8_to_float32<float8_e5m2>(data);
+        }
+
+        explicit constexpr operator double() const noexcept {
+            return static_cast<double>(static_cast<float>(*this));
+        }
+
+        template <typename T>
+            requires (std::convertible_to<float, T>)
+        explicit constexpr operator T() const noexcept {
+            return static_cast<T>(static_cast<float>(*this));
+        }
+
+        friend constexpr auto operator-(float8_e5m2 val) noexcept -> float8_e5m2 {
+            return std::bit_cast<float8_e5m2>(static_cast<base_type>(val.data ^ 0x80));
+        }
+
+        friend constexpr auto operator==(float8_e5m2 lhs, float8_e5m2 rhs) noexcept -> bool {
+            return float(lhs) == float(rhs);
+        }
+
+        constexpr auto is_nan() const noexcept -> bool {
+            return (data & 0x7F) > overflow_rep();
+        }
+
+        constexpr auto is_inf() const noexcept -> bool {
+            return (data & 0x7F) == overflow_rep();
+        }
+
+        constexpr auto is_neg() const noexcept -> bool {
+            return data & 0x80;
+        }
+
+        constexpr auto abs() const noexcept -> float8_e5m2 {
+            return std::bit_cast<float8_e5m2>(static_cast<base_type>(data & 0x7F));
+        }
+    };
+
+    namespace fp {
+        UI_ALWAYS_INLINE static constexpr auto decompose_fp(float8_e4m3 fp) noexcept -> FloatingPointRep<float8_e4m3> {
+            auto bits = fp.data;
+            return {
+                .sign = static_cast<bool>(bits >> 7),
+                .exponent = static_cast<std::int8_t>(((bits >> 3) & 0xF) - FloatingPointRep<float8_e4m3>::bias),
+                .mantissa = static_cast<std::uint8_t>(bits & 0x7),
+            };
+        }
+
+        UI_ALWAYS_INLINE static constexpr auto compose_fp(FloatingPointRep<float8_e4m3> fp) noexcept -> float8_e4m3 {
+            int biased_exp = fp.exponent + 7;
+            auto exp_field = static_cast<std::uint8_t>(biased_exp) & 0xF;
+            auto bits = static_cast<std::uint8_t>(
+                (static_cast<std::uint8_t>(fp.sign) << 7) |
+                (exp_field << 3) |
+                (fp.mantissa & 0x7)
+            );
+            return std::bit_cast<float8_e4m3>(bits);
+        }
+
+        UI_ALWAYS_INLINE static constexpr auto decompose_fp(float8_e5m2 fp) noexcept -> FloatingPointRep<float8_e5m2> {
+            auto bits = fp.data;
+            return {
+                .sign = static_cast<bool>(bits >> 7),
+                .exponent = static_cast<std::int8_t>(((bits >> 2) & 0x1F) - FloatingPointRep<float8_e5m2>::bias),
+                .mantissa = static_cast<std::uint8_t>(bits & 0x3),
+            };
+        }
+
+        UI_ALWAYS_INLINE static constexpr auto compose_fp(FloatingPointRep<float8_e5m2> fp) noexcept -> float8_e5m2 {
+            int biased_exp = fp.exponent + 15;
+            auto exp_field = static_cast<std::uint8_t>(biased_exp) & 0x1F;
+            auto bits = static_cast<std::uint8_t>(
+                (static_cast<std::uint8_t>(fp.sign) << 7) |
+                (exp_field << 2) |
+                (fp.mantissa & 0x3)
+            );
+            return std::bit_cast<float8_e5m2>(bits);
+        }
+    }
+
     template <std::size_t N>
     static inline auto cast_float32_to_float16(
         Vec<N, float> const& v
@@ -462,6 +739,13 @@ namespace ui {
         Vec<N, bfloat16> const& v
     ) noexcept -> Vec<N, float>;
 
+    namespace internal {
+        // Every conversion to or from `float8_e4m3`/`float8_e5m2`; each architecture's `cast` and
+        // `sat_cast` forward to it.
+        template <typename To, bool Saturating, std::size_t N, typename From>
+        static inline auto cast_float8(Vec<N, From> const& v) noexcept -> Vec<N, To>;
+    }
+
     
     constexpr bool isnan(float16 val) noexcept {
         return val.is_nan();
@@ -513,6 +797,30 @@ namespace ui {
         return val.abs();
     }
 
+    template <typename T>
+        requires (std::same_as<T, float8_e4m3> || std::same_as<T, float8_e5m2>)
+    constexpr bool isnan(T val) noexcept {
+        return val.is_nan();
+    }
+
+    template <typename T>
+        requires (std::same_as<T, float8_e4m3> || std::same_as<T, float8_e5m2>)
+    constexpr bool isinf(T val) noexcept {
+        return val.is_inf();
+    }
+
+    template <typename T>
+        requires (std::same_as<T, float8_e4m3> || std::same_as<T, float8_e5m2>)
+    constexpr bool signbit(T val) noexcept {
+        return val.is_neg();
+    }
+
+    template <typename T>
+        requires (std::same_as<T, float8_e4m3> || std::same_as<T, float8_e5m2>)
+    constexpr T abs(T val) noexcept {
+        return val.abs();
+    }
+
 } // namespace ui
 
 #include <format>
@@ -536,6 +844,24 @@ namespace std {
     template <>
     struct is_arithmetic<ui::bfloat16>: std::true_type{};
 
+    template <>
+    struct is_floating_point<ui::float8_e4m3>: std::true_type{};
+
+    template <>
+    struct is_signed<ui::float8_e4m3>: std::true_type{};
+
+    template <>
+    struct is_arithmetic<ui::float8_e4m3>: std::true_type{};
+
+    template <>
+    struct is_floating_point<ui::float8_e5m2>: std::true_type{};
+
+    template <>
+    struct is_signed<ui::float8_e5m2>: std::true_type{};
+
+    template <>
+    struct is_arithmetic<ui::float8_e5m2>: std::true_type{};
+
     template <>
     class numeric_limits<ui::float16> {
         using type = ui::float16;
@@ -635,6 +961,55 @@ namespace std {
         static constexpr const float_round_style round_style = numeric_limits<float>::round_style;
     };
 
+    template <typename T>
+        requires (same_as<T, ui::float8_e4m3> || same_as<T, ui::float8_e5m2>)
+    class numeric_limits<T> {
+        using type = T;
+        using rep_t = ui::fp::FloatingPointRep<T>;
+    public:
+        static constexpr const bool is_specialized = true;
+        static constexpr const bool is_signed   = true;
+        static constexpr const int digits       = rep_t::mantissa_bits + 1;
+        static constexpr const int digits10     = 0;
+        static constexpr const int max_digits10 = 2 + (digits * 30103l) / 100000l;
+        static constexpr type min() noexcept { return bit_cast<type>(type::min_rep()); }
+        static constexpr type max() noexcept { return bit_cast<type>(type::max_rep()); }
+        static constexpr type lowest() noexcept { return -max(); }
+
+        static constexpr const bool is_integer = false;
+        static constexpr const bool is_exact   = false;
+        static constexpr const int radix       = 2;
+        static constexpr const int min_exponent   = 2 - static_cast<int>(rep_t::bias);
+        static constexpr const int min_exponent10 = same_as<T, ui::float8_e4m3> ? -1 : -4;
+        static constexpr const int max_exponent   = same_as<T, ui::float8_e4m3> ? 9 : 16;
+        static constexpr const int max_exponent10 = same_as<T, ui::float8_e4m3> ? 2 : 4;
+        static constexpr type epsilon() noexcept { return bit_cast<type>(static_cast<uint8_t>((rep_t::bias - rep_t::mantissa_bits) << rep_t::mantissa_bits)); }
+        static constexpr type round_error() noexcept { return 0.5f; }
+        static constexpr type denorm_min() noexcept { return bit_cast<type>(uint8_t(1)); }
+
+        static constexpr const bool has_infinity        = type::has_infinity;
+        static constexpr const bool has_quiet_NaN       = true;
+        static constexpr const bool has_signaling_NaN   = false;
+        static constexpr type infinity() noexcept { return bit_cast<type>(type::overflow_rep()); }
+        static constexpr type quiet_NaN() noexcept { return bit_cast<type>(type::nan_rep()); }
+
+        static constexpr const bool is_iec559  = false;
+        static constexpr const bool is_bounded = true;
+        static constexpr const bool is_modulo  = false;
+
+        static constexpr const bool traps = false;
+        static constexpr const bool tinyness_before = false;
+        static constexpr const float_round_style round_style = round_to_nearest;
+    };
+
+    template <typename T>
+        requires (same_as<T, ui::float8_e4m3> || same_as<T, ui::float8_e5m2>)
+    struct formatter<T>: formatter<float> {
+        auto format(T val, auto& ctx) const {
+            return formatter<float>::format(static_cast<float>(val), ctx);
+        }
+    };
+
     template <>
     struct formatter<ui::float16>: formatter<float> {
         auto format(ui::float16 val, auto& ctx) const {
@@ -8,7 +8,10 @@
 #include <concepts>
 #include <format>
 #include <iterator>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace std {
     template <std::size_t N, typename T>
@@ -143,16 +146,100 @@ namespace std {
             format_to(out, "\tMemory Size: {}\n", humanize_size(info.mem));
             format_to(out, "\tCache Line Size: {}\n", humanize_size(info.cacheline));
             format_to(out, "\tCache: [");
-            for (auto [l, s]: info.cache) {
-                format_to(out, "(Level: {}, Size: {}), ", l, humanize_size(s));
+            for (auto const& c: info.cache) {
+                format_to(out, "(Level: {}, Size: {}, Shared By: {}), ", c.level, humanize_size(c.size), c.shared_by);
             }
             format_to(out, "]\n");
 
             format_to(out, "\tInstruction Cache: [");
-            for (auto [l, s]: info.icache) {
-                format_to(out, "(Level: {}, Size: {}), ", l, humanize_size(s));
+            for (auto const& c: info.icache) {
+                format_to(out, "(Level: {}, Size: {}, Shared By: {}), ", c.level, humanize_size(c.size), c.shared_by);
             }
             format_to(out, "]\n");
+            format_to(out, "\tCores: (Physical: {}, Logical: {})\n", info.physical_cores, info.logical_cores);
+            format_to(out, "\tNUMA Nodes: {}\n", info.numa_nodes);
+
+            using features_t = ui::CpuFeatures;
+            constexpr std::pair<std::string_view, bool features_t::*> features[] = {
+                { "sse2", &features_t::sse2 },
+                { "sse3", &features_t::sse3 },
+                { "ssse3", &features_t::ssse3 },
+                { "sse4.1", &features_t::sse41 },
+                { "sse4.2", &features_t::sse42 },
+                { "popcnt", &features_t::popcnt },
+                { "avx", &features_t::avx },
+                { "avx2", &features_t::avx2 },
+                { "fma", &features_t::fma },
+                { "f16c", &features_t::f16c },
+                { "bmi1", &features_t::bmi1 },
+                { "bmi2", &features_t::bmi2 },
+                { "lzcnt", &features_t::lzcnt },
+                { "avx512f", &features_t::avx512f },
+                { "avx512dq", &features_t::avx512dq },
+                { "avx512cd", &features_t::avx512cd },
+                { "avx512bw", &features_t::avx512bw },
+                { "avx512vl", &features_t::avx512vl },
+                { "avx512vnni", &features_t::avx512vnni },
+                { "avx512bf16", &features_t::avx512bf16 },
+                { "avx512fp16", &features_t::avx512fp16 },
+                { "avxvnni", &features_t::avxvnni },
+                { "neon", &features_t::neon },
+                { "neon-fp16", &features_t::neon_fp16 },
+                { "neon-dotprod", &features_t::neon_dotprod },
+                { "neon-bf16", &features_t::neon_bf16 },
+                { "neon-i8mm", &features_t::neon_i8mm },
+                { "sve", &features_t::sve },
+                { "simd128", &features_t::simd128 },
+            };
+            format_to(out, "\tFeatures: [");
+            for (auto [name, flag]: features) {
+                if (info.features.*flag) format_to(out, "{}, ", name);
+            }
+            format_to(out, "]\n");
+            return format_to(out, "}}");
+        }
+    };
+
+    template <>
+    struct formatter<ui::CpuTopology> {
+        constexpr auto parse(format_parse_context& ctx) {
+            return ctx.begin();
+        }
+
+        auto format(ui::CpuTopology const& topo, auto& ctx) const {
+            auto&& out = ctx.out();
+            auto const print_cpus = [&out](std::vector<unsigned> const& cpus) {
+                format_to(out, "[");
+                for (auto i = 0ul; i < cpus.size(); ++i) {
+                    format_to(out, "{}{}", cpus[i], (i + 1 == cpus.size() ? "" : ", "));
+                }
+                format_to(out, "]");
+            };
+
+            format_to(out, "{{\n");
+            format_to(out, "\tCores: [\n");
+            for (auto const& c: topo.cores) {
+                format_to(out, "\t\t(Id: {}, Package: {}, Node: {}, Cpus: ", c.id, c.package, c.node);
+                print_cpus(c.cpus);
+                format_to(out, "),\n");
+            }
+            format_to(out, "\t]\n");
+
+            format_to(out, "\tCaches: [\n");
+            for (auto const& c: topo.caches) {
+                format_to(out, "\t\t(Level: {}, Size: {}B, Line: {}B, Cpus: ", c.level, c.size, c.line_size);
+                print_cpus(c.cpus);
+                format_to(out, "),\n");
+            }
+            format_to(out, "\t]\n");
+
+            format_to(out, "\tNodes: [\n");
+            for (auto const& n: topo.nodes) {
+                format_to(out, "\t\t(Id: {}, Memory: {}B, Cpus: ", n.id, n.mem);
+                print_cpus(n.cpus);
+                format_to(out, "),\n");
+            }
+            format_to(out, "\t]\n");
             return format_to(out, "}}");
         }
     };
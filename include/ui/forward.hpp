@@ -12,6 +12,10 @@ namespace ui {
     struct alignas(sizeof(std::uint16_t)) float16;
     
     struct alignas(sizeof(std::uint16_t)) bfloat16;
+
+    struct alignas(sizeof(std::uint8_t)) float8_e4m3;
+
+    struct alignas(sizeof(std::uint8_t)) float8_e5m2;
 } // namespace ui
 
 #endif // AMT_UI_FORWARD_HPP
@@ -0,0 +1,429 @@
+#ifndef AMT_UI_GEMM_HPP
+#define AMT_UI_GEMM_HPP
+
+#include "arch/cpu_info.hpp"
+#include "base_vec.hpp"
+#include "float.hpp"
+#include "matrix.hpp"
+#include "vec_op.hpp"
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Matrix multiplication
+// ---------------------
+// `C = A * B` (or `C += A * B`) for row-major matrices, in the blocked layout of Goto and BLIS:
+//
+//     for jc in n by nc:             B block  kc x nc  packed once, stays in L3
+//       for pc in k by kc:
+//         for ic in m by mc:         A block  mc x kc  packed once, stays in L2
+//           for jr in nc by NR:      B panel  kc x NR  stays in L1
+//             for ir in mc by MR:    MR x NR tile accumulated in registers by `gemm_kernel`
+//
+// Packing copies each panel into the order the micro-kernel reads it and pads partial panels
+// with zeros, so the kernel never branches on edges; only the final store of a tile is masked.
+// The block sizes come from the cache sizes reported by `cpu_info()`.
+//
+// Supported operand types:
+//     float x float        -> float
+//     double x double      -> double
+//     float16 / bfloat16   -> float    operands are widened while packing
+//     int8 / uint8         -> int32    (`uint32_t` for uint8 x uint8); sums wrap on overflow
+//
+//     ui::gemm(std::span(a), std::span(b), std::span(c), { .m = 64, .n = 128, .k = 256 });
+
+namespace ui {
+
+    /**
+     * @brief Dimensions of `C (m x n) = A (m x k) * B (k x n)`. A leading dimension of zero
+     * means the matrix is densely packed (`k`, `n` and `n`). With `accumulate` the product is
+     * added to `C` instead of replacing it.
+     */
+    struct GemmShape {
+        std::size_t m;
+        std::size_t n;
+        std::size_t k;
+        std::size_t lda{};
+        std::size_t ldb{};
+        std::size_t ldc{};
+        bool accumulate{false};
+    };
+
+    // Cache block sizes of the packed driver, in elements.
+    struct GemmBlocking {
+        std::size_t mc; // rows of the packed A block
+        std::size_t nc; // columns of the packed B block
+        std::size_t kc; // depth of both packed blocks
+    };
+
+    namespace internal {
+        template <typename L, typename R>
+        struct GemmTraits;
+
+        template <typename T>
+            requires (std::same_as<T, float> || std::same_as<T, double>)
+        struct GemmTraits<T, T> {
+            using acc_t = T;
+            using lhs_t = T;
+            using rhs_t = T;
+            // Depth consumed by one kernel step.
+            static constexpr std::size_t group = 1;
+            static constexpr std::size_t mr = 6;
+        };
+
+        template <typename T>
+            requires is_fp16<T>
+        struct GemmTraits<T, T> {
+            using acc_t = float;
+            using lhs_t = float;
+            using rhs_t = float;
+            static constexpr std::size_t group = 1;
+            static constexpr std::size_t mr = 6;
+        };
+
+        template <typename L, typename R>
+            requires (is_byte_int<L> && is_byte_int<R>)
+        struct GemmTraits<L, R> {
+            using acc_t = std::conditional_t<std::is_signed_v<L> || std::is_signed_v<R>, std::int32_t, std::uint32_t>;
+            using lhs_t = L;
+            using rhs_t = R;
+            // `dot_acc` sums four products into every lane.
+            static constexpr std::size_t group = 4;
+            // Keeps the widening fallback of `dot_acc` within sixteen registers.
+            static constexpr std::size_t mr = 4;
+        };
+
+        template <typename L, typename R>
+        concept gemm_operands = requires { typename GemmTraits<L, R>::acc_t; };
+
+        // Two native registers per tile row.
+        template <typename L, typename R>
+        inline constexpr std::size_t gemm_nr = 2 * std::max<std::size_t>(16 * native::NativeSizeFactor / sizeof(typename GemmTraits<L, R>::acc_t), 1);
+
+        template <typename L, typename R>
+        inline constexpr std::size_t gemm_mr = GemmTraits<L, R>::mr;
+
+        UI_ALWAYS_INLINE constexpr auto gemm_round_up(std::size_t n, std::size_t m) noexcept -> std::size_t {
+            return (n + m - 1) / m * m;
+        }
+
+        // A micro-panel (`MR x kc`) and a B micro-panel (`kc x NR`) share half of L1, a packed A
+        // block takes half of L2 and a packed B block half of L3; the other halves are left for
+        // `C` and whatever the caller keeps warm.
+        constexpr auto make_gemm_blocking(
+            CacheLevels const& cache,
+            std::size_t mr,
+            std::size_t nr,
+            std::size_t lhs_bytes,
+            std::size_t rhs_bytes
+        ) noexcept -> GemmBlocking {
+            auto const l1 = std::size_t{cache.at_level(1) ? cache.at_level(1) : 32u * 1024u};
+            auto const l2 = std::size_t{cache.at_level(2) ? cache.at_level(2) : 256u * 1024u};
+            auto const l3 = std::size_t{cache.at_level(3) ? cache.at_level(3) : 4 * l2};
+
+            // Multiples of 8 keep every block but the last aligned to the 4-deep integer groups.
+            auto const kc = std::max<std::size_t>(l1 / 2 / (mr * lhs_bytes + nr * rhs_bytes) / 8 * 8, 8);
+            auto const mc = std::max<std::size_t>(l2 / 2 / (kc * lhs_bytes) / mr * mr, mr);
+            auto const nc = std::max<std::size_t>(l3 / 2 / (kc * rhs_bytes) / nr * nr, nr);
+            return { .mc = mc, .nc = nc, .kc = kc };
+        }
+    } // namespace internal
+
+    /**
+     * @brief Block sizes used by `gemm` for the given operand types, derived once from the cache
+     * sizes of `cpu_info()`.
+     */
+    template <typename L, typename R = L>
+        requires ui::internal::gemm_operands<L, R>
+    inline auto gemm_blocking() noexcept -> GemmBlocking {
+        using traits = ui::internal::GemmTraits<L, R>;
+        static auto const res = ui::internal::make_gemm_blocking(
+            cpu_info().cache,
+            ui::internal::gemm_mr<L, R>,
+            ui::internal::gemm_nr<L, R>,
+            sizeof(typename traits::lhs_t),
+            sizeof(typename traits::rhs_t)
+        );
+        return res;
+    }
+
+// MARK: Micro-kernel
+    namespace internal {
+        // Helpers take the row indices as a pack so the rows of a tile are unrolled without a
+        // lambda the compiler may decide not to inline.
+        template <std::size_t MR, std::size_t NR, typename T, std::size_t... Is>
+        UI_ALWAYS_INLINE auto gemm_zero_tile(std::index_sequence<Is...>) noexcept -> VecMat<MR, NR, T> {
+            auto res = VecMat<MR, NR, T>{};
+            ((res.val[Is] = Vec<NR, T>::load(T{})), ...);
+            return res;
+        }
+
+        template <std::size_t MR, std::size_t NR, typename T, std::size_t... Is>
+        UI_ALWAYS_INLINE auto gemm_fma_step(
+            VecMat<MR, NR, T>& acc,
+            T const* UI_RESTRICT pa,
+            Vec<NR, T> const& b,
+            std::index_sequence<Is...>
+        ) noexcept -> void {
+            ((acc.val[Is] = ui::fused_mul_acc(acc.val[Is], Vec<NR, T>::load(pa[Is]), b, op::add_t{})), ...);
+        }
+
+        // Broadcasts four consecutive bytes to every 32-bit lane.
+        template <std::size_t NR, typename L>
+        UI_ALWAYS_INLINE auto gemm_broadcast_quad(L const* UI_RESTRICT p) noexcept -> Vec<4 * NR, L> {
+            auto bits = std::uint32_t{};
+            std::memcpy(&bits, p, sizeof(bits));
+            return ui::rcast<L>(Vec<NR, std::uint32_t>::load(bits));
+        }
+
+        template <std::size_t MR, std::size_t NR, typename A, typename L, typename R, std::size_t... Is>
+        UI_ALWAYS_INLINE auto gemm_dot_step(
+            VecMat<MR, NR, A>& acc,
+            L const* UI_RESTRICT pa,
+            Vec<4 * NR, R> const& b,
+            std::index_sequence<Is...>
+        ) noexcept -> void {
+            ((acc.val[Is] = ui::dot_acc(acc.val[Is], gemm_broadcast_quad<NR>(pa + 4 * Is), b)), ...);
+        }
+    } // namespace internal
+
+    /**
+     * @brief Multiplies a packed `MR x kc` panel of A with a packed `kc x NR` panel of B and
+     * returns the `MR x NR` product. `pa` holds `MR` values per depth step and `pb` holds `NR`;
+     * every step broadcasts one value of A per row and issues one `fused_mul_acc` per row.
+     */
+    template <std::size_t MR, std::size_t NR, std::floating_point T>
+    UI_ALWAYS_INLINE auto gemm_kernel(
+        std::size_t kc,
+        T const* UI_RESTRICT pa,
+        T const* UI_RESTRICT pb
+    ) noexcept -> VecMat<MR, NR, T> {
+        static constexpr auto rows = std::make_index_sequence<MR>{};
+        auto acc = ui::internal::gemm_zero_tile<MR, NR, T>(rows);
+        for (auto p = std::size_t{}; p < kc; ++p, pa += MR, pb += NR) {
+            ui::internal::gemm_fma_step(acc, pa, Vec<NR, T>::load(pb, NR), rows);
+        }
+        return acc;
+    }
+
+    /**
+     * @brief 8-bit integer version of `gemm_kernel`. Each step covers a depth of four: `pa` holds
+     * four consecutive values of every row of A and `pb` four of every column of B, and one
+     * `dot_acc` per row adds the four products of every lane.
+     */
+    template <std::size_t MR, std::size_t NR, typename A, typename L, typename R>
+        requires ui::internal::int8_dot<A, L, R>
+    UI_ALWAYS_INLINE auto gemm_kernel(
+        std::size_t kq,
+        L const* UI_RESTRICT pa,
+        R const* UI_RESTRICT pb
+    ) noexcept -> VecMat<MR, NR, A> {
+        static constexpr auto rows = std::make_index_sequence<MR>{};
+        auto acc = ui::internal::gemm_zero_tile<MR, NR, A>(rows);
+        for (auto q = std::size_t{}; q < kq; ++q, pa += 4 * MR, pb += 4 * NR) {
+            ui::internal::gemm_dot_step(acc, pa, Vec<4 * NR, R>::load(pb, 4 * NR), rows);
+        }
+        return acc;
+    }
+// !MARK
+
+// MARK: Packing
+    namespace internal {
+        // Packs `rows x depth` of A into micro-panels of `MR` rows; within a panel the values of
+        // one depth group are contiguous for all rows, and missing rows and depth are zero.
+        template <std::size_t MR, std::size_t G, typename P, typename T>
+        UI_ALWAYS_INLINE auto gemm_pack_a(
+            T const* UI_RESTRICT a,
+            std::size_t lda,
+            std::size_t rows,
+            std::size_t depth,
+            P* UI_RESTRICT out
+        ) noexcept -> void {
+            auto const kp = gemm_round_up(depth, G);
+            for (auto ir = std::size_t{}; ir < rows; ir += MR) {
+                auto const mr = std::min(MR, rows - ir);
+                for (auto p = std::size_t{}; p < kp; p += G) {
+                    for (auto i = std::size_t{}; i < MR; ++i) {
+                        for (auto g = std::size_t{}; g < G; ++g) {
+                            auto const in_range = i < mr && p + g < depth;
+                            out[i * G + g] = in_range ? static_cast<P>(a[(ir + i) * lda + p + g]) : P{};
+                        }
+                    }
+                    out += MR * G;
+                }
+            }
+        }
+
+        // Packs `depth x cols` of B into micro-panels of `NR` columns; every depth step of a panel
+        // is one `NR`-lane register, or `NR` groups of `G` values for the integer kernel.
+        template <std::size_t NR, std::size_t G, typename P, typename T>
+        UI_ALWAYS_INLINE auto gemm_pack_b(
+            T const* UI_RESTRICT b,
+            std::size_t ldb,
+            std::size_t depth,
+            std::size_t cols,
+            P* UI_RESTRICT out
+        ) noexcept -> void {
+            auto const kp = gemm_round_up(depth, G);
+            for (auto jr = std::size_t{}; jr < cols; jr += NR) {
+                auto const nr = std::min(NR, cols - jr);
+                if constexpr (G == 1) {
+                    for (auto p = std::size_t{}; p < depth; ++p, out += NR) {
+                        auto row = ui::masked_load<NR>(b + p * ldb + jr, nr);
+                        if constexpr (std::same_as<T, P>) row.store(out, NR);
+                        else ui::cast<P>(row).store(out, NR);
+                    }
+                } else {
+                    for (auto p = std::size_t{}; p < kp; p += G, out += NR * G) {
+                        for (auto j = std::size_t{}; j < NR; ++j) {
+                            for (auto g = std::size_t{}; g < G; ++g) {
+                                auto const in_range = j < nr && p + g < depth;
+                                out[j * G + g] = in_range ? static_cast<P>(b[(p + g) * ldb + jr + j]) : P{};
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Writes the top-left `rows x cols` of a tile, adding it to `C` unless `overwrite`.
+        template <std::size_t MR, std::size_t NR, typename T>
+        UI_ALWAYS_INLINE auto gemm_store(
+            VecMat<MR, NR, T> const& tile,
+            T* UI_RESTRICT c,
+            std::size_t ldc,
+            std::size_t rows,
+            std::size_t cols,
+            bool overwrite
+        ) noexcept -> void {
+            for (auto i = std::size_t{}; i < rows; ++i, c += ldc) {
+                auto v = tile.val[i];
+                if (cols >= NR) {
+                    if (!overwrite) v = v + Vec<NR, T>::load(c, NR);
+                    v.store(c, NR);
+                } else {
+                    if (!overwrite) v = v + ui::masked_load<NR>(c, cols);
+                    ui::masked_store(c, v, cols);
+                }
+            }
+        }
+
+        template <typename L, typename R>
+        auto gemm_impl(
+            L const* UI_RESTRICT a,
+            R const* UI_RESTRICT b,
+            typename GemmTraits<L, R>::acc_t* UI_RESTRICT c,
+            GemmShape const& s,
+            GemmBlocking const& blocking
+        ) -> void {
+            using traits = GemmTraits<L, R>;
+            using acc_t = typename traits::acc_t;
+            using lhs_t = typename traits::lhs_t;
+            using rhs_t = typename traits::rhs_t;
+            static constexpr auto MR = gemm_mr<L, R>;
+            static constexpr auto NR = gemm_nr<L, R>;
+            static constexpr auto G = traits::group;
+
+            auto const mc = std::max(blocking.mc / MR * MR, MR);
+            auto const nc = std::max(blocking.nc / NR * NR, NR);
+            auto const kc = std::max(blocking.kc / G * G, G);
+
+            auto const m_block = std::min(mc, gemm_round_up(s.m, MR));
+            auto const n_block = std::min(nc, gemm_round_up(s.n, NR));
+            auto const k_block = std::min(kc, gemm_round_up(s.k, G));
+            auto pa = std::vector<lhs_t>(m_block * k_block);
+            auto pb = std::vector<rhs_t>(k_block * n_block);
+
+            for (auto jc = std::size_t{}; jc < s.n; jc += nc) {
+                auto const nb = std::min(nc, s.n - jc);
+                for (auto pc = std::size_t{}; pc < s.k; pc += kc) {
+                    auto const kb = std::min(kc, s.k - pc);
+                    auto const kp = gemm_round_up(kb, G);
+                    // The first depth block replaces `C`, later ones add to it.
+                    auto const overwrite = pc == 0 && !s.accumulate;
+                    gemm_pack_b<NR, G>(b + pc * s.ldb + jc, s.ldb, kb, nb, pb.data());
+
+                    for (auto ic = std::size_t{}; ic < s.m; ic += mc) {
+                        auto const mb = std::min(mc, s.m - ic);
+                        gemm_pack_a<MR, G>(a + ic * s.lda + pc, s.lda, mb, kb, pa.data());
+
+                        for (auto jr = std::size_t{}; jr < nb; jr += NR) {
+                            auto const panel_b = pb.data() + jr * kp;
+                            for (auto ir = std::size_t{}; ir < mb; ir += MR) {
+                                auto const panel_a = pa.data() + ir * kp;
+                                auto const tile = [&] {
+                                    if constexpr (G == 1) return gemm_kernel<MR, NR>(kp, panel_a, panel_b);
+                                    else return gemm_kernel<MR, NR, acc_t>(kp / G, panel_a, panel_b);
+                                }();
+                                gemm_store(
+                                    tile,
+                                    c + (ic + ir) * s.ldc + jc + jr,
+                                    s.ldc,
+                                    std::min(MR, mb - ir),
+                                    std::min(NR, nb - jr),
+                                    overwrite
+                                );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } // namespace internal
+// !MARK
+
+// MARK: GEMM
+    /**
+     * @brief Row-major `C = A * B`, or `C += A * B` with `shape.accumulate`. `A` is `m x k`,
+     * `B` is `k x n` and `C` is `m x n`; `C` must be `float`, `double`, or the 32-bit integer
+     * accumulator of the 8-bit operands. Packing buffers are allocated once per call.
+     */
+    template <typename T0, typename T1, typename U>
+        requires (
+            ui::internal::gemm_operands<std::remove_cv_t<T0>, std::remove_cv_t<T1>> &&
+            std::same_as<U, typename ui::internal::GemmTraits<std::remove_cv_t<T0>, std::remove_cv_t<T1>>::acc_t>
+        )
+    auto gemm(
+        std::span<T0> a,
+        std::span<T1> b,
+        std::span<U> c,
+        GemmShape shape,
+        GemmBlocking const& blocking = gemm_blocking<std::remove_cv_t<T0>, std::remove_cv_t<T1>>()
+    ) -> void {
+        if (shape.lda == 0) shape.lda = shape.k;
+        if (shape.ldb == 0) shape.ldb = shape.n;
+        if (shape.ldc == 0) shape.ldc = shape.n;
+        if (shape.m == 0 || shape.n == 0) return;
+        assert(shape.lda >= shape.k && shape.ldb >= shape.n && shape.ldc >= shape.n);
+        assert(c.size() >= (shape.m - 1) * shape.ldc + shape.n);
+
+        if (shape.k == 0) {
+            if (shape.accumulate) return;
+            for (auto i = std::size_t{}; i < shape.m; ++i) {
+                std::fill_n(c.data() + i * shape.ldc, shape.n, U{});
+            }
+            return;
+        }
+        assert(a.size() >= (shape.m - 1) * shape.lda + shape.k);
+        assert(b.size() >= (shape.k - 1) * shape.ldb + shape.n);
+
+        ui::internal::gemm_impl(
+            static_cast<std::remove_cv_t<T0> const*>(a.data()),
+            static_cast<std::remove_cv_t<T1> const*>(b.data()),
+            c.data(),
+            shape,
+            blocking
+        );
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_GEMM_HPP
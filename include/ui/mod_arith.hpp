@@ -0,0 +1,282 @@
+#ifndef AMT_UI_MOD_ARITH_HPP
+#define AMT_UI_MOD_ARITH_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "modular_inv.hpp"
+#include "algorithm.hpp"
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Modular arithmetic
+// ------------------
+// `ModArith` keeps values in Montgomery form, `x * R mod m` with `R = 2^W`, so that a modular
+// product is one `mul_wide` followed by a reduction that only needs `mul`, `mul_high` and a
+// conditional add (REDC):
+//
+//     q = lo(a * b) * m^-1 mod R;  r = hi(a * b) - mul_high(q, m);  r += r < 0 ? m : 0
+//
+// The inverse `m^-1 mod R` comes from `BinaryReciprocal`, hence the modulus has to be odd. Every
+// operand is expected to be reduced (`< m`); `reduce` brings arbitrary values into range with a
+// Barrett reduction.
+//
+//     auto const ma = ui::ModArith<std::uint32_t>(998244353);
+//     auto x = ma.to_mont(v);
+//     auto y = ma.from_mont(ma.pow(x, 5)); // v^5 mod m
+//
+// `NTT` is a radix-2 number theoretic transform over `ModArith`. The twiddles are kept in
+// Montgomery form, so a Montgomery product with a twiddle takes and returns plain values and the
+// data never has to be converted.
+
+namespace ui {
+
+    namespace internal {
+        // (a + b) mod m for a, b < m without overflowing.
+        template <std::unsigned_integral T>
+        constexpr auto add_mod(T a, T b, T m) noexcept -> T {
+            auto const t = static_cast<T>(m - b);
+            return a >= t ? static_cast<T>(a - t) : static_cast<T>(a + b);
+        }
+    } // namespace internal
+
+    /**
+     * @brief Montgomery and Barrett arithmetic modulo an odd runtime modulus on unsigned 32 and
+     * 64-bit lanes.
+     */
+    template <std::unsigned_integral T>
+        requires (sizeof(T) == 4 || sizeof(T) == 8)
+    struct ModArith {
+        using value_type = T;
+        static constexpr auto bits = static_cast<unsigned>(sizeof(T) * 8);
+
+        constexpr explicit ModArith(T m) noexcept
+            : m_mod(m)
+        {
+            assert((m & 1) && m > 1 && "modulus should be odd and greater than one");
+            m_inv = maths::BinaryReciprocal{}(m);
+            // R mod m, then R^2 mod m by doubling W times.
+            m_r1 = static_cast<T>(T{} - m) % m;
+            m_r2 = m_r1;
+            for (auto i = 0u; i < bits; ++i) m_r2 = ui::internal::add_mod(m_r2, m_r2, m);
+            // floor(2^W / m); m is odd, so it never divides 2^W.
+            m_barrett = static_cast<T>(static_cast<T>(~T{}) / m);
+        }
+
+        constexpr auto modulus() const noexcept -> T { return m_mod; }
+
+        /**
+         * @brief One in Montgomery form.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto one() const noexcept -> Vec<N, T> {
+            return Vec<N, T>::load(m_r1);
+        }
+
+        /**
+         * @brief `x mod m` for any `x`.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto reduce(Vec<N, T> const& x) const noexcept -> Vec<N, T> {
+            auto const m = Vec<N, T>::load(m_mod);
+            // The estimate is at most one short, so the remainder is below 2m.
+            auto const q = mul_high(x, Vec<N, T>::load(m_barrett));
+            auto const r = x - q * m;
+            return bitwise_select(r >= m, r - m, r);
+        }
+
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto to_mont(Vec<N, T> const& x) const noexcept -> Vec<N, T> {
+            return mul(x, Vec<N, T>::load(m_r2));
+        }
+
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto from_mont(Vec<N, T> const& x) const noexcept -> Vec<N, T> {
+            return redc(x, Vec<N, T>::load(T{}));
+        }
+
+        /**
+         * @brief Montgomery product `a * b / R mod m`. The product of a Montgomery value and a
+         * plain value is plain.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto mul(Vec<N, T> const& a, Vec<N, T> const& b) const noexcept -> Vec<N, T> {
+            auto const [lo, hi] = mul_wide(a, b);
+            return redc(lo, hi);
+        }
+
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto add(Vec<N, T> const& a, Vec<N, T> const& b) const noexcept -> Vec<N, T> {
+            auto const t = Vec<N, T>::load(m_mod) - b;
+            return bitwise_select(a >= t, a - t, a + b);
+        }
+
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto sub(Vec<N, T> const& a, Vec<N, T> const& b) const noexcept -> Vec<N, T> {
+            auto const r = a - b;
+            return bitwise_select(a < b, r + Vec<N, T>::load(m_mod), r);
+        }
+
+        /**
+         * @brief `x^e` in Montgomery form, by squaring and multiplying; every lane shares the
+         * exponent.
+         */
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto pow(Vec<N, T> x, T e) const noexcept -> Vec<N, T> {
+            auto res = one<N>();
+            while (e) {
+                if (e & 1) res = mul(res, x);
+                x = mul(x, x);
+                e >>= 1;
+            }
+            return res;
+        }
+
+        UI_ALWAYS_INLINE auto reduce(T x) const noexcept -> T { return reduce(Vec<1, T>{ .val = x }).val; }
+        UI_ALWAYS_INLINE auto to_mont(T x) const noexcept -> T { return to_mont(Vec<1, T>{ .val = x }).val; }
+        UI_ALWAYS_INLINE auto from_mont(T x) const noexcept -> T { return from_mont(Vec<1, T>{ .val = x }).val; }
+        UI_ALWAYS_INLINE auto mul(T a, T b) const noexcept -> T { return mul(Vec<1, T>{ .val = a }, Vec<1, T>{ .val = b }).val; }
+        UI_ALWAYS_INLINE auto add(T a, T b) const noexcept -> T { return ui::internal::add_mod(a, b, m_mod); }
+        UI_ALWAYS_INLINE auto sub(T a, T b) const noexcept -> T { return a >= b ? static_cast<T>(a - b) : static_cast<T>(a - b + m_mod); }
+        UI_ALWAYS_INLINE auto pow(T x, T e) const noexcept -> T { return pow(Vec<1, T>{ .val = x }, e).val; }
+
+    private:
+        // (hi * R + lo) / R mod m for hi < m.
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto redc(Vec<N, T> const& lo, Vec<N, T> const& hi) const noexcept -> Vec<N, T> {
+            auto const m = Vec<N, T>::load(m_mod);
+            auto const q = lo * Vec<N, T>::load(m_inv);
+            auto const h = mul_high(q, m);
+            return bitwise_select(hi < h, hi - h + m, hi - h);
+        }
+
+    private:
+        T m_mod;
+        T m_inv{};
+        T m_r1{};
+        T m_r2{};
+        T m_barrett{};
+    };
+
+    /**
+     * @brief Radix-2 number theoretic transform of a fixed power-of-two size; spans holding several
+     * transforms back to back are transformed in one call.
+     */
+    template <std::unsigned_integral T>
+        requires (sizeof(T) == 4 || sizeof(T) == 8)
+    struct NTT {
+        using value_type = T;
+        static constexpr std::size_t lanes = ui::internal::native_lanes<T>;
+
+        /**
+         * @param root primitive `size`-th root of unity modulo `m`.
+         */
+        NTT(T m, T root, std::size_t size)
+            : m_arith(m)
+            , m_size(size)
+            , m_forward(size)
+            , m_inverse(size)
+        {
+            assert(std::has_single_bit(size) && "size should be a power of two");
+            auto const w = m_arith.to_mont(root);
+            // root^(size - 1) is the inverse root since root^size == 1.
+            auto const iw = m_arith.pow(w, static_cast<T>(size - 1));
+            // Twiddles of the stage with half-length `len` are stored at [len, 2 * len).
+            for (auto len = std::size_t{1}; len < size; len <<= 1) {
+                auto const step = static_cast<T>(size / (2 * len));
+                auto const wl = m_arith.pow(w, step);
+                auto const iwl = m_arith.pow(iw, step);
+                auto f = m_arith.template one<1>().val;
+                auto b = f;
+                for (auto j = 0ul; j < len; ++j) {
+                    m_forward[len + j] = f;
+                    m_inverse[len + j] = b;
+                    f = m_arith.mul(f, wl);
+                    b = m_arith.mul(b, iwl);
+                }
+            }
+            // size^-1 = ((m + 1) / 2)^log2(size), in Montgomery form.
+            auto const half = m_arith.to_mont(static_cast<T>(m / 2 + 1));
+            m_size_inv = m_arith.pow(half, static_cast<T>(std::countr_zero(size)));
+        }
+
+        constexpr auto size() const noexcept -> std::size_t { return m_size; }
+        constexpr auto arith() const noexcept -> ModArith<T> const& { return m_arith; }
+
+        /**
+         * @brief In-place forward transform of every `size()` block; values must be below the
+         * modulus and the result is in natural order.
+         */
+        auto forward(std::span<T> data) const noexcept -> void {
+            assert(data.size() % m_size == 0);
+            for (auto i = 0ul; i < data.size(); i += m_size) {
+                transform(data.data() + i, m_forward.data());
+            }
+        }
+
+        /**
+         * @brief In-place inverse transform including the `1 / size` scaling.
+         */
+        auto inverse(std::span<T> data) const noexcept -> void {
+            assert(data.size() % m_size == 0);
+            auto const scale = Vec<lanes, T>::load(m_size_inv);
+            for (auto i = 0ul; i < data.size(); i += m_size) {
+                auto* block = data.data() + i;
+                transform(block, m_inverse.data());
+                auto j = 0ul;
+                for (; j + lanes <= m_size; j += lanes) {
+                    m_arith.mul(Vec<lanes, T>::load(block + j, lanes), scale).store(block + j, lanes);
+                }
+                for (; j < m_size; ++j) block[j] = m_arith.mul(block[j], m_size_inv);
+            }
+        }
+
+    private:
+        // Iterative Cooley-Tukey over a bit-reversed copy; stages shorter than a register are
+        // done one element at a time.
+        auto transform(T* data, T const* twiddles) const noexcept -> void {
+            for (auto i = 1ul, j = 0ul; i < m_size; ++i) {
+                auto bit = m_size >> 1;
+                for (; j & bit; bit >>= 1) j ^= bit;
+                j ^= bit;
+                if (i < j) std::swap(data[i], data[j]);
+            }
+
+            for (auto len = 1ul; len < m_size; len <<= 1) {
+                auto const* tw = twiddles + len;
+                for (auto k = 0ul; k < m_size; k += 2 * len) {
+                    auto* lo = data + k;
+                    auto* hi = lo + len;
+                    auto j = 0ul;
+                    if (len >= lanes) {
+                        for (; j + lanes <= len; j += lanes) {
+                            auto const u = Vec<lanes, T>::load(lo + j, lanes);
+                            auto const v = m_arith.mul(Vec<lanes, T>::load(hi + j, lanes), Vec<lanes, T>::load(tw + j, lanes));
+                            m_arith.add(u, v).store(lo + j, lanes);
+                            m_arith.sub(u, v).store(hi + j, lanes);
+                        }
+                    }
+                    for (; j < len; ++j) {
+                        auto const u = lo[j];
+                        auto const v = m_arith.mul(hi[j], tw[j]);
+                        lo[j] = m_arith.add(u, v);
+                        hi[j] = m_arith.sub(u, v);
+                    }
+                }
+            }
+        }
+
+    private:
+        ModArith<T> m_arith;
+        std::size_t m_size;
+        std::vector<T> m_forward;
+        std::vector<T> m_inverse;
+        T m_size_inv{};
+    };
+
+} // namespace ui
+
+#endif // AMT_UI_MOD_ARITH_HPP
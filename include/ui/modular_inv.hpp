@@ -68,7 +68,7 @@ namespace ui::maths {
             std::array<std::uint8_t, 128> res;
 
             for (auto i = 0u; i < 128u; ++i) {
-                auto inv = internal::calculate_reciprocal<3>(2 * i + 1); // only odd numbers
+                auto inv = internal::calculate_reciprocal<3, true>(2 * i + 1); // only odd numbers
                 res[i] = inv & 0xff;
             }
 
@@ -88,13 +88,13 @@ namespace ui::maths {
 
             // 2. Refine approximation using Newton iterations
             //    Each iteration doubles the number of correct bits
-            if constexpr (sizeof(T) == 2) {
+            if constexpr (sizeof(T) >= 2) {
                 inv = (1 - val * inv) * inv + inv;  // 16 bits
             }
-            if constexpr (sizeof(T) == 4) {
+            if constexpr (sizeof(T) >= 4) {
                 inv = (1 - val * inv) * inv + inv;  // 32 bits
             }
-            if constexpr (sizeof(T) == 8) {
+            if constexpr (sizeof(T) >= 8) {
                 inv = (1 - val * inv) * inv + inv;  // 64 bits
             }
 
@@ -0,0 +1,169 @@
+#ifndef AMT_UI_POLYNOMIAL_HPP
+#define AMT_UI_POLYNOMIAL_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "float.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+// Polynomial evaluation
+// ---------------------
+// The coefficients are template arguments in ascending order, `c0 + c1 * x + c2 * x^2 + ...`,
+// either one by one or as `std::array`s, and are converted to the lane type at compile time. The
+// evaluation is a chain of `fused_mul_acc`:
+//
+//     horner: ((c3 * x + c2) * x + c1) * x + c0              one dependent chain
+//     estrin: (c0 + c1 * x) + (c2 + c3 * x) * x^2            independent pairs, log2 depth
+//
+// Estrin's scheme has a shorter critical path, which keeps the FMA units busy when a single
+// polynomial is evaluated on a wide vector; Horner's has fewer operations and a slightly smaller
+// rounding error. `poly` picks Estrin from degree four up.
+//
+//     auto y = ui::poly<1.0, 0.5, 0.25>(x);               // 1 + x / 2 + x^2 / 4
+//     auto r = ui::rational<std::array{ 1.0, 0.5 }, std::array{ 1.0, -0.5 }>(x);
+//
+// `float16` and `bfloat16` lanes are evaluated in `float`.
+
+namespace ui {
+
+    namespace internal {
+        template <typename C>
+        struct is_coeff_array: std::false_type {
+            static constexpr std::size_t size = 1;
+        };
+
+        template <typename U, std::size_t K>
+        struct is_coeff_array<std::array<U, K>>: std::true_type {
+            static constexpr std::size_t size = K;
+        };
+
+        // Flattens the scalar and array template arguments into one array of `T`.
+        template <typename T, auto... Cs>
+        inline constexpr auto coefficients = [] {
+            auto res = std::array<T, (is_coeff_array<std::remove_cvref_t<decltype(Cs)>>::size + ... + 0)>{};
+            auto i = std::size_t{};
+            ([&] {
+                if constexpr (is_coeff_array<std::remove_cvref_t<decltype(Cs)>>::value) {
+                    for (auto c: Cs) res[i++] = static_cast<T>(c);
+                } else {
+                    res[i++] = static_cast<T>(Cs);
+                }
+            }(), ...);
+            return res;
+        }();
+
+        template <std::size_t N, std::floating_point T, std::size_t K>
+        UI_ALWAYS_INLINE auto horner_impl(Vec<N, T> const& x, std::array<T, K> const& c) noexcept -> Vec<N, T> {
+            static_assert(K > 0, "a polynomial needs at least one coefficient");
+            auto res = Vec<N, T>::load(c[K - 1]);
+            for (auto i = K - 1; i > 0; --i) {
+                res = ui::fused_mul_acc(Vec<N, T>::load(c[i - 1]), res, x, op::add_t{});
+            }
+            return res;
+        }
+
+        template <std::size_t N, std::floating_point T, std::size_t K>
+        UI_ALWAYS_INLINE auto estrin_impl(Vec<N, T> const& x, std::array<T, K> const& c) noexcept -> Vec<N, T> {
+            static_assert(K > 0, "a polynomial needs at least one coefficient");
+            // Pairs of coefficients, then pairs of pairs with the power squared at every level.
+            auto p = std::array<Vec<N, T>, (K + 1) / 2>{};
+            for (auto i = 0ul; i < p.size(); ++i) {
+                p[i] = 2 * i + 1 < K
+                    ? ui::fused_mul_acc(Vec<N, T>::load(c[2 * i]), Vec<N, T>::load(c[2 * i + 1]), x, op::add_t{})
+                    : Vec<N, T>::load(c[2 * i]);
+            }
+            auto xp = x * x;
+            for (auto m = p.size(); m > 1; m = (m + 1) / 2) {
+                for (auto i = 0ul; i < m / 2; ++i) {
+                    p[i] = ui::fused_mul_acc(p[2 * i], p[2 * i + 1], xp, op::add_t{});
+                }
+                if (m & 1) p[m / 2] = p[m - 1];
+                if (m > 2) xp = xp * xp;
+            }
+            return p[0];
+        }
+
+        // Newton steps on `reciprocal_estimate` that reach half of the significand from the
+        // four-bit estimate of the emulated backend; `reciprocal` finishes with one fused step.
+        template <std::floating_point T>
+        inline constexpr auto reciprocal_steps = sizeof(T) == sizeof(float) ? 2u : 3u;
+
+        // 1 / d for finite, non-zero d. The last step corrects with the fused residual 1 - d * r,
+        // which rounds once instead of twice.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto reciprocal(Vec<N, T> const& d) noexcept -> Vec<N, T> {
+            auto r = reciprocal_estimate(d);
+            for (auto i = 0u; i < reciprocal_steps<T>; ++i) {
+                r = r * reciprocal_refine(d, r);
+            }
+            auto const e = ui::fused_mul_acc(Vec<N, T>::load(T(1)), d, r, op::sub_t{});
+            return ui::fused_mul_acc(r, r, e, op::add_t{});
+        }
+    } // namespace internal
+
+// MARK: Polynomial Evaluation
+    /**
+     * @brief Polynomial with the coefficients `Cs` in ascending order, evaluated with Horner's
+     * scheme.
+     */
+    template <auto... Cs, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto horner(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(horner<Cs...>(cast<float>(x)));
+        } else {
+            return ui::internal::horner_impl(x, ui::internal::coefficients<T, Cs...>);
+        }
+    }
+
+    /**
+     * @brief Polynomial with the coefficients `Cs` in ascending order, evaluated with Estrin's
+     * scheme.
+     */
+    template <auto... Cs, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto estrin(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(estrin<Cs...>(cast<float>(x)));
+        } else {
+            return ui::internal::estrin_impl(x, ui::internal::coefficients<T, Cs...>);
+        }
+    }
+
+    /**
+     * @brief Polynomial with the coefficients `Cs` in ascending order; Estrin's scheme from
+     * degree four up and Horner's below.
+     */
+    template <auto... Cs, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto poly(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::coefficients<float, Cs...>.size() > 4) {
+            return estrin<Cs...>(x);
+        } else {
+            return horner<Cs...>(x);
+        }
+    }
+
+    /**
+     * @brief Rational function `P(x) / Q(x)`; `P` and `Q` are coefficients in ascending order,
+     * a scalar or a `std::array` each. The quotient is taken with a refined `reciprocal_estimate`,
+     * so `Q` must not vanish on the inputs.
+     */
+    template <auto P, auto Q, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto rational(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(rational<P, Q>(cast<float>(x)));
+        } else {
+            auto const num = poly<P>(x);
+            auto const den = poly<Q>(x);
+            auto const r = ui::internal::reciprocal(den);
+            // One remainder step on the quotient.
+            auto const q = num * r;
+            return ui::fused_mul_acc(q, ui::fused_mul_acc(num, q, den, op::sub_t{}), r, op::add_t{});
+        }
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_POLYNOMIAL_HPP
@@ -0,0 +1,370 @@
+#ifndef AMT_UI_QUANTIZE_HPP
+#define AMT_UI_QUANTIZE_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "float.hpp"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Block quantization
+// ------------------
+// A span of `float`, `float16` or `bfloat16` is split into blocks of `block_size` elements, and
+// every block is stored as small integers with its own scale:
+//
+//     symmetric:   x ~= scale * q,                q in [-(2^(Bits-1) - 1), 2^(Bits-1) - 1]
+//     asymmetric:  x ~= scale * (q - zero_point), q in [0, 2^Bits - 1]
+//
+// The symmetric scale is `max|x| / qmax`. The asymmetric range always contains zero, so zero is
+// stored exactly, and the zero point is the code of `0`. Codes are `round(x / scale)` to nearest
+// even (in the default rounding mode), clamped to the range and narrowed with `sat_cast`.
+//
+// `Bits == 8` stores one code per byte (`int8_t` symmetric, `uint8_t` asymmetric). `Bits == 4`
+// packs two codes per `uint8_t`, the even element in the low nibble; symmetric nibbles are two's
+// complement. Every step converts one native register of codes, so e.g. AVX2 rounds four `float`
+// registers and packs them into one register of 32 codes.
+//
+//     ui::quantize(std::span(w), std::span(q), std::span(scales), 64);              // int8
+//     ui::quantize<4>(std::span(w), std::span(q4), std::span(scales), std::span(zp), 32);
+//     ui::dequantize<4>(std::span(q4), std::span(w), std::span(scales), std::span(zp), 32);
+
+namespace ui {
+
+    namespace internal {
+        template <std::size_t Bits>
+        concept quant_bits = (Bits == 8 || Bits == 4);
+
+        template <std::size_t Bits, bool Asymmetric>
+        struct QuantRange {
+            static constexpr float min = Asymmetric ? 0.f : -float((1 << (Bits - 1)) - 1);
+            static constexpr float max = Asymmetric ? float((1 << Bits) - 1) : float((1 << (Bits - 1)) - 1);
+        };
+
+        // Element type of one unpacked code.
+        template <bool Asymmetric>
+        using quant_code_t = std::conditional_t<Asymmetric, std::uint8_t, std::int8_t>;
+
+        // Storage type of `Bits`-bit codes; 4-bit codes are always packed into bytes.
+        template <std::size_t Bits, bool Asymmetric>
+        using quant_storage_t = std::conditional_t<Bits == 8, quant_code_t<Asymmetric>, std::uint8_t>;
+
+        // Codes converted per step: one native register of bytes.
+        inline constexpr std::size_t quant_lanes = std::max<std::size_t>(16 * native::NativeSizeFactor, 2);
+
+        template <std::size_t Bits>
+        UI_ALWAYS_INLINE constexpr auto quant_bytes(std::size_t count) noexcept -> std::size_t {
+            return Bits == 8 ? count : (count + 1) / 2;
+        }
+
+        template <typename T>
+        concept quant_float = std::same_as<T, float> || is_fp16<T>;
+
+        // Lanes past `count` are zero; zero never widens a range that already contains it.
+        template <std::size_t M, typename T>
+        UI_ALWAYS_INLINE auto quant_load(
+            T const* UI_RESTRICT in,
+            std::size_t count
+        ) noexcept -> Vec<M, float> {
+            auto const v = count >= M ? Vec<M, T>::load(in, M) : ui::masked_load<M>(in, count);
+            if constexpr (std::same_as<T, float>) return v;
+            else return ui::cast<float>(v);
+        }
+
+        template <std::size_t M, typename T, typename U>
+        UI_ALWAYS_INLINE auto quant_store(
+            T* UI_RESTRICT out,
+            Vec<M, U> v,
+            std::size_t count
+        ) noexcept -> void {
+            if constexpr (std::same_as<T, U>) {
+                if (count >= M) v.store(out, M);
+                else ui::masked_store(out, v, count);
+            } else {
+                quant_store<M>(out, ui::cast<T>(v), count);
+            }
+        }
+
+        struct QuantParams {
+            float scale;
+            float inv_scale;
+            float zero_point;
+        };
+
+        template <std::size_t Bits, bool Asymmetric, typename T>
+        UI_ALWAYS_INLINE auto quant_params(
+            T const* UI_RESTRICT in,
+            std::size_t size
+        ) noexcept -> QuantParams {
+            using range = QuantRange<Bits, Asymmetric>;
+            static constexpr auto M = quant_lanes;
+
+            auto lo = Vec<M, float>::load(0.f);
+            auto hi = Vec<M, float>::load(0.f);
+            for (auto i = std::size_t{}; i < size; i += M) {
+                auto const v = quant_load<M>(in + i, size - i);
+                if constexpr (Asymmetric) {
+                    lo = ui::min(lo, v);
+                    hi = ui::max(hi, v);
+                } else {
+                    hi = ui::max(hi, abs(v));
+                }
+            }
+
+            if constexpr (Asymmetric) {
+                auto const width = ui::fold(hi, op::max_t{}) - ui::fold(lo, op::min_t{});
+                if (!(width > 0.f)) return { .scale = 0.f, .inv_scale = 0.f, .zero_point = 0.f };
+                auto const inv = range::max / width;
+                auto const zp = std::clamp(std::round(-ui::fold(lo, op::min_t{}) * inv), range::min, range::max);
+                return { .scale = width / range::max, .inv_scale = inv, .zero_point = zp };
+            } else {
+                auto const amax = ui::fold(hi, op::max_t{});
+                if (!(amax > 0.f)) return { .scale = 0.f, .inv_scale = 0.f, .zero_point = 0.f };
+                return { .scale = amax / range::max, .inv_scale = range::max / amax, .zero_point = 0.f };
+            }
+        }
+
+        // Adding 1.5 * 2^23 leaves one unit per ulp, so the addition itself rounds to nearest even
+        // and the integer sits in the low mantissa bits. The codes are clamped before the bits are
+        // read, so no lane needs the infinity handling of `cast<std::int32_t>`.
+        template <std::size_t Bits, bool Asymmetric, std::size_t M>
+        UI_ALWAYS_INLINE auto quant_encode(
+            Vec<M, float> const& x,
+            QuantParams const& p
+        ) noexcept -> Vec<M, quant_code_t<Asymmetric>> {
+            using range = QuantRange<Bits, Asymmetric>;
+            static constexpr auto magic = 0x1.8p23f;
+            // `zero_point` is integral, so folding it into the constant is exact.
+            auto q = x * p.inv_scale + (magic + p.zero_point);
+            q = ui::min(ui::max(q, Vec<M, float>::load(magic + range::min)), Vec<M, float>::load(magic + range::max));
+            auto const code = ui::rcast<std::int32_t>(q) - Vec<M, std::int32_t>::load(std::bit_cast<std::int32_t>(magic));
+            return ui::sat_cast<quant_code_t<Asymmetric>>(code);
+        }
+
+        template <bool Asymmetric, std::size_t M>
+        UI_ALWAYS_INLINE auto quant_decode(
+            Vec<M, quant_code_t<Asymmetric>> const& q,
+            QuantParams const& p
+        ) noexcept -> Vec<M, float> {
+            // `q - zero_point` is exact in `float`; only the product rounds.
+            auto const f = ui::cast<float>(ui::cast<std::int32_t>(q));
+            if constexpr (Asymmetric) return (f - p.zero_point) * p.scale;
+            else return f * p.scale;
+        }
+
+        // Byte `k` of the result holds code `2k` in its low nibble and `2k + 1` in its high one.
+        template <std::size_t M, typename T>
+        UI_ALWAYS_INLINE auto pack_nibbles(
+            Vec<M, T> const& q
+        ) noexcept -> Vec<M / 2, std::uint8_t> {
+            auto const nibbles = ui::rcast<std::uint8_t>(q) & Vec<M, std::uint8_t>::load(0x0F);
+            auto const pairs = std::bit_cast<Vec<M / 2, std::uint16_t>>(nibbles);
+            return ui::narrowing_shift_right<4>(pairs | ui::shift_left<4>(pairs));
+        }
+
+        template <bool Asymmetric, std::size_t M>
+        UI_ALWAYS_INLINE auto unpack_nibbles(
+            Vec<M, std::uint8_t> const& packed
+        ) noexcept -> Vec<2 * M, quant_code_t<Asymmetric>> {
+            auto const wide = ui::cast<std::uint16_t>(packed);
+            auto const pairs = (wide | ui::shift_left<4>(wide)) & Vec<M, std::uint16_t>::load(0x0F0F);
+            auto const nibbles = std::bit_cast<Vec<2 * M, std::uint8_t>>(pairs);
+            if constexpr (Asymmetric) {
+                return nibbles;
+            } else {
+                // Sign-extends the nibble: `(n ^ 8) - 8`.
+                auto const bias = Vec<2 * M, std::int8_t>::load(8);
+                return ui::rcast<std::int8_t>(nibbles ^ Vec<2 * M, std::uint8_t>::load(8)) - bias;
+            }
+        }
+
+        template <std::size_t Bits, bool Asymmetric, typename T, typename Q>
+        UI_ALWAYS_INLINE auto quantize_impl(
+            T const* UI_RESTRICT in,
+            std::size_t size,
+            Q* UI_RESTRICT out,
+            float* UI_RESTRICT scales,
+            std::uint8_t* UI_RESTRICT zero_points,
+            std::size_t block_size
+        ) noexcept -> void {
+            static constexpr auto M = quant_lanes;
+
+            for (auto start = std::size_t{}, b = std::size_t{}; start < size; start += block_size, ++b) {
+                auto const len = std::min(block_size, size - start);
+                auto const p = quant_params<Bits, Asymmetric>(in + start, len);
+                scales[b] = p.scale;
+                if constexpr (Asymmetric) zero_points[b] = static_cast<std::uint8_t>(p.zero_point);
+
+                auto* dst = out + quant_bytes<Bits>(start);
+                for (auto i = std::size_t{}; i < len; i += M) {
+                    auto const count = len - i;
+                    auto const q = quant_encode<Bits, Asymmetric>(quant_load<M>(in + start + i, count), p);
+                    if constexpr (Bits == 8) {
+                        quant_store<M>(dst + i, q, count);
+                    } else {
+                        quant_store<M / 2>(dst + i / 2, pack_nibbles(q), quant_bytes<4>(count));
+                    }
+                }
+            }
+        }
+
+        template <std::size_t Bits, bool Asymmetric, typename Q, typename U>
+        UI_ALWAYS_INLINE auto dequantize_impl(
+            Q const* UI_RESTRICT in,
+            U* UI_RESTRICT out,
+            std::size_t size,
+            float const* UI_RESTRICT scales,
+            std::uint8_t const* UI_RESTRICT zero_points,
+            std::size_t block_size
+        ) noexcept -> void {
+            using code_t = quant_code_t<Asymmetric>;
+            static constexpr auto M = quant_lanes;
+
+            for (auto start = std::size_t{}, b = std::size_t{}; start < size; start += block_size, ++b) {
+                auto const len = std::min(block_size, size - start);
+                auto const p = QuantParams{
+                    .scale = scales[b],
+                    .inv_scale = 0.f,
+                    .zero_point = Asymmetric ? static_cast<float>(zero_points[b]) : 0.f
+                };
+
+                auto const* src = in + quant_bytes<Bits>(start);
+                for (auto i = std::size_t{}; i < len; i += M) {
+                    auto const count = len - i;
+                    auto const q = [&] {
+                        if constexpr (Bits == 8) {
+                            return count >= M ? Vec<M, code_t>::load(src + i, M) : ui::masked_load<M>(src + i, count);
+                        } else {
+                            static constexpr auto H = M / 2;
+                            auto const bytes = quant_bytes<4>(count);
+                            auto const packed = bytes >= H ? Vec<H, std::uint8_t>::load(src + i / 2, H) : ui::masked_load<H>(src + i / 2, bytes);
+                            return unpack_nibbles<Asymmetric>(packed);
+                        }
+                    }();
+                    quant_store<M>(out + start + i, quant_decode<Asymmetric>(q, p), count);
+                }
+            }
+        }
+    } // namespace internal
+
+// MARK: Quantize
+    /**
+     * @brief Symmetric block quantization; `out[i] = round(in[i] / scales[i / block_size])`.
+     * `out` holds `int8_t` codes for `Bits == 8` and two packed codes per `uint8_t` for
+     * `Bits == 4`. One scale per block is written to `scales`.
+     * @note `block_size` must be even for `Bits == 4`, so every block starts on a byte.
+     */
+    template <std::size_t Bits = 8, typename T, typename Q>
+        requires (
+            ui::internal::quant_bits<Bits> &&
+            ui::internal::quant_float<std::remove_cv_t<T>> &&
+            std::same_as<Q, ui::internal::quant_storage_t<Bits, false>>
+        )
+    UI_ALWAYS_INLINE auto quantize(
+        std::span<T> in,
+        std::span<Q> out,
+        std::span<float> scales,
+        std::size_t block_size
+    ) noexcept -> void {
+        assert(block_size > 0 && (Bits == 8 || block_size % 2 == 0));
+        assert(out.size() >= ui::internal::quant_bytes<Bits>(in.size()));
+        assert(scales.size() >= (in.size() + block_size - 1) / block_size);
+        ui::internal::quantize_impl<Bits, false>(
+            static_cast<std::remove_cv_t<T> const*>(in.data()), in.size(),
+            out.data(), scales.data(), nullptr, block_size
+        );
+    }
+
+    /**
+     * @brief Asymmetric block quantization;
+     * `out[i] = round(in[i] / scales[b]) + zero_points[b]` with `b = i / block_size`.
+     * Codes are unsigned; `Bits == 4` packs two per byte.
+     */
+    template <std::size_t Bits = 8, typename T>
+        requires (ui::internal::quant_bits<Bits> && ui::internal::quant_float<std::remove_cv_t<T>>)
+    UI_ALWAYS_INLINE auto quantize(
+        std::span<T> in,
+        std::span<std::uint8_t> out,
+        std::span<float> scales,
+        std::span<std::uint8_t> zero_points,
+        std::size_t block_size
+    ) noexcept -> void {
+        auto const blocks = (in.size() + block_size - 1) / block_size;
+        assert(block_size > 0 && (Bits == 8 || block_size % 2 == 0));
+        assert(out.size() >= ui::internal::quant_bytes<Bits>(in.size()));
+        assert(scales.size() >= blocks && zero_points.size() >= blocks);
+        ui::internal::quantize_impl<Bits, true>(
+            static_cast<std::remove_cv_t<T> const*>(in.data()), in.size(),
+            out.data(), scales.data(), zero_points.data(), block_size
+        );
+    }
+// !MARK
+
+// MARK: Dequantize
+    /**
+     * @brief Inverse of symmetric `quantize`; `out[i] = scales[i / block_size] * in[i]` for
+     * `out.size()` elements.
+     */
+    template <std::size_t Bits = 8, typename Q, typename U, typename S>
+        requires (
+            ui::internal::quant_bits<Bits> &&
+            std::same_as<std::remove_cv_t<Q>, ui::internal::quant_storage_t<Bits, false>> &&
+            ui::internal::quant_float<U> &&
+            std::same_as<std::remove_cv_t<S>, float>
+        )
+    UI_ALWAYS_INLINE auto dequantize(
+        std::span<Q> in,
+        std::span<U> out,
+        std::span<S> scales,
+        std::size_t block_size
+    ) noexcept -> void {
+        assert(block_size > 0 && (Bits == 8 || block_size % 2 == 0));
+        assert(in.size() >= ui::internal::quant_bytes<Bits>(out.size()));
+        assert(scales.size() >= (out.size() + block_size - 1) / block_size);
+        ui::internal::dequantize_impl<Bits, false>(
+            static_cast<std::remove_cv_t<Q> const*>(in.data()), out.data(), out.size(),
+            static_cast<float const*>(scales.data()), nullptr, block_size
+        );
+    }
+
+    /**
+     * @brief Inverse of asymmetric `quantize`; `out[i] = scales[b] * (in[i] - zero_points[b])`
+     * with `b = i / block_size`, for `out.size()` elements.
+     */
+    template <std::size_t Bits = 8, typename Q, typename U, typename S, typename Z>
+        requires (
+            ui::internal::quant_bits<Bits> &&
+            std::same_as<std::remove_cv_t<Q>, std::uint8_t> &&
+            ui::internal::quant_float<U> &&
+            std::same_as<std::remove_cv_t<S>, float> &&
+            std::same_as<std::remove_cv_t<Z>, std::uint8_t>
+        )
+    UI_ALWAYS_INLINE auto dequantize(
+        std::span<Q> in,
+        std::span<U> out,
+        std::span<S> scales,
+        std::span<Z> zero_points,
+        std::size_t block_size
+    ) noexcept -> void {
+        auto const blocks = (out.size() + block_size - 1) / block_size;
+        assert(block_size > 0 && (Bits == 8 || block_size % 2 == 0));
+        assert(in.size() >= ui::internal::quant_bytes<Bits>(out.size()));
+        assert(scales.size() >= blocks && zero_points.size() >= blocks);
+        ui::internal::dequantize_impl<Bits, true>(
+            static_cast<std::uint8_t const*>(in.data()), out.data(), out.size(),
+            static_cast<float const*>(scales.data()),
+            static_cast<std::uint8_t const*>(zero_points.data()), block_size
+        );
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_QUANTIZE_HPP
@@ -0,0 +1,388 @@
+#ifndef AMT_UI_REDUCER_HPP
+#define AMT_UI_REDUCER_HPP
+
+#include "algorithm.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+// Streaming reducers
+// ------------------
+// `fold` is a full horizontal reduction; calling it once per vector inside a loop costs a shuffle
+// chain per iteration. A reducer keeps `K` vector accumulators instead, combines each pushed vector
+// lane-wise into one of them and folds only once when the result is requested. Data can be pushed
+// in any number of chunks, as vectors or as spans of arbitrary length.
+//
+//     auto sum = ui::Reducer<float>{};
+//     for (auto chunk: chunks) sum.push(chunk);
+//     auto total = sum.result();
+//
+// Variants:
+//     Reducer<T, Op>  - add, mul, max, min, maxnm and minnm
+//     KahanSum<T>     - compensated floating-point sum
+//     PairwiseSum<T>  - floating-point sum with pairwise (cascade) merging of blocks
+//     WideningSum<T>  - integer sum accumulated in `widening_result_t<T>` lanes
+//
+// NOTE: The compensated and pairwise sums rely on IEEE evaluation order; do not build them with
+//       `-ffast-math` or an equivalent flag.
+
+namespace ui {
+
+    namespace internal {
+        // Pushes `data` into `r` as full vectors followed by one partial vector whose inactive
+        // lanes hold `fill`.
+        template <std::size_t N, std::size_t K, typename T, typename R>
+        UI_ALWAYS_INLINE auto reducer_push_span(
+            R& r,
+            T const* UI_RESTRICT data,
+            std::size_t size,
+            T fill
+        ) noexcept -> void {
+            auto i = std::size_t{};
+            for (; i + K * N <= size; i += K * N) {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (r.template push_to<Is>(Vec<N, T>::load(data + i + Is * N, N)), ...);
+                }(std::make_index_sequence<K>{});
+            }
+            for (; i + N <= size; i += N) r.push(Vec<N, T>::load(data + i, N));
+            if (i < size) {
+                auto const count = size - i;
+                r.push(ui::masked_load(data + i, emul::internal::tail_mask<N, T>(count), Vec<N, T>::load(fill)));
+            }
+        }
+
+        // Neumaier summation of the lanes; used for the final fold of the compensated sums.
+        template <typename T, std::size_t N, std::size_t K>
+        UI_ALWAYS_INLINE constexpr auto compensated_fold(
+            std::array<Vec<N, T>, K> const& sum,
+            std::array<Vec<N, T>, K> const& comp
+        ) noexcept -> T {
+            auto s = T{};
+            auto c = T{};
+            auto const add = [&](T v) {
+                auto const t = s + v;
+                if (std::abs(s) >= std::abs(v)) c += (s - t) + v;
+                else c += (v - t) + s;
+                s = t;
+            };
+            for (auto k = 0ul; k < K; ++k) {
+                for (auto i = 0ul; i < N; ++i) add(sum[k][i]);
+            }
+            for (auto k = 0ul; k < K; ++k) {
+                for (auto i = 0ul; i < N; ++i) add(-comp[k][i]);
+            }
+            return s + c;
+        }
+    } // namespace internal
+
+// MARK: Reducer
+    /**
+     * @brief Streaming reduction with `K` independent accumulators of `N` lanes.
+     * @note Floating-point results follow the vector order, not the sequential one.
+     */
+    template <
+        typename T,
+        ui::internal::reduce_op Op = op::add_t,
+        std::size_t K = 4,
+        std::size_t N = ui::internal::native_lanes<T>
+    >
+        requires (K > 0)
+    struct Reducer {
+        using vec_type = Vec<N, T>;
+        using element_t = T;
+        using size_type = std::size_t;
+
+        static constexpr size_type lanes = N;
+        static constexpr size_type accumulators = K;
+
+        constexpr Reducer() noexcept
+            : Reducer(ui::internal::reduce_identity<T>(Op{}))
+        {}
+
+        // `init` is combined once with the final result.
+        constexpr explicit Reducer(T init) noexcept
+            : m_init(init)
+        {
+            m_acc.fill(vec_type::load(ui::internal::reduce_identity<T>(Op{})));
+        }
+
+        constexpr Reducer(Reducer const&) noexcept = default;
+        constexpr Reducer(Reducer &&) noexcept = default;
+        constexpr Reducer& operator=(Reducer const&) noexcept = default;
+        constexpr Reducer& operator=(Reducer &&) noexcept = default;
+        constexpr ~Reducer() noexcept = default;
+
+        UI_ALWAYS_INLINE auto push(vec_type const& v) noexcept -> void {
+            m_acc[m_next] = ui::internal::reduce_combine(m_acc[m_next], v, Op{});
+            m_next = (m_next + 1) % K;
+        }
+
+        UI_ALWAYS_INLINE auto push(std::span<T const> data) noexcept -> void {
+            ui::internal::reducer_push_span<N, K>(*this, data.data(), data.size(), ui::internal::reduce_identity<T>(Op{}));
+            m_size += data.size();
+        }
+
+        // Combines into accumulator `I` directly; lets callers unroll without the rotating index.
+        template <size_type I>
+            requires (I < K)
+        UI_ALWAYS_INLINE auto push_to(vec_type const& v) noexcept -> void {
+            m_acc[I] = ui::internal::reduce_combine(m_acc[I], v, Op{});
+        }
+
+        UI_ALWAYS_INLINE auto result() const noexcept -> T {
+            auto acc = m_acc;
+            auto const total = ui::internal::reduce_fold(ui::internal::reduce_accumulators(acc, Op{}), Op{});
+            return ui::internal::reduce_combine(Vec<1, T>{ .val = m_init }, Vec<1, T>{ .val = total }, Op{}).val;
+        }
+
+        // Number of elements pushed through `push(span)`.
+        constexpr auto size() const noexcept -> size_type { return m_size; }
+
+        UI_ALWAYS_INLINE auto mean() const noexcept -> T
+            requires (std::floating_point<T> && std::same_as<Op, op::add_t>)
+        {
+            return result() / static_cast<T>(m_size);
+        }
+
+    private:
+        std::array<vec_type, K> m_acc;
+        T m_init;
+        size_type m_next{};
+        size_type m_size{};
+    };
+// !MARK
+
+// MARK: Kahan Sum
+    /**
+     * @brief Compensated (Kahan) sum; every accumulator carries the low-order bits lost by its
+     * additions, so the error does not grow with the number of elements.
+     */
+    template <
+        std::floating_point T,
+        std::size_t K = 4,
+        std::size_t N = ui::internal::native_lanes<T>
+    >
+        requires (K > 0)
+    struct KahanSum {
+        using vec_type = Vec<N, T>;
+        using element_t = T;
+        using size_type = std::size_t;
+
+        static constexpr size_type lanes = N;
+        static constexpr size_type accumulators = K;
+
+        constexpr KahanSum() noexcept {
+            m_sum.fill(vec_type::load(T{}));
+            m_comp.fill(vec_type::load(T{}));
+        }
+
+        constexpr KahanSum(KahanSum const&) noexcept = default;
+        constexpr KahanSum(KahanSum &&) noexcept = default;
+        constexpr KahanSum& operator=(KahanSum const&) noexcept = default;
+        constexpr KahanSum& operator=(KahanSum &&) noexcept = default;
+        constexpr ~KahanSum() noexcept = default;
+
+        UI_ALWAYS_INLINE auto push(vec_type const& v) noexcept -> void {
+            add(m_next, v);
+            m_next = (m_next + 1) % K;
+        }
+
+        UI_ALWAYS_INLINE auto push(std::span<T const> data) noexcept -> void {
+            ui::internal::reducer_push_span<N, K>(*this, data.data(), data.size(), T{});
+            m_size += data.size();
+        }
+
+        template <size_type I>
+            requires (I < K)
+        UI_ALWAYS_INLINE auto push_to(vec_type const& v) noexcept -> void {
+            add(I, v);
+        }
+
+        UI_ALWAYS_INLINE auto result() const noexcept -> T {
+            return ui::internal::compensated_fold(m_sum, m_comp);
+        }
+
+        constexpr auto size() const noexcept -> size_type { return m_size; }
+
+        UI_ALWAYS_INLINE auto mean() const noexcept -> T {
+            return result() / static_cast<T>(m_size);
+        }
+
+    private:
+        UI_ALWAYS_INLINE auto add(size_type k, vec_type const& v) noexcept -> void {
+            auto const y = v - m_comp[k];
+            auto const t = m_sum[k] + y;
+            m_comp[k] = (t - m_sum[k]) - y;
+            m_sum[k] = t;
+        }
+
+    private:
+        std::array<vec_type, K> m_sum;
+        std::array<vec_type, K> m_comp;
+        size_type m_next{};
+        size_type m_size{};
+    };
+// !MARK
+
+// MARK: Pairwise Sum
+    /**
+     * @brief Pairwise (cascade) sum. Vectors are summed plainly in blocks of `Block`; finished
+     * blocks are merged like a binary counter so that only blocks of equal weight are added and
+     * the error grows with `log2(n)` instead of `n`.
+     */
+    template <
+        std::floating_point T,
+        std::size_t K = 4,
+        std::size_t N = ui::internal::native_lanes<T>,
+        std::size_t Block = 32
+    >
+        requires (K > 0 && Block >= K)
+    struct PairwiseSum {
+        using vec_type = Vec<N, T>;
+        using element_t = T;
+        using size_type = std::size_t;
+
+        static constexpr size_type lanes = N;
+        static constexpr size_type accumulators = K;
+        static constexpr size_type block = Block;
+
+        constexpr PairwiseSum() noexcept {
+            reset_block();
+        }
+
+        constexpr PairwiseSum(PairwiseSum const&) noexcept = default;
+        constexpr PairwiseSum(PairwiseSum &&) noexcept = default;
+        constexpr PairwiseSum& operator=(PairwiseSum const&) noexcept = default;
+        constexpr PairwiseSum& operator=(PairwiseSum &&) noexcept = default;
+        constexpr ~PairwiseSum() noexcept = default;
+
+        UI_ALWAYS_INLINE auto push(vec_type const& v) noexcept -> void {
+            auto const k = m_count % K;
+            m_acc[k] = m_acc[k] + v;
+            if (++m_count == Block) flush();
+        }
+
+        UI_ALWAYS_INLINE auto push(std::span<T const> data) noexcept -> void {
+            ui::internal::reducer_push_span<N, K>(*this, data.data(), data.size(), T{});
+            m_size += data.size();
+        }
+
+        // Keeps the block count exact, so the unrolled path only targets the next accumulator.
+        template <size_type I>
+            requires (I < K)
+        UI_ALWAYS_INLINE auto push_to(vec_type const& v) noexcept -> void {
+            push(v);
+        }
+
+        UI_ALWAYS_INLINE auto result() const noexcept -> T {
+            auto acc = m_acc;
+            auto total = ui::internal::reduce_accumulators(acc, op::add_t{});
+            // Lower levels hold the lighter partial sums; add them first.
+            for (auto bits = m_levels_used; bits != 0; bits &= bits - 1) {
+                total = total + m_levels[static_cast<size_type>(std::countr_zero(bits))];
+            }
+            return fold(total, op::add_t{});
+        }
+
+        constexpr auto size() const noexcept -> size_type { return m_size; }
+
+        UI_ALWAYS_INLINE auto mean() const noexcept -> T {
+            return result() / static_cast<T>(m_size);
+        }
+
+    private:
+        constexpr auto reset_block() noexcept -> void {
+            m_acc.fill(vec_type::load(T{}));
+            m_count = 0;
+        }
+
+        UI_ALWAYS_INLINE auto flush() noexcept -> void {
+            auto carry = ui::internal::reduce_accumulators(m_acc, op::add_t{});
+            auto level = size_type{};
+            while (m_levels_used & (size_type{1} << level)) {
+                carry = m_levels[level] + carry;
+                m_levels_used &= ~(size_type{1} << level);
+                ++level;
+            }
+            m_levels[level] = carry;
+            m_levels_used |= size_type{1} << level;
+            reset_block();
+        }
+
+    private:
+        std::array<vec_type, K> m_acc;
+        std::array<vec_type, sizeof(size_type) * 8> m_levels{};
+        size_type m_levels_used{};
+        size_type m_count{};
+        size_type m_size{};
+    };
+// !MARK
+
+// MARK: Widening Sum
+    /**
+     * @brief Integer sum accumulated in `widening_result_t<T>` lanes with `widening_padd`; only the
+     * final result goes through `fold`. The result wraps modulo the widened type.
+     */
+    template <
+        std::integral T,
+        std::size_t K = 4,
+        std::size_t N = ui::internal::native_lanes<T>
+    >
+        requires (K > 0 && N > 1 && sizeof(T) < 8)
+    struct WideningSum {
+        using vec_type = Vec<N, T>;
+        using element_t = T;
+        using result_t = ui::internal::widening_result_t<T>;
+        using acc_type = Vec<N / 2, result_t>;
+        using size_type = std::size_t;
+
+        static constexpr size_type lanes = N;
+        static constexpr size_type accumulators = K;
+
+        constexpr WideningSum() noexcept {
+            m_acc.fill(acc_type::load(result_t{}));
+        }
+
+        constexpr WideningSum(WideningSum const&) noexcept = default;
+        constexpr WideningSum(WideningSum &&) noexcept = default;
+        constexpr WideningSum& operator=(WideningSum const&) noexcept = default;
+        constexpr WideningSum& operator=(WideningSum &&) noexcept = default;
+        constexpr ~WideningSum() noexcept = default;
+
+        UI_ALWAYS_INLINE auto push(vec_type const& v) noexcept -> void {
+            m_acc[m_next] = widening_padd(m_acc[m_next], v);
+            m_next = (m_next + 1) % K;
+        }
+
+        UI_ALWAYS_INLINE auto push(std::span<T const> data) noexcept -> void {
+            ui::internal::reducer_push_span<N, K>(*this, data.data(), data.size(), T{});
+            m_size += data.size();
+        }
+
+        template <size_type I>
+            requires (I < K)
+        UI_ALWAYS_INLINE auto push_to(vec_type const& v) noexcept -> void {
+            m_acc[I] = widening_padd(m_acc[I], v);
+        }
+
+        UI_ALWAYS_INLINE auto result() const noexcept -> result_t {
+            auto acc = m_acc;
+            return fold(ui::internal::reduce_accumulators(acc, op::add_t{}), op::add_t{});
+        }
+
+        constexpr auto size() const noexcept -> size_type { return m_size; }
+
+    private:
+        std::array<acc_type, K> m_acc;
+        size_type m_next{};
+        size_type m_size{};
+    };
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_REDUCER_HPP
@@ -0,0 +1,197 @@
+#ifndef AMT_UI_SCAN_HPP
+#define AMT_UI_SCAN_HPP
+
+#include "algorithm.hpp"
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Prefix sums
+// -----------
+// Every register is scanned in-lane with `inclusive_scan(Vec)` and the running total is carried
+// into the next register as a broadcast of its last lane, so the only loop-carried dependency is
+// one add and one broadcast per register. The tail is handled with a masked load and store.
+//
+//     auto offsets = std::vector<std::uint32_t>(sizes.size());
+//     auto total = ui::exclusive_scan(std::span(sizes), std::span(offsets));
+//
+// The `parallel_` variants split the span into one block per thread and run two passes: the first
+// reduces every block, the block totals are scanned sequentially, and the second scans every block
+// starting from its offset. Spans that are too short to amortise the threads are scanned serially.
+
+namespace ui {
+
+    namespace internal {
+        // Scans `size` elements of `in` into `out` starting from `init` and returns the total.
+        // `in` and `out` may alias.
+        template <bool Inclusive, std::size_t N, typename T>
+        UI_ALWAYS_INLINE auto scan_impl(
+            T const* in,
+            T* out,
+            std::size_t size,
+            T init
+        ) noexcept -> T {
+            auto carry = Vec<N, T>::load(init);
+
+            auto const step = [&carry](Vec<N, T> const& v) {
+                auto const sum = ui::inclusive_scan(v) + carry;
+                auto res = sum;
+                if constexpr (!Inclusive) {
+                    if constexpr (N == 1) res = carry;
+                    else res = ui::shift_right_lane<1>(sum, carry);
+                }
+                carry = Vec<N, T>::template load<N - 1>(sum);
+                return res;
+            };
+
+            auto i = std::size_t{};
+            for (; i + N <= size; i += N) {
+                step(Vec<N, T>::load(in + i, N)).store(out + i, N);
+            }
+            if (i < size) {
+                // Zero-filled lanes leave the total in the last lane unchanged.
+                auto const count = size - i;
+                ui::masked_store(out + i, step(ui::masked_load<N>(in + i, count)), count);
+            }
+            return carry[0];
+        }
+
+        // Blocks are rounded up to whole registers so that only the last one has a tail.
+        template <bool Inclusive, std::size_t N, typename T>
+        inline auto parallel_scan_impl(
+            T const* in,
+            T* out,
+            std::size_t size,
+            T init,
+            unsigned threads
+        ) -> T {
+            static constexpr std::size_t min_block = std::size_t{1} << 16;
+
+            if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+            auto const workers = std::clamp<std::size_t>(size / min_block, 1, threads);
+            if (workers == 1) return scan_impl<Inclusive, N>(in, out, size, init);
+
+            auto const block = ((size + workers - 1) / workers + N - 1) / N * N;
+            auto const bounds = [&](std::size_t w) {
+                auto const start = std::min(w * block, size);
+                return std::pair{ start, std::min(start + block, size) };
+            };
+
+            // The calling thread takes the first block.
+            auto const run = [&](auto&& fn) {
+                auto pool = std::vector<std::jthread>{};
+                pool.reserve(workers - 1);
+                for (auto w = 1ul; w < workers; ++w) pool.emplace_back(fn, w);
+                fn(0ul);
+            };
+
+            auto offsets = std::vector<T>(workers);
+            run([&](std::size_t w) {
+                auto const [start, end] = bounds(w);
+                offsets[w] = ui::reduce(std::span<T const>(in + start, end - start));
+            });
+
+            auto total = init;
+            for (auto& o: offsets) {
+                auto const sum = o;
+                o = total;
+                total = static_cast<T>(total + sum);
+            }
+
+            run([&](std::size_t w) {
+                auto const [start, end] = bounds(w);
+                scan_impl<Inclusive, N>(in + start, out + start, end - start, offsets[w]);
+            });
+            return total;
+        }
+    } // namespace internal
+
+// MARK: Scan
+    /**
+     * @brief Inclusive prefix sum; `out[i] = init + in[0] + ... + in[i]`. Returns the total of
+     * `init` and every element. `out` may be `in`.
+     * @note Floating-point sums are associated per register, not sequentially.
+     */
+    template <
+        typename T,
+        typename U,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (std::same_as<std::remove_cv_t<T>, U>)
+    UI_ALWAYS_INLINE auto inclusive_scan(
+        std::span<T> in,
+        std::span<U> out,
+        std::type_identity_t<U> init = {}
+    ) noexcept -> U {
+        assert(out.size() >= in.size());
+        return ui::internal::scan_impl<true, N>(static_cast<U const*>(in.data()), out.data(), in.size(), init);
+    }
+
+    /**
+     * @brief Exclusive prefix sum; `out[i] = init + in[0] + ... + in[i - 1]`. Returns the total of
+     * `init` and every element, i.e. the offset one past the last record. `out` may be `in`.
+     * @note Floating-point sums are associated per register, not sequentially.
+     */
+    template <
+        typename T,
+        typename U,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (std::same_as<std::remove_cv_t<T>, U>)
+    UI_ALWAYS_INLINE auto exclusive_scan(
+        std::span<T> in,
+        std::span<U> out,
+        std::type_identity_t<U> init = {}
+    ) noexcept -> U {
+        assert(out.size() >= in.size());
+        return ui::internal::scan_impl<false, N>(static_cast<U const*>(in.data()), out.data(), in.size(), init);
+    }
+
+    /**
+     * @brief Two-pass multithreaded `inclusive_scan`. `threads == 0` uses every hardware thread.
+     */
+    template <
+        typename T,
+        typename U,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (std::same_as<std::remove_cv_t<T>, U>)
+    inline auto parallel_inclusive_scan(
+        std::span<T> in,
+        std::span<U> out,
+        std::type_identity_t<U> init = {},
+        unsigned threads = 0
+    ) -> U {
+        assert(out.size() >= in.size());
+        return ui::internal::parallel_scan_impl<true, N>(static_cast<U const*>(in.data()), out.data(), in.size(), init, threads);
+    }
+
+    /**
+     * @brief Two-pass multithreaded `exclusive_scan`. `threads == 0` uses every hardware thread.
+     */
+    template <
+        typename T,
+        typename U,
+        std::size_t N = ui::internal::native_lanes<std::remove_cv_t<T>>
+    >
+        requires (std::same_as<std::remove_cv_t<T>, U>)
+    inline auto parallel_exclusive_scan(
+        std::span<T> in,
+        std::span<U> out,
+        std::type_identity_t<U> init = {},
+        unsigned threads = 0
+    ) -> U {
+        assert(out.size() >= in.size());
+        return ui::internal::parallel_scan_impl<false, N>(static_cast<U const*>(in.data()), out.data(), in.size(), init, threads);
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_SCAN_HPP
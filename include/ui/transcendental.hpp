@@ -0,0 +1,1021 @@
+#ifndef AMT_UI_TRANSCENDENTAL_HPP
+#define AMT_UI_TRANSCENDENTAL_HPP
+
+#include "base_vec.hpp"
+#include "vec_op.hpp"
+#include "float.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Elementary functions
+// --------------------
+// Every function reduces its argument with integer tricks on the representation and then
+// evaluates a short polynomial with `fused_mul_acc`, so that it stays in registers on every
+// backend:
+//
+//     exp(x) = 2^n * e^r,            n = round(x / ln2), r = x - n * ln2 (Cody-Waite, two constants)
+//     log(x) = k * ln2 + log(1 + f), x = 2^k * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2)
+//
+// The `Accuracy` template parameter picks the polynomial: `Ulp1` stays within one unit in the last
+// place, `Ulp3_5` within three and a half, and `Fast` keeps about half of the significand bits.
+// `float16` and `bfloat16` lanes are evaluated in `float`.
+//
+//     auto e = ui::exp(v);                        // 1 ULP
+//     auto l = ui::log<ui::Accuracy::Fast>(v);
+//
+// `pow` on `double` keeps `log(x)` as an unevaluated sum of two doubles, because the error of
+// `y * log(x)` is scaled by up to ~709 when it is exponentiated; `float` evaluates it in `double`.
+//
+// The trigonometric functions reduce by multiples of pi / 2 with a four-part Cody-Waite constant
+// and carry the rounding error of the reduced argument into the kernels:
+//
+//     sin(x) = +-sin(r) or +-cos(r),  n = round(x * 2 / pi), r = x - n * pi / 2
+//
+// The reduction is exact only for moderate arguments; lanes beyond it are evaluated with the
+// scalar `std` functions, which costs a branch when no lane is that large. The inverse functions
+// follow fdlibm: `asin`/`acos` switch to `sqrt((1 - |x|) / 2)` above one half and `atan` splits
+// its argument into five intervals around known angles. They have no `Accuracy` parameter and stay
+// within about 1.5 ULP.
+
+namespace ui {
+
+    enum class Accuracy: std::uint8_t {
+        Ulp1,
+        Ulp3_5,
+        Fast
+    };
+
+    namespace internal {
+        template <std::floating_point T>
+        struct FloatBits;
+
+        template <>
+        struct FloatBits<float> {
+            using int_t = std::int32_t;
+            static constexpr int_t mantissa = 23;
+            static constexpr int_t bias = 127;
+            // Adding it rounds to an integer that ends up in the low bits of the representation.
+            static constexpr float round_magic = 0x1.8p23f;
+            // Lower half cleared; products of two such values are exact.
+            static constexpr int_t hi_mask = static_cast<int_t>(0xffff'f000);
+            static constexpr int_t sqrt_half = 0x3f35'04f3;
+        };
+
+        template <>
+        struct FloatBits<double> {
+            using int_t = std::int64_t;
+            static constexpr int_t mantissa = 52;
+            static constexpr int_t bias = 1023;
+            static constexpr double round_magic = 0x1.8p52;
+            static constexpr int_t hi_mask = static_cast<int_t>(0xffff'ffff'f800'0000);
+            static constexpr int_t sqrt_half = 0x3fe6'a09e'0000'0000;
+        };
+
+        // c[0] * x^(K - 1) + ... + c[K - 1]
+        template <std::size_t N, std::floating_point T, std::size_t K>
+        UI_ALWAYS_INLINE auto horner(
+            Vec<N, T> const& x,
+            std::array<T, K> const& c
+        ) noexcept -> Vec<N, T> {
+            auto res = Vec<N, T>::load(c[0]);
+            for (auto i = 1ul; i < K; ++i) {
+                res = ui::fused_mul_acc(Vec<N, T>::load(c[i]), res, x, op::add_t{});
+            }
+            return res;
+        }
+
+        // Error-free transformations; `two_prod` splits the operands by masking the representation
+        // so that it stays exact whether or not the compiler contracts the products.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto fast_two_sum(Vec<N, T> const& a, Vec<N, T> const& b, Vec<N, T>& lo) noexcept -> Vec<N, T> {
+            auto const s = a + b;
+            lo = b - (s - a);
+            return s;
+        }
+
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto two_sum(Vec<N, T> const& a, Vec<N, T> const& b, Vec<N, T>& lo) noexcept -> Vec<N, T> {
+            auto const s = a + b;
+            auto const bb = s - a;
+            lo = (a - (s - bb)) + (b - bb);
+            return s;
+        }
+
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto two_prod(Vec<N, T> const& a, Vec<N, T> const& b, Vec<N, T>& lo) noexcept -> Vec<N, T> {
+            using int_t = typename FloatBits<T>::int_t;
+            auto const mask = Vec<N, int_t>::load(FloatBits<T>::hi_mask);
+            auto const ah = ui::rcast<T>(ui::rcast<int_t>(a) & mask);
+            auto const bh = ui::rcast<T>(ui::rcast<int_t>(b) & mask);
+            auto const al = a - ah;
+            auto const bl = b - bh;
+            auto const p = a * b;
+            lo = (((ah * bh - p) + ah * bl) + al * bh) + al * bl;
+            return p;
+        }
+
+        // (a + a_lo) * (b + b_lo) + (c + c_lo) in double-double for |c| >= |a * b|.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto mul_add_dd(
+            Vec<N, T> const& a, Vec<N, T> const& a_lo,
+            Vec<N, T> const& b, Vec<N, T> const& b_lo,
+            Vec<N, T> const& c, Vec<N, T> const& c_lo,
+            Vec<N, T>& lo
+        ) noexcept -> Vec<N, T> {
+            auto p_lo = Vec<N, T>{};
+            auto const p = two_prod(a, b, p_lo);
+            p_lo = p_lo + a * b_lo + a_lo * b;
+            auto const res = fast_two_sum(c, p, lo);
+            lo = lo + p_lo + c_lo;
+            return res;
+        }
+
+        // x * 2^n for integer lanes n of at most twice the exponent range; the scale is split into
+        // two normal factors so that results in the subnormal range are rounded once.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto scale_by_pow2(
+            Vec<N, T> const& x,
+            Vec<N, typename FloatBits<T>::int_t> const& n
+        ) noexcept -> Vec<N, T> {
+            using bits = FloatBits<T>;
+            using int_t = typename bits::int_t;
+            auto const bias = Vec<N, int_t>::load(bits::bias);
+            auto const n1 = ui::shift_right<1>(n);
+            auto const n2 = n - n1;
+            auto const f1 = ui::rcast<T>(ui::shift_left<bits::mantissa>(n1 + bias));
+            auto const f2 = ui::rcast<T>(ui::shift_left<bits::mantissa>(n2 + bias));
+            return (x * f1) * f2;
+        }
+
+        // Coefficients of (e^r - 1 - r) / r^2 for |r| <= ln2 / 2.
+        template <std::floating_point T, Accuracy A>
+        constexpr auto exp_coeffs() noexcept {
+            if constexpr (std::same_as<T, float>) {
+                if constexpr (A == Accuracy::Ulp1) {
+                    return std::array<float, 6>{
+                        0.000198527617612853646278381f, 0.00139304355252534151077271f, 0.00833336077630519866943359f,
+                        0.0416664853692054748535156f, 0.166666671633720397949219f, 0.5f
+                    };
+                } else if constexpr (A == Accuracy::Ulp3_5) {
+                    return std::array<float, 5>{
+                        0.00139261818104924639325f, 0.00836317762999447253971f, 0.0416665546278780482579f,
+                        0.166665769982429249038f, 0.5f
+                    };
+                } else {
+                    return std::array<float, 3>{ 0.0417920052436149699805f, 0.167419101602579107398f, 0.5f };
+                }
+            } else {
+                if constexpr (A == Accuracy::Ulp1) {
+                    return std::array<double, 11>{
+                        2.08860621107283687536341e-09, 2.51112930892876518610661e-08, 2.75573911234900471893338e-07,
+                        2.75572362911928827629423e-06, 2.4801587159235472998791e-05, 0.000198412698960509205564975,
+                        0.00138888888889774492207962, 0.00833333333331652721664984, 0.0416666666666665047591422,
+                        0.166666666666666851703837, 0.5
+                    };
+                } else if constexpr (A == Accuracy::Ulp3_5) {
+                    return std::array<double, 10>{
+                        2.50950382510089577217e-08, 2.76200119605527873425e-07, 2.75572843019241694017e-06,
+                        2.48015215268671311242e-05, 0.000198412698468890190491, 0.00138888889169725139949,
+                        0.00833333333333653185465, 0.041666666666625130249, 0.166666666666666595276, 0.5
+                    };
+                } else {
+                    return std::array<double, 6>{
+                        0.000198909884549105197961, 0.00139336478629252990761, 0.00833331092761637966444,
+                        0.0416664649445057668553, 0.166666666816210909261, 0.500000001346388546388
+                    };
+                }
+            }
+        }
+
+        // Coefficients of R(z) / z where log(1 + f) = 2s + s * R(s^2) and s = f / (2 + f).
+        template <std::floating_point T, Accuracy A>
+        constexpr auto log_coeffs() noexcept {
+            if constexpr (std::same_as<T, float>) {
+                if constexpr (A == Accuracy::Ulp1) {
+                    return std::array<float, 4>{ 0.24279078841f, 0.28498786688f, 0.40000972152f, 0.66666662693f };
+                } else if constexpr (A == Accuracy::Ulp3_5) {
+                    return std::array<float, 3>{ 0.295800461683354079751f, 0.399887784336501001794f, 0.666666850447858974366f };
+                } else {
+                    return std::array<float, 2>{ 0.408583511361952932036f, 0.666634988565838365636f };
+                }
+            } else {
+                // A shorter polynomial does not stay within 3.5 ULP.
+                if constexpr (A == Accuracy::Ulp1 || A == Accuracy::Ulp3_5) {
+                    return std::array<double, 7>{
+                        1.479819860511658591e-01, 1.531383769920937332e-01, 1.818357216161805012e-01,
+                        2.222219843214978396e-01, 2.857142874366239149e-01, 3.999999999940941908e-01,
+                        6.666666666666735130e-01
+                    };
+                } else {
+                    return std::array<double, 4>{
+                        0.233305743143957985318, 0.285508168802521049967, 0.40000121874490321121,
+                        0.666666665544547552369
+                    };
+                }
+            }
+        }
+
+        template <std::floating_point T>
+        struct ExpConstants;
+
+        template <>
+        struct ExpConstants<float> {
+            static constexpr float log2e = 1.44269504088896341f;
+            static constexpr float ln2_hi = 0.693145751953125f;
+            static constexpr float ln2_lo = 1.428606765330187045e-06f;
+            static constexpr float ln2 = 0.693147180559945309417f;
+            // ln(FLT_MAX) and ln(FLT_TRUE_MIN / 2)
+            static constexpr float max = 88.72283935546875f;
+            static constexpr float min = -103.97208404541015625f;
+            static constexpr float max2 = 128.f;
+            static constexpr float min2 = -150.f;
+        };
+
+        template <>
+        struct ExpConstants<double> {
+            static constexpr double log2e = 1.4426950408889634;
+            static constexpr double ln2_hi = 6.93147180369123816490e-01;
+            static constexpr double ln2_lo = 1.90821492927058770002e-10;
+            static constexpr double ln2 = 0.693147180559945309417;
+            static constexpr double max = 709.782712893383973096;
+            static constexpr double min = -745.13321910194110842;
+            static constexpr double max2 = 1024.;
+            static constexpr double min2 = -1075.;
+        };
+
+        // 2^n * e^r for |r| <= ln2 / 2.
+        template <Accuracy A, std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto exp_kernel(
+            Vec<N, T> const& r,
+            Vec<N, typename FloatBits<T>::int_t> const& n
+        ) noexcept -> Vec<N, T> {
+            static constexpr auto coeffs = exp_coeffs<T, A>();
+            auto const one = Vec<N, T>::load(T(1));
+            if constexpr (A == Accuracy::Ulp1) {
+                // The rounding error of 1 + r is carried into the polynomial term.
+                auto lo = Vec<N, T>{};
+                auto const t = fast_two_sum(one, r, lo);
+                return scale_by_pow2(t + ui::fused_mul_acc(lo, r * r, horner(r, coeffs), op::add_t{}), n);
+            } else {
+                auto const p = ui::fused_mul_acc(r, r * r, horner(r, coeffs), op::add_t{});
+                return scale_by_pow2(one + p, n);
+            }
+        }
+
+        // Overflow, underflow and NaN for arguments outside [min, max].
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto exp_special(
+            Vec<N, T> const& x,
+            Vec<N, T> const& res,
+            T min,
+            T max
+        ) noexcept -> Vec<N, T> {
+            using vec_t = Vec<N, T>;
+            auto r = ui::bitwise_select(x > vec_t::load(max), vec_t::load(std::numeric_limits<T>::infinity()), res);
+            r = ui::bitwise_select(x < vec_t::load(min), vec_t::load(T(0)), r);
+            return ui::bitwise_select(x != x, x, r);
+        }
+
+        // e^(x + lo) where `lo` is a small correction of `x`; `lo` is ignored when `x` is out of range.
+        template <Accuracy A, std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto exp_impl(
+            Vec<N, T> const& x,
+            Vec<N, T> const& lo
+        ) noexcept -> Vec<N, T> {
+            using bits = FloatBits<T>;
+            using int_t = typename bits::int_t;
+            using consts = ExpConstants<T>;
+            using vec_t = Vec<N, T>;
+
+            auto const xc = ui::min(ui::max(x, vec_t::load(consts::min)), vec_t::load(consts::max));
+            auto const magic = vec_t::load(bits::round_magic);
+            auto const t = ui::fused_mul_acc(magic, xc, vec_t::load(consts::log2e), op::add_t{});
+            auto const n = t - magic;
+            auto const ni = ui::rcast<int_t>(t) - ui::rcast<int_t>(magic);
+
+            auto r = ui::fused_mul_acc(xc, n, vec_t::load(-consts::ln2_hi), op::add_t{});
+            r = ui::fused_mul_acc(r, n, vec_t::load(-consts::ln2_lo), op::add_t{});
+            r = r + lo;
+            return exp_special(x, exp_kernel<A>(r, ni), consts::min, consts::max);
+        }
+
+        // x = 2^k * (1 + f) with sqrt(1/2) <= 1 + f < sqrt(2) for positive finite x; subnormals are
+        // scaled up first.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto log_reduce(
+            Vec<N, T> const& x,
+            Vec<N, T>& f
+        ) noexcept -> Vec<N, T> {
+            using bits = FloatBits<T>;
+            using int_t = typename bits::int_t;
+            using vec_t = Vec<N, T>;
+            using ivec_t = Vec<N, int_t>;
+            static constexpr int_t one_bits = std::bit_cast<int_t>(T(1));
+            static constexpr int_t sqrt_half_bits = bits::sqrt_half;
+            static constexpr auto up = int_t{bits::mantissa + 2};
+
+            auto const tiny = x < vec_t::load(std::numeric_limits<T>::min());
+            auto const xs = ui::bitwise_select(tiny, x * vec_t::load(T(int_t{1} << up)), x);
+            auto const ix = ui::rcast<int_t>(xs) + ivec_t::load(one_bits - sqrt_half_bits);
+
+            // The biased exponent is read as a float by placing it under 2^mantissa.
+            auto const e = ui::shift_right<bits::mantissa>(ix) | ui::rcast<int_t>(vec_t::load(T(int_t{1} << bits::mantissa)));
+            auto k = ui::rcast<T>(e) - vec_t::load(T((int_t{1} << bits::mantissa) + bits::bias));
+            k = k - ui::bitwise_select(tiny, vec_t::load(T(up)), vec_t::load(T(0)));
+
+            auto const m = (ix & ivec_t::load((int_t{1} << bits::mantissa) - 1)) + ivec_t::load(sqrt_half_bits);
+            f = ui::rcast<T>(m) - vec_t::load(T(1));
+            return k;
+        }
+
+        // log(1 + f) = f - hfsq + s * (hfsq + R); returns f - hfsq and writes the rest to `tail`.
+        template <Accuracy A, std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto log1p_kernel(
+            Vec<N, T> const& f,
+            Vec<N, T>& hfsq,
+            Vec<N, T>& tail
+        ) noexcept -> void {
+            using vec_t = Vec<N, T>;
+            static constexpr auto coeffs = log_coeffs<T, A>();
+            auto const s = f / (vec_t::load(T(2)) + f);
+            auto const z = s * s;
+            auto const r = z * horner(z, coeffs);
+            hfsq = vec_t::load(T(0.5)) * f * f;
+            tail = s * (hfsq + r);
+        }
+
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto log_special(
+            Vec<N, T> const& x,
+            Vec<N, T> const& res
+        ) noexcept -> Vec<N, T> {
+            using vec_t = Vec<N, T>;
+            using limits = std::numeric_limits<T>;
+            auto r = ui::bitwise_select(x == vec_t::load(limits::infinity()), x, res);
+            r = ui::bitwise_select(x == vec_t::load(T(0)), vec_t::load(-limits::infinity()), r);
+            return ui::bitwise_select(x < vec_t::load(T(0)) | (x != x), vec_t::load(limits::quiet_NaN()), r);
+        }
+
+        // log(x) as hi + lo to about 2^-67 relative for positive finite double lanes. R(z) gets a
+        // longer polynomial than `log`, and its leading terms are evaluated in double-double.
+        template <std::size_t N>
+        UI_ALWAYS_INLINE auto log_dd(
+            Vec<N, double> const& x,
+            Vec<N, double>& lo
+        ) noexcept -> Vec<N, double> {
+            using vec_t = Vec<N, double>;
+            using consts = ExpConstants<double>;
+            // 2/3 does not fit in a double.
+            static constexpr double lg1_hi = 0.66666666666666663;
+            static constexpr double lg1_lo = 3.6917083973131426e-17;
+            static constexpr auto coeffs = std::array<double, 6>{
+                0.11839788126075077, 0.11695536484721949, 0.13335103206606059, 0.15384595314755373,
+                0.18181818172143988, 0.22222222224642973
+            };
+            static constexpr auto dd_coeffs = std::array<double, 2>{ 0.28571428571408827, 0.40000000000000046 };
+
+            auto f = vec_t{};
+            auto const k = log_reduce(x, f);
+
+            // s = f / (2 + f) with its rounding error.
+            auto d_lo = vec_t{};
+            auto const d = fast_two_sum(vec_t::load(2.0), f, d_lo);
+            auto const s = f / d;
+            auto p_lo = vec_t{};
+            auto const p = two_prod(s, d, p_lo);
+            auto const s_lo = (((f - p) - p_lo) - s * d_lo) / d;
+
+            auto z_lo = vec_t{};
+            auto const z = two_prod(s, s, z_lo);
+            z_lo = z_lo + vec_t::load(2.0) * s * s_lo;
+
+            // R = z * P(z)
+            auto const zero = vec_t::load(0.0);
+            auto q_lo = zero;
+            auto q = horner(z, coeffs);
+            for (auto c: dd_coeffs) {
+                q = mul_add_dd(q, q_lo, z, z_lo, vec_t::load(c), zero, q_lo);
+            }
+            q = mul_add_dd(q, q_lo, z, z_lo, vec_t::load(lg1_hi), vec_t::load(lg1_lo), q_lo);
+            auto r_lo = vec_t{};
+            auto const r = two_prod(z, q, r_lo);
+            r_lo = r_lo + z * q_lo + z_lo * q;
+
+            // log(1 + f) = 2s + s * R
+            auto m_lo = vec_t{};
+            auto const m = two_prod(s, r, m_lo);
+            m_lo = m_lo + s * r_lo + s_lo * r;
+            auto l_lo = vec_t{};
+            auto const l = fast_two_sum(vec_t::load(2.0) * s, m, l_lo);
+            l_lo = l_lo + vec_t::load(2.0) * s_lo + m_lo;
+
+            // k * ln2_hi is exact.
+            auto h_lo = vec_t{};
+            auto const h = two_sum(k * vec_t::load(consts::ln2_hi), l, h_lo);
+            h_lo = h_lo + l_lo + k * vec_t::load(consts::ln2_lo);
+            return fast_two_sum(h, h_lo, lo);
+        }
+
+        // IEEE special cases of pow on top of the result for |x|.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto pow_special(
+            Vec<N, T> const& x,
+            Vec<N, T> const& y,
+            Vec<N, T> res
+        ) noexcept -> Vec<N, T> {
+            using vec_t = Vec<N, T>;
+            using limits = std::numeric_limits<T>;
+            auto const zero = vec_t::load(T(0));
+            auto const one = vec_t::load(T(1));
+            auto const inf = vec_t::load(limits::infinity());
+            auto const ax = abs(x);
+            auto const neg = ui::rcast<typename FloatBits<T>::int_t>(x) < Vec<N, typename FloatBits<T>::int_t>::load(0);
+
+            auto const y_int = ui::round(y) == y;
+            auto const half = y * vec_t::load(T(0.5));
+            auto const y_odd = y_int & (ui::round(half) != half);
+
+            // |x| == 1 with an infinite y, and overflowing or vanishing 0 and inf.
+            res = ui::bitwise_select(ax == one, one, res);
+            res = ui::bitwise_select(ax == zero, ui::bitwise_select(y < zero, inf, zero), res);
+            res = ui::bitwise_select(ax == inf, ui::bitwise_select(y < zero, zero, inf), res);
+            // An odd y keeps the sign of x, including -0.
+            res = ui::bitwise_select(neg & y_odd, -res, res);
+            res = ui::bitwise_select((x < zero) & (x != -inf) & (ui::round(y) != y), vec_t::load(limits::quiet_NaN()), res);
+            res = ui::bitwise_select((x != x) | (y != y), x + y, res);
+            return ui::bitwise_select((y == zero) | (x == one), one, res);
+        }
+
+        template <std::floating_point T>
+        struct TrigConstants;
+
+        template <>
+        struct TrigConstants<float> {
+            static constexpr float two_over_pi = 0.636619772367581343076f;
+            // pi / 2 in four parts; the first three have 12 significant bits, so that their
+            // products with a quotient below 2^12 are exact.
+            static constexpr std::array<float, 4> pio2{
+                0x1.922p+0f, -0x1.2aep-18f, -0x1.deap-31f, 0x1.184698p-44f
+            };
+            // Arguments beyond it are reduced by the scalar library.
+            static constexpr float reduce_max = 0x1.8p12f;
+            static constexpr float pio2_hi = 1.57079637f;
+            static constexpr float pio2_lo = -4.37113883e-08f;
+            static constexpr float pio4_hi = 0.785398185f;
+            static constexpr float pi_hi = 3.14159274f;
+            static constexpr float pi_lo = -8.74227766e-08f;
+            // atan(0.5), atan(1) and atan(1.5)
+            static constexpr std::array<float, 3> atan_hi{ 0.463647604f, 0.785398185f, 0.982793748f };
+            static constexpr std::array<float, 3> atan_lo{ 5.01215869e-09f, -2.18556941e-08f, -2.51314241e-08f };
+
+            // sin(x) = x + x^3 * P(x^2), cos(x) = 1 - x^2 / 2 + x^4 * P(x^2) and
+            // tan(x) = x + x^3 * P(x^2) for |x| <= pi / 4.
+            static constexpr std::array<float, 4> sin{ 2.72499256e-06f, -0.00019840087f, 0.00833333191f, -0.166666672f };
+            static constexpr std::array<float, 4> cos{ -2.7300959e-07f, 2.48005999e-05f, -0.00138888881f, 0.0416666679f };
+            static constexpr std::array<float, 7> tan{
+                0.00384313986f, 0.0011853216f, 0.0099621471f, 0.0216211267f, 0.0539944656f, 0.133332312f, 0.333333343f
+            };
+            // asin(x) = x + x^3 * P(x^2) for |x| <= 0.5, atan(x) likewise for |x| <= 7 / 16.
+            static constexpr std::array<float, 6> asin{
+                0.0336908475f, 0.0171492379f, 0.0311006624f, 0.0445994027f, 0.0750009418f, 0.166666657f
+            };
+            static constexpr std::array<float, 5> atan{ -0.0621581152f, 0.106683858f, -0.142565757f, 0.199993148f, -0.333333313f };
+        };
+
+        template <>
+        struct TrigConstants<double> {
+            static constexpr double two_over_pi = 0.636619772367581343076;
+            // 33 significant bits in the first three parts.
+            static constexpr std::array<double, 4> pio2{
+                1.57079632673412561417e+00, 6.07710050630396597660e-11,
+                2.02226624871116645580e-21, 8.47842766036889956997e-32
+            };
+            static constexpr double reduce_max = 0x1.8p20;
+            static constexpr double pio2_hi = 1.5707963267948966;
+            static constexpr double pio2_lo = 6.123233995736766e-17;
+            static constexpr double pio4_hi = 0.78539816339744828;
+            static constexpr double pi_hi = 3.1415926535897931;
+            static constexpr double pi_lo = 1.2246467991473532e-16;
+            static constexpr std::array<double, 3> atan_hi{ 0.46364760900080609, 0.78539816339744828, 0.98279372324732905 };
+            static constexpr std::array<double, 3> atan_lo{ 2.2698777452961687e-17, 3.061616997868383e-17, 1.3903311031230998e-17 };
+
+            static constexpr std::array<double, 7> sin{
+                -7.5866971177069183e-13, 1.6058531618986147e-10, -2.5052106232447578e-08, 2.7557319219339167e-06,
+                -0.00019841269841265065, 0.0083333333333333315, -0.16666666666666666
+            };
+            static constexpr std::array<double, 6> cos{
+                -1.1382632425521719e-11, 2.0876146268403199e-09, -2.7557317271729793e-07, 2.4801587298765689e-05,
+                -0.0013888888888887398, 0.041666666666666664
+            };
+            static constexpr std::array<double, 15> tan{
+                8.48334725267473e-06, -1.8315342802086701e-05, 3.6516181936133423e-05, -1.1013613221811342e-05,
+                5.5587847105701477e-05, 8.9985202983422889e-05, 0.00024122635351268799, 0.00058957560615445547,
+                0.0014559027390503058, 0.0035921209805615966, 0.0088632360034858176, 0.021869488517074379,
+                0.053968253968655462, 0.13333333333333, 0.33333333333333331
+            };
+            static constexpr std::array<double, 12> asin{
+                0.028169218060881414, -0.010749050339697808, 0.016035514349148822, 0.0078029494773533175,
+                0.011875494382636922, 0.013929652902326633, 0.017355259955786323, 0.02237204763174451,
+                0.03038194736709848, 0.044642857103423646, 0.075000000000207637, 0.16666666666666649
+            };
+            static constexpr std::array<double, 11> atan{
+                -0.017547235157290005, 0.037825218661067118, -0.050339427764858481, 0.058477247206451061,
+                -0.066632392991071362, 0.076920873487671682, -0.090909001955601476, 0.11111110900560475,
+                -0.1428571428314864, 0.19999999999987769, -0.33333333333333326
+            };
+        };
+
+        // x = n * pi / 2 + r + r_lo with |r| <= pi / 4 for |x| <= reduce_max (Cody-Waite); returns n.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto trig_reduce(
+            Vec<N, T> const& x,
+            Vec<N, T>& r,
+            Vec<N, T>& r_lo
+        ) noexcept -> Vec<N, typename FloatBits<T>::int_t> {
+            using bits = FloatBits<T>;
+            using int_t = typename bits::int_t;
+            using consts = TrigConstants<T>;
+            using vec_t = Vec<N, T>;
+
+            auto const magic = vec_t::load(bits::round_magic);
+            auto const t = ui::fused_mul_acc(magic, x, vec_t::load(consts::two_over_pi), op::add_t{});
+            auto const n = t - magic;
+
+            // The first product cancels exactly; the rounding errors of the next two are carried.
+            auto lo = vec_t::load(T(0));
+            auto e = vec_t{};
+            r = x - n * vec_t::load(consts::pio2[0]);
+            r = two_sum(r, n * vec_t::load(-consts::pio2[1]), e);
+            lo = lo + e;
+            r = two_sum(r, n * vec_t::load(-consts::pio2[2]), e);
+            lo = ui::fused_mul_acc(lo + e, n, vec_t::load(-consts::pio2[3]), op::add_t{});
+            r = fast_two_sum(r, lo, r_lo);
+            return ui::rcast<int_t>(t) - ui::rcast<int_t>(magic);
+        }
+
+        // sin(r + r_lo) for |r| <= pi / 4.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto sin_kernel(Vec<N, T> const& r, Vec<N, T> const& r_lo) noexcept -> Vec<N, T> {
+            using vec_t = Vec<N, T>;
+            auto const z = r * r;
+            auto const p = horner(z, TrigConstants<T>::sin);
+            // cos(r) * r_lo with cos(r) ~ 1 - z / 2
+            auto const lo = ui::fused_mul_acc(r_lo, vec_t::load(T(-0.5)) * z, r_lo, op::add_t{});
+            return r + ui::fused_mul_acc(lo, r * z, p, op::add_t{});
+        }
+
+        // cos(r + r_lo) for |r| <= pi / 4; 1 - z / 2 is summed with its rounding error.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto cos_kernel(Vec<N, T> const& r, Vec<N, T> const& r_lo) noexcept -> Vec<N, T> {
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const z = r * r;
+            auto const hz = vec_t::load(T(0.5)) * z;
+            auto const w = one - hz;
+            auto const p = horner(z, TrigConstants<T>::cos);
+            auto const tail = ui::fused_mul_acc(-(r * r_lo), z * z, p, op::add_t{});
+            return w + (((one - w) - hz) + tail);
+        }
+
+        // Scalar library results for lanes the reduction does not cover, including infinities.
+        template <std::size_t N, std::floating_point T, typename Fn>
+        UI_ALWAYS_INLINE auto trig_large(
+            Vec<N, T> const& x,
+            Vec<N, T> const& res,
+            Fn&& fn
+        ) noexcept -> Vec<N, T> {
+            auto const large = abs(x) > Vec<N, T>::load(TrigConstants<T>::reduce_max);
+            auto const any_large = [&] {
+                if constexpr (N == 1) return large.val != 0;
+                else return ui::any(large);
+            }();
+            if (!any_large) [[likely]] return res;
+            return ui::bitwise_select(large, ui::map(fn, x), res);
+        }
+
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto copy_sign(Vec<N, T> const& mag, Vec<N, T> const& sign) noexcept -> Vec<N, T> {
+            using int_t = typename FloatBits<T>::int_t;
+            auto const mask = Vec<N, int_t>::load(std::numeric_limits<int_t>::min());
+            return ui::rcast<T>(ui::rcast<int_t>(mag) | (ui::rcast<int_t>(sign) & mask));
+        }
+
+        // Flips the sign of the lanes where bit 1 of `n` is set.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto negate_quadrant(
+            Vec<N, T> const& v,
+            Vec<N, typename FloatBits<T>::int_t> const& n
+        ) noexcept -> Vec<N, T> {
+            using int_t = typename FloatBits<T>::int_t;
+            static constexpr auto shift = sizeof(int_t) * 8 - 2;
+            auto const s = ui::shift_left<shift>(n & Vec<N, int_t>::load(2));
+            return ui::rcast<T>(ui::rcast<int_t>(v) ^ s);
+        }
+
+        // asin(s) for the argument `s = sqrt(z)` of the reflected range, as hi + lo with `hi` exact
+        // when doubled; the polynomial takes z directly.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto asin_sqrt(
+            Vec<N, T> const& z,
+            Vec<N, T>& s,
+            Vec<N, T>& lo
+        ) noexcept -> Vec<N, T> {
+            using int_t = typename FloatBits<T>::int_t;
+            s = ui::sqrt(z);
+            // s = f + c with f * f exact.
+            auto const f = ui::rcast<T>(ui::rcast<int_t>(s) & Vec<N, int_t>::load(FloatBits<T>::hi_mask));
+            auto c = (z - f * f) / (s + f);
+            // z == 0 at |x| == 1, where the division above is 0 / 0.
+            c = bitwise_select(z == Vec<N, T>::load(T(0)), z, c);
+            lo = ui::fused_mul_acc(c, s * z, horner(z, TrigConstants<T>::asin), op::add_t{});
+            return f;
+        }
+
+        // atan(x) for x >= 0 with the argument reduction of fdlibm: x is moved next to one of
+        // 0, 0.5, 1, 1.5 or infinity and atan of the offset is added.
+        template <std::size_t N, std::floating_point T>
+        UI_ALWAYS_INLINE auto atan_positive(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+            using consts = TrigConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const one = vec_t::load(T(1));
+            auto const zero = vec_t::load(T(0));
+
+            auto const m0 = x < vec_t::load(T(7. / 16.));
+            auto const m1 = x < vec_t::load(T(11. / 16.));
+            auto const m2 = x < vec_t::load(T(19. / 16.));
+            auto const m3 = x < vec_t::load(T(39. / 16.));
+
+            // Selected from the widest interval down, so that NaN lanes take the last one.
+            auto num = vec_t::load(T(-1));
+            auto den = x;
+            auto hi = vec_t::load(consts::pio2_hi);
+            auto lo = vec_t::load(consts::pio2_lo);
+            auto const h = vec_t::load(T(1.5));
+            num = ui::bitwise_select(m3, x - h, num);
+            den = ui::bitwise_select(m3, ui::fused_mul_acc(one, h, x, op::add_t{}), den);
+            hi = ui::bitwise_select(m3, vec_t::load(consts::atan_hi[2]), hi);
+            lo = ui::bitwise_select(m3, vec_t::load(consts::atan_lo[2]), lo);
+            num = ui::bitwise_select(m2, x - one, num);
+            den = ui::bitwise_select(m2, x + one, den);
+            hi = ui::bitwise_select(m2, vec_t::load(consts::atan_hi[1]), hi);
+            lo = ui::bitwise_select(m2, vec_t::load(consts::atan_lo[1]), lo);
+            num = ui::bitwise_select(m1, (x + x) - one, num);
+            den = ui::bitwise_select(m1, vec_t::load(T(2)) + x, den);
+            hi = ui::bitwise_select(m1, vec_t::load(consts::atan_hi[0]), hi);
+            lo = ui::bitwise_select(m1, vec_t::load(consts::atan_lo[0]), lo);
+            num = ui::bitwise_select(m0, x, num);
+            den = ui::bitwise_select(m0, one, den);
+            hi = ui::bitwise_select(m0, zero, hi);
+            lo = ui::bitwise_select(m0, zero, lo);
+
+            auto const t = num / den;
+            auto const z = t * t;
+            auto const p = horner(z, consts::atan);
+            return hi + (ui::fused_mul_acc(lo, t * z, p, op::add_t{}) + t);
+        }
+    } // namespace internal
+
+// MARK: Exponential
+    /**
+     * @brief e^x
+     */
+    template <Accuracy A = Accuracy::Ulp1, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto exp(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(exp<A>(cast<float>(x)));
+        } else {
+            return ui::internal::exp_impl<A>(x, Vec<N, T>::load(T(0)));
+        }
+    }
+
+    /**
+     * @brief 2^x
+     */
+    template <Accuracy A = Accuracy::Ulp1, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto exp2(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(exp2<A>(cast<float>(x)));
+        } else {
+            using bits = ui::internal::FloatBits<T>;
+            using int_t = typename bits::int_t;
+            using consts = ui::internal::ExpConstants<T>;
+            using vec_t = Vec<N, T>;
+            // 2^x = 2^n * e^(r * ln2) where n = round(x) and r = x - n is exact.
+            auto const xc = min(max(x, vec_t::load(consts::min2)), vec_t::load(consts::max2));
+            auto const magic = vec_t::load(bits::round_magic);
+            auto const t = xc + magic;
+            auto const n = t - magic;
+            auto const ni = rcast<int_t>(t) - rcast<int_t>(magic);
+            auto const r = xc - n;
+
+            auto const res = ui::internal::exp_kernel<A>(r * vec_t::load(consts::ln2), ni);
+            return ui::internal::exp_special(x, res, consts::min2, consts::max2);
+        }
+    }
+// !MARK
+
+// MARK: Logarithm
+    /**
+     * @brief Natural logarithm; NaN for negative lanes and -inf for zero.
+     */
+    template <Accuracy A = Accuracy::Ulp1, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto log(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(log<A>(cast<float>(x)));
+        } else {
+            using consts = ui::internal::ExpConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto f = vec_t{};
+            auto const k = ui::internal::log_reduce(x, f);
+            auto hfsq = vec_t{};
+            auto tail = vec_t{};
+            ui::internal::log1p_kernel<A>(f, hfsq, tail);
+            auto const lo = fused_mul_acc(tail, k, vec_t::load(consts::ln2_lo), op::add_t{});
+            auto const res = fused_mul_acc((lo - hfsq) + f, k, vec_t::load(consts::ln2_hi), op::add_t{});
+            return ui::internal::log_special(x, res);
+        }
+    }
+
+    /**
+     * @brief Base-2 logarithm; exact for powers of two.
+     */
+    template <Accuracy A = Accuracy::Ulp1, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto log2(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(log2<A>(cast<float>(x)));
+        } else {
+            using bits = ui::internal::FloatBits<T>;
+            using int_t = typename bits::int_t;
+            using vec_t = Vec<N, T>;
+            // 1 / ln2 split so that hi * (f - hfsq)_hi is exact.
+            static constexpr int_t hi_mask = std::same_as<T, float> ? bits::hi_mask : static_cast<int_t>(0xffff'ffff'0000'0000);
+            static constexpr T inv_ln2_hi = std::same_as<T, float> ? T(1.4428710938e+00) : T(1.44269504072144627571e+00);
+            static constexpr T inv_ln2_lo = std::same_as<T, float> ? T(-1.7605285393e-04) : T(1.67517131648865118353e-10);
+
+            auto f = vec_t{};
+            auto const k = ui::internal::log_reduce(x, f);
+            auto hfsq = vec_t{};
+            auto tail = vec_t{};
+            ui::internal::log1p_kernel<A>(f, hfsq, tail);
+
+            auto const hi = ui::rcast<T>(ui::rcast<int_t>(f - hfsq) & Vec<N, int_t>::load(hi_mask));
+            auto const lo = ((f - hi) - hfsq) + tail;
+            auto const val_hi = hi * vec_t::load(inv_ln2_hi);
+            auto val_lo = (lo + hi) * vec_t::load(inv_ln2_lo) + lo * vec_t::load(inv_ln2_hi);
+            auto const w = k + val_hi;
+            val_lo = val_lo + ((k - w) + val_hi);
+            return ui::internal::log_special(x, val_lo + w);
+        }
+    }
+// !MARK
+
+// MARK: Power
+    /**
+     * @brief x^y with the special cases of `std::pow`; negative x needs an integral y.
+     */
+    template <Accuracy A = Accuracy::Ulp1, std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto pow(Vec<N, T> const& x, Vec<N, T> const& y) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(pow<A>(cast<float>(x), cast<float>(y)));
+        } else if constexpr (std::same_as<T, float> && A != Accuracy::Fast) {
+            // The double product y * log(x) is accurate well past the float significand.
+            auto const dx = cast<double>(x);
+            auto const dy = cast<double>(y);
+            auto const res = ui::internal::exp_impl<Accuracy::Ulp1>(dy * log(abs(dx)), Vec<N, double>::load(0.0));
+            return ui::internal::pow_special(x, y, cast<float>(res));
+        } else if constexpr (A == Accuracy::Fast) {
+            auto const res = ui::internal::exp_impl<A>(y * log<A>(abs(x)), Vec<N, T>::load(T(0)));
+            return ui::internal::pow_special(x, y, res);
+        } else {
+            auto l_lo = Vec<N, T>{};
+            auto const l = ui::internal::log_dd(abs(x), l_lo);
+            auto p_lo = Vec<N, T>{};
+            auto const p = ui::internal::two_prod(y, l, p_lo);
+            p_lo = fused_mul_acc(p_lo, y, l_lo, op::add_t{});
+            auto const res = ui::internal::exp_impl<A>(p, p_lo);
+            return ui::internal::pow_special(x, y, res);
+        }
+    }
+// !MARK
+
+// MARK: Trigonometric
+    /**
+     * @brief Sine of every lane; lanes beyond the range of the Cody-Waite reduction, 6144 for
+     * `float` and 1.5 * 2^20 for `double`, fall back to `std::sin`.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto sin(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(sin(cast<float>(x)));
+        } else {
+            using int_t = typename ui::internal::FloatBits<T>::int_t;
+            auto r = Vec<N, T>{};
+            auto r_lo = Vec<N, T>{};
+            auto const n = ui::internal::trig_reduce(x, r, r_lo);
+            auto const odd = (n & Vec<N, int_t>::load(1)) != Vec<N, int_t>::load(0);
+            auto res = bitwise_select(odd, ui::internal::cos_kernel(r, r_lo), ui::internal::sin_kernel(r, r_lo));
+            res = ui::internal::negate_quadrant(res, n);
+            // Keeps the sign of zero.
+            res = bitwise_select(x == Vec<N, T>::load(T(0)), x, res);
+            return ui::internal::trig_large(x, res, [](T v) { return std::sin(v); });
+        }
+    }
+
+    /**
+     * @brief Cosine of every lane; see `sin` for the range of the reduction.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto cos(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(cos(cast<float>(x)));
+        } else {
+            using int_t = typename ui::internal::FloatBits<T>::int_t;
+            auto r = Vec<N, T>{};
+            auto r_lo = Vec<N, T>{};
+            auto const n = ui::internal::trig_reduce(x, r, r_lo);
+            auto const odd = (n & Vec<N, int_t>::load(1)) != Vec<N, int_t>::load(0);
+            auto const res = bitwise_select(odd, ui::internal::sin_kernel(r, r_lo), ui::internal::cos_kernel(r, r_lo));
+            return ui::internal::trig_large(
+                x,
+                ui::internal::negate_quadrant(res, n + Vec<N, int_t>::load(1)),
+                [](T v) { return std::cos(v); }
+            );
+        }
+    }
+
+    /**
+     * @brief Sine and cosine from one argument reduction.
+     * @return pair of sine and cosine.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto sincos(Vec<N, T> const& x) noexcept -> std::pair<Vec<N, T>, Vec<N, T>> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            auto const [s, c] = sincos(cast<float>(x));
+            return { cast<T>(s), cast<T>(c) };
+        } else {
+            using int_t = typename ui::internal::FloatBits<T>::int_t;
+            auto r = Vec<N, T>{};
+            auto r_lo = Vec<N, T>{};
+            auto const n = ui::internal::trig_reduce(x, r, r_lo);
+            auto const odd = (n & Vec<N, int_t>::load(1)) != Vec<N, int_t>::load(0);
+            auto const sk = ui::internal::sin_kernel(r, r_lo);
+            auto const ck = ui::internal::cos_kernel(r, r_lo);
+            auto s = ui::internal::negate_quadrant(bitwise_select(odd, ck, sk), n);
+            s = bitwise_select(x == Vec<N, T>::load(T(0)), x, s);
+            auto const c = ui::internal::negate_quadrant(bitwise_select(odd, sk, ck), n + Vec<N, int_t>::load(1));
+            return {
+                ui::internal::trig_large(x, s, [](T v) { return std::sin(v); }),
+                ui::internal::trig_large(x, c, [](T v) { return std::cos(v); })
+            };
+        }
+    }
+
+    /**
+     * @brief Tangent of every lane; see `sin` for the range of the reduction.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto tan(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(tan(cast<float>(x)));
+        } else {
+            using int_t = typename ui::internal::FloatBits<T>::int_t;
+            using vec_t = Vec<N, T>;
+            auto r = vec_t{};
+            auto r_lo = vec_t{};
+            auto const n = ui::internal::trig_reduce(x, r, r_lo);
+            auto const z = r * r;
+            // tan(r + r_lo) = tan(r) + (1 + tan(r)^2) * r_lo
+            auto tail = fused_mul_acc(r_lo, z, r_lo, op::add_t{});
+            tail = fused_mul_acc(tail, r * z, ui::internal::horner(z, ui::internal::TrigConstants<T>::tan), op::add_t{});
+            auto t_lo = vec_t{};
+            auto const t = ui::internal::fast_two_sum(r, tail, t_lo);
+
+            // Odd quadrants take -1 / (t + t_lo), corrected by the residual of the division.
+            auto const q = vec_t::load(T(-1)) / t;
+            auto p_lo = vec_t{};
+            auto const p = ui::internal::two_prod(q, t, p_lo);
+            auto const e = (vec_t::load(T(1)) + p) + p_lo;
+            auto const inv = fused_mul_acc(q, q, fused_mul_acc(e, q, t_lo, op::add_t{}), op::add_t{});
+
+            auto const odd = (n & Vec<N, int_t>::load(1)) != Vec<N, int_t>::load(0);
+            auto res = bitwise_select(odd, inv, t);
+            res = bitwise_select(x == vec_t::load(T(0)), x, res);
+            return ui::internal::trig_large(x, res, [](T v) { return std::tan(v); });
+        }
+    }
+// !MARK
+
+// MARK: Inverse Trigonometric
+    /**
+     * @brief Arcsine in [-pi / 2, pi / 2]; NaN outside [-1, 1].
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto asin(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(asin(cast<float>(x)));
+        } else {
+            using consts = ui::internal::TrigConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const ax = abs(x);
+            auto const z = ax * ax;
+            auto const small = fused_mul_acc(ax, ax * z, ui::internal::horner(z, consts::asin), op::add_t{});
+
+            // asin(x) = pi / 2 - 2 * asin(sqrt((1 - x) / 2))
+            auto s = vec_t{};
+            auto lo = vec_t{};
+            auto const f = ui::internal::asin_sqrt((vec_t::load(T(1)) - ax) * vec_t::load(T(0.5)), s, lo);
+            auto const pio4 = vec_t::load(consts::pio4_hi);
+            auto const two = vec_t::load(T(2));
+            auto const pio2_lo = vec_t::load(consts::pio2_lo);
+            auto large = pio4 - ((two * lo - pio2_lo) - (pio4 - two * f));
+            // Close to one the result is far from pi / 4 and the split around it only adds rounding.
+            auto const edge = vec_t::load(consts::pio2_hi) - (two * (f + lo) - pio2_lo);
+            large = bitwise_select(ax > vec_t::load(T(0.975)), edge, large);
+
+            return ui::internal::copy_sign(bitwise_select(ax < vec_t::load(T(0.5)), small, large), x);
+        }
+    }
+
+    /**
+     * @brief Arccosine in [0, pi]; NaN outside [-1, 1].
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto acos(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(acos(cast<float>(x)));
+        } else {
+            using consts = ui::internal::TrigConstants<T>;
+            using vec_t = Vec<N, T>;
+            auto const ax = abs(x);
+            auto const z = x * x;
+            auto const pio2_lo = vec_t::load(consts::pio2_lo);
+            auto const poly = x * z * ui::internal::horner(z, consts::asin);
+            auto const small = vec_t::load(consts::pio2_hi) - (x - (pio2_lo - poly));
+
+            // acos(|x|) = 2 * asin(sqrt((1 - |x|) / 2)) and acos(-|x|) = pi - acos(|x|)
+            auto s = vec_t{};
+            auto lo = vec_t{};
+            auto const f = ui::internal::asin_sqrt((vec_t::load(T(1)) - ax) * vec_t::load(T(0.5)), s, lo);
+            auto const two = vec_t::load(T(2));
+            auto const pos = two * (f + lo);
+            auto const neg = vec_t::load(consts::pi_hi) - two * (f + (lo - pio2_lo));
+
+            auto const res = bitwise_select(x < vec_t::load(T(0)), neg, pos);
+            return bitwise_select(ax < vec_t::load(T(0.5)), small, res);
+        }
+    }
+
+    /**
+     * @brief Arctangent in [-pi / 2, pi / 2].
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto atan(Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(atan(cast<float>(x)));
+        } else {
+            return ui::internal::copy_sign(ui::internal::atan_positive(abs(x)), x);
+        }
+    }
+
+    /**
+     * @brief Angle of the point (x, y) in [-pi, pi] with the special cases of `std::atan2`.
+     */
+    template <std::size_t N, std::floating_point T>
+    UI_ALWAYS_INLINE auto atan2(Vec<N, T> const& y, Vec<N, T> const& x) noexcept -> Vec<N, T> {
+        if constexpr (ui::internal::is_fp16<T>) {
+            return cast<T>(atan2(cast<float>(y), cast<float>(x)));
+        } else {
+            using consts = ui::internal::TrigConstants<T>;
+            using int_t = typename ui::internal::FloatBits<T>::int_t;
+            using vec_t = Vec<N, T>;
+            auto const ax = abs(x);
+            auto const ay = abs(y);
+            auto const swap = ay > ax;
+            auto const num = min(ax, ay);
+            auto const den = max(ax, ay);
+
+            // Both zero or both infinite.
+            auto t = num / den;
+            t = bitwise_select(den == vec_t::load(T(0)), vec_t::load(T(0)), t);
+            t = bitwise_select(num == vec_t::load(std::numeric_limits<T>::infinity()), vec_t::load(T(1)), t);
+
+            auto r = ui::internal::atan_positive(t);
+            r = bitwise_select(swap, (vec_t::load(consts::pio2_hi) - r) + vec_t::load(consts::pio2_lo), r);
+            auto const x_neg = rcast<int_t>(x) < Vec<N, int_t>::load(0);
+            r = bitwise_select(x_neg, (vec_t::load(consts::pi_hi) - r) + vec_t::load(consts::pi_lo), r);
+            r = ui::internal::copy_sign(r, y);
+            return bitwise_select((x != x) | (y != y), x + y, r);
+        }
+    }
+// !MARK
+
+} // namespace ui
+
+#endif // AMT_UI_TRANSCENDENTAL_HPP
@@ -315,8 +315,7 @@ UI_ALWAYS_INLINE constexpr auto operator<<(ui::Vec<N, T> const& lhs, ui::Vec<N,
 template <std::size_t N, std::integral T, std::convertible_to<std::make_unsigned_t<T>> U>
 UI_ALWAYS_INLINE constexpr auto operator<<(ui::Vec<N, T> const& lhs, U const rhs) noexcept -> ui::Vec<N, T> {
     using namespace ui;
-    using type = std::make_unsigned_t<T>;
-    return lhs << Vec<N, T>::load(static_cast<type>(rhs));
+    return shift_left(lhs, static_cast<unsigned>(rhs));
 }
 
 template <std::size_t N, std::integral T, std::convertible_to<std::make_unsigned_t<T>> U>
@@ -337,8 +336,7 @@ UI_ALWAYS_INLINE constexpr auto operator>>(ui::Vec<N, T> const& lhs, ui::Vec<N,
 template <std::size_t N, std::integral T, std::convertible_to<std::make_unsigned_t<T>> U>
 UI_ALWAYS_INLINE constexpr auto operator>>(ui::Vec<N, T> const& lhs, U const rhs) noexcept -> ui::Vec<N, T> {
     using namespace ui;
-    using type = std::make_unsigned_t<T>;
-    return lhs >> Vec<N, T>::load(static_cast<type>(rhs));
+    return shift_right(lhs, static_cast<unsigned>(rhs));
 }
 
 template <std::size_t N, std::integral T, std::convertible_to<std::make_unsigned_t<T>> U>
@@ -460,6 +458,101 @@ namespace ui {
         return std::isfinite(dot(v, Vec<N, T>::load(0)));
     }
 
+    namespace internal {
+        // Index of the first active lane, or `N` if none; `IntMask` covers the widths that fit
+        // a machine integer.
+        template <std::size_t N, typename T>
+        UI_ALWAYS_INLINE constexpr auto first_match(mask_t<N, T> const& m) noexcept -> std::size_t {
+            if constexpr (N == 8 || N == 16 || N == 32 || N == 64) {
+                return std::min(IntMask<N, mask_inner_t<T>>(m).first_match(), N);
+            } else {
+                for (auto i = 0ul; i < N; ++i) {
+                    if (m[i]) return i;
+                }
+                return N;
+            }
+        }
+
+        template <bool IsMax, std::size_t N, typename T>
+        UI_ALWAYS_INLINE constexpr auto arg_extremum(Vec<N, T> const& v) noexcept -> std::size_t {
+            if constexpr (N == 1) {
+                return 0;
+            } else {
+                auto const m = [&v] {
+                    if constexpr (std::floating_point<T>) {
+                        if constexpr (IsMax) return fold(v, op::maxnm_t{});
+                        else return fold(v, op::minnm_t{});
+                    } else {
+                        if constexpr (IsMax) return fold(v, op::max_t{});
+                        else return fold(v, op::min_t{});
+                    }
+                }();
+                auto const idx = first_match<N, T>(cmp(v, Vec<N, T>::load(m), op::equal_t{}));
+                return idx == N ? 0 : idx;
+            }
+        }
+    } // namespace internal
+
+    /**
+     * @brief Lane of the smallest element; the first one on ties. NaN lanes are ignored and an
+     * all-NaN vector returns 0.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto argmin(
+        Vec<N, T> const& v
+    ) noexcept -> std::size_t {
+        return ui::internal::arg_extremum<false>(v);
+    }
+
+    /**
+     * @brief Lane of the largest element; the first one on ties. NaN lanes are ignored and an
+     * all-NaN vector returns 0.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto argmax(
+        Vec<N, T> const& v
+    ) noexcept -> std::size_t {
+        return ui::internal::arg_extremum<true>(v);
+    }
+
+    /**
+     * @brief Inclusive prefix sum over the lanes; `res[i] = v[0] + ... + v[i]`.
+     * Uses log2(N) shift-and-add steps per 128-bit register; wider vectors carry the total of
+     * the low half into the high half.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto inclusive_scan(
+        Vec<N, T> const& v
+    ) noexcept -> Vec<N, T> {
+        if constexpr (N == 1) {
+            return v;
+        } else if constexpr (sizeof(v) > 16) {
+            auto const lo = inclusive_scan(v.lo);
+            auto const hi = inclusive_scan(v.hi) + Vec<N / 2, T>::template load<N / 2 - 1>(lo);
+            return join(lo, hi);
+        } else {
+            auto res = v;
+            [&res]<unsigned... Is>(std::integer_sequence<unsigned, Is...>) {
+                ((res = res + shift_right_lane<(1u << Is)>(res)), ...);
+            }(std::make_integer_sequence<unsigned, std::countr_zero(N)>{});
+            return res;
+        }
+    }
+
+    /**
+     * @brief Exclusive prefix sum over the lanes starting from `init`;
+     * `res[i] = init + v[0] + ... + v[i - 1]`.
+     */
+    template <std::size_t N, typename T>
+    UI_ALWAYS_INLINE static constexpr auto exclusive_scan(
+        Vec<N, T> const& v,
+        T init = {}
+    ) noexcept -> Vec<N, T> {
+        auto const start = Vec<N, T>::load(init);
+        if constexpr (N == 1) return start;
+        else return shift_right_lane<1>(inclusive_scan(v)) + start;
+    }
+
     using float2  = Vec< 2, float>;
     using float4  = Vec< 4, float>;
     using float8  = Vec< 8, float>;
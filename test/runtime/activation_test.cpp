@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <format>
+#include <limits>
+#include <random>
+#include "ui.hpp"
+#include "ui/activation.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / sizeof(T);
+};
+
+using Types = std::tuple<
+    float,
+    double
+>;
+
+using HalfTypes = std::tuple<
+    float16,
+    bfloat16
+>;
+
+template <std::floating_point T>
+static auto ulp_error(T got, long double ref) -> long double {
+    using limits = std::numeric_limits<T>;
+    if (std::isnan(ref)) return std::isnan(got) ? 0 : limits::infinity();
+    if (!std::isfinite(got)) return got == static_cast<T>(ref) ? 0 : limits::infinity();
+    auto e = 0;
+    std::frexp(std::fmax(std::fabs(ref), static_cast<long double>(limits::min())), &e);
+    auto const ulp = std::ldexp(1.0L, e - limits::digits);
+    return std::fabs(static_cast<long double>(got) - ref) / ulp;
+}
+
+template <std::size_t N, typename T, typename Fn, typename Ref>
+static auto max_ulp_error(Fn&& fn, Ref&& ref, T lo, T hi) -> long double {
+    auto rng = std::mt19937(42);
+    auto dist = std::uniform_real_distribution<T>(lo, hi);
+    auto worst = 0.0L;
+    for (auto it = 0; it < 512; ++it) {
+        auto x = Vec<N, T>{};
+        for (auto i = 0ul; i < N; ++i) x[i] = dist(rng);
+        auto const res = fn(x);
+        for (auto i = 0ul; i < N; ++i) {
+            worst = std::max(worst, ulp_error<T>(res[i], ref(static_cast<long double>(x[i]))));
+        }
+    }
+    return worst;
+}
+
+static auto ref_sigmoid(long double x) -> long double { return 1 / (1 + std::exp(-x)); }
+static auto ref_gelu(long double x) -> long double { return x / 2 * std::erfc(-x / std::sqrt(2.0L)); }
+static auto ref_softplus(long double x) -> long double {
+    return x > 0 ? x + std::log1p(std::exp(-x)) : std::log1p(std::exp(x));
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Activation Functions",
+    "[activation]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    using limits = std::numeric_limits<type>;
+    static constexpr auto is_float = std::same_as<type, float>;
+    static constexpr auto inf = limits::infinity();
+    // Down to where the results underflow.
+    static constexpr auto lo = is_float ? type(-100) : type(-740);
+
+    auto v = Vec<8, type>::load(type(0));
+    v[0] = inf;
+    v[1] = -inf;
+    v[2] = limits::quiet_NaN();
+    v[3] = type(-0.0);
+    v[4] = limits::max();
+    v[5] = limits::lowest();
+
+    WHEN("Hyperbolic tangent") {
+        auto const ref = [](long double x) { return std::tanh(x); };
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::tanh(x); }, ref, type(-1), type(1)) <= 1.5);
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::tanh(x); }, ref, type(-40), type(40)) <= 1.5);
+
+        auto const t = ui::tanh(v);
+        REQUIRE(t[0] == 1);
+        REQUIRE(t[1] == -1);
+        REQUIRE(std::isnan(t[2]));
+        REQUIRE((t[3] == 0 && std::signbit(t[3])));
+        REQUIRE(t[4] == 1);
+        REQUIRE(t[5] == -1);
+    }
+
+    WHEN("Sigmoid") {
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::sigmoid(x); }, ref_sigmoid, type(-10), type(10)) <= 2);
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::sigmoid(x); }, ref_sigmoid, lo, type(40)) <= 2);
+
+        auto const s = ui::sigmoid(v);
+        REQUIRE(s[0] == 1);
+        REQUIRE(s[1] == 0);
+        REQUIRE(std::isnan(s[2]));
+        REQUIRE(s[3] == type(0.5));
+        REQUIRE(s[4] == 1);
+        REQUIRE(s[5] == 0);
+    }
+
+    WHEN("Error function") {
+        auto const ref = [](long double x) { return std::erf(x); };
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::erf(x); }, ref, type(-1.5), type(1.5)) <= 1.5);
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::erf(x); }, ref, type(-8), type(8)) <= 1.5);
+
+        auto const e = ui::erf(v);
+        REQUIRE(e[0] == 1);
+        REQUIRE(e[1] == -1);
+        REQUIRE(std::isnan(e[2]));
+        REQUIRE((e[3] == 0 && std::signbit(e[3])));
+        REQUIRE(e[4] == 1);
+        REQUIRE(e[5] == -1);
+    }
+
+    WHEN("Gaussian error linear unit") {
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::gelu(x); }, ref_gelu, type(-4), type(4)) <= 8);
+        // The negative tail until the result underflows.
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::gelu(x); }, ref_gelu, is_float ? type(-13) : type(-37), type(10)) <= 8);
+
+        auto const g = ui::gelu(v);
+        REQUIRE(g[0] == inf);
+        REQUIRE(g[1] == 0);
+        REQUIRE(std::isnan(g[2]));
+        REQUIRE(g[3] == 0);
+        REQUIRE(g[4] == limits::max());
+        REQUIRE(g[5] == 0);
+    }
+
+    WHEN("Softplus") {
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::softplus(x); }, ref_softplus, type(-10), type(10)) <= 2);
+        REQUIRE(max_ulp_error<N>([](auto x) { return ui::softplus(x); }, ref_softplus, lo, type(100)) <= 2);
+
+        auto const s = ui::softplus(v);
+        REQUIRE(s[0] == inf);
+        REQUIRE(s[1] == 0);
+        REQUIRE(std::isnan(s[2]));
+        REQUIRE(s[3] == std::log(type(2)));
+        REQUIRE(s[4] == limits::max());
+        REQUIRE(s[5] == 0);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Activation Functions on Half-Precision Lanes",
+    "[activation]",
+    HalfTypes
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    // Evaluated in float and narrowed once.
+    static constexpr auto rel = std::same_as<type, float16> ? 0x1p-10f : 0x1p-7f;
+
+    auto x = Vec<N, type>{};
+    for (auto i = 0ul; i < N; ++i) {
+        x[i] = type(float(i) * 0.75f - 5.f);
+    }
+
+    auto const check = [&x](auto const& res, auto&& ref) {
+        for (auto i = 0ul; i < N; ++i) {
+            auto const expected = float(type(ref(float(x[i]))));
+            INFO(std::format("x = {}, got = {}, expected = {}", float(x[i]), float(res[i]), expected));
+            REQUIRE(std::fabs(float(res[i]) - expected) <= rel * std::fabs(expected));
+        }
+    };
+
+    check(ui::tanh(x), [](float v) { return std::tanh(v); });
+    check(ui::sigmoid(x), [](float v) { return float(ref_sigmoid(v)); });
+    check(ui::erf(x), [](float v) { return std::erf(v); });
+    check(ui::gelu(x), [](float v) { return float(ref_gelu(v)); });
+    check(ui::softplus(x), [](float v) { return float(ref_softplus(v)); });
+}
@@ -0,0 +1,576 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+#include "ui.hpp"
+#include "ui/algorithm.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::uint8_t,
+    std::int16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    float,
+    double
+>;
+
+// Covers empty input, a partial register, whole registers and every unroll boundary.
+static constexpr std::size_t sizes[] = { 0, 1, 2, 3, 5, 8, 15, 16, 17, 31, 33, 64, 100, 255, 256, 257, 1000 };
+
+// Integer arithmetic wraps like the vector lanes do.
+template <typename T>
+static constexpr auto wrap_add(T a, T b) noexcept -> T {
+    if constexpr (std::integral<T>) {
+        using utype = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<utype>(static_cast<utype>(a) + static_cast<utype>(b)));
+    } else {
+        return a + b;
+    }
+}
+
+template <typename T>
+static constexpr auto wrap_sub(T a, T b) noexcept -> T {
+    if constexpr (std::integral<T>) {
+        using utype = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<utype>(static_cast<utype>(a) - static_cast<utype>(b)));
+    } else {
+        return a - b;
+    }
+}
+
+template <typename T>
+static constexpr auto wrap_mul(T a, T b) noexcept -> T {
+    if constexpr (std::integral<T>) {
+        using utype = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, std::make_unsigned_t<T>>;
+        return static_cast<T>(static_cast<utype>(static_cast<utype>(a) * static_cast<utype>(b)));
+    } else {
+        return a * b;
+    }
+}
+
+// Floating-point sums are reassociated, so only the integer results are exact.
+template <typename T>
+static auto check_sum(T actual, T expected, T magnitude) -> void {
+    INFO(std::format("actual = {}, expected = {}", actual, expected));
+    if constexpr (std::integral<T>) {
+        REQUIRE(actual == expected);
+    } else {
+        REQUIRE(std::abs(actual - expected) <= magnitude * T(1e-5) + T(1e-5));
+    }
+}
+
+template <typename T>
+static auto make_data(std::size_t n, std::size_t seed) -> std::vector<T> {
+    auto res = std::vector<T>(n);
+    DataGenerator<1, T>::random(res.data(), n, seed);
+    return res;
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Span Algorithms",
+    "[algorithm][transform][reduce]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Unary transform") {
+        for (auto n: sizes) {
+            auto const in = make_data<type>(n, n);
+            // One extra element checks that the tail is not overwritten.
+            auto out = std::vector<type>(n + 1, type(7));
+            ui::transform(std::span(in), std::span(out).first(n), [](auto v) { return v + v; });
+            INFO(std::format("size = {}", n));
+            for (auto i = 0ul; i < n; ++i) REQUIRE(out[i] == wrap_add(in[i], in[i]));
+            REQUIRE(out[n] == type(7));
+        }
+    }
+
+    WHEN("Binary transform") {
+        for (auto n: sizes) {
+            auto const a = make_data<type>(n, n);
+            auto const b = make_data<type>(n, n + 1);
+            auto out = std::vector<type>(n + 1, type(7));
+            ui::transform(std::span(a), std::span(b), std::span(out).first(n), [](auto l, auto r) { return l - r; });
+            INFO(std::format("size = {}", n));
+            for (auto i = 0ul; i < n; ++i) REQUIRE(out[i] == wrap_sub(a[i], b[i]));
+            REQUIRE(out[n] == type(7));
+        }
+    }
+
+    WHEN("Zip transform over three inputs") {
+        for (auto n: sizes) {
+            auto const a = make_data<type>(n, n);
+            auto const b = make_data<type>(n, n + 1);
+            auto const c = make_data<type>(n, n + 2);
+            auto out = std::vector<type>(n);
+            ui::zip_transform(std::span(out), [](auto x, auto y, auto z) { return (x + y) - z; }, std::span(a), std::span(b), std::span(c));
+            INFO(std::format("size = {}", n));
+            for (auto i = 0ul; i < n; ++i) REQUIRE(out[i] == wrap_sub(wrap_add(a[i], b[i]), c[i]));
+        }
+    }
+
+    WHEN("Transform with a different output type") {
+        for (auto n: sizes) {
+            auto const in = make_data<type>(n, n);
+            auto out = std::vector<std::uint8_t>(n);
+            ui::transform(std::span(in), std::span(out), [](auto v) {
+                auto const zero = decltype(v)::load(type{});
+                return cast<std::uint8_t>(rcast<mask_inner_t<type>>(cmp(v, zero, op::greater_t{})) & 1);
+            });
+            INFO(std::format("size = {}", n));
+            for (auto i = 0ul; i < n; ++i) REQUIRE(out[i] == (in[i] > type{} ? 1 : 0));
+        }
+    }
+
+    WHEN("Reduce") {
+        for (auto n: sizes) {
+            auto const in = make_data<type>(n, n);
+            INFO(std::format("size = {}", n));
+
+            auto sum = type{};
+            auto magnitude = type{};
+            auto mx = std::numeric_limits<type>::lowest();
+            auto mn = std::numeric_limits<type>::max();
+            auto prod = type(1);
+            for (auto v: in) {
+                sum = wrap_add(sum, v);
+                if constexpr (std::floating_point<type>) magnitude += std::abs(v);
+                mx = std::max(mx, v);
+                mn = std::min(mn, v);
+                prod = wrap_mul(prod, v);
+            }
+
+            check_sum(ui::reduce(std::span(in)), sum, magnitude);
+            check_sum(ui::reduce(std::span(in), type(3), op::add_t{}), wrap_add(sum, type(3)), magnitude);
+            if (n > 0) {
+                REQUIRE(ui::reduce(std::span(in), op::max_t{}) == mx);
+                REQUIRE(ui::reduce(std::span(in), op::min_t{}) == mn);
+            }
+            if constexpr (std::integral<type>) {
+                REQUIRE(ui::reduce(std::span(in), op::mul_t{}) == prod);
+            }
+        }
+    }
+
+    if constexpr (std::floating_point<type>) {
+        WHEN("Reduce ignoring NaN") {
+            for (auto n: sizes) {
+                auto in = make_data<type>(n, n);
+                INFO(std::format("size = {}", n));
+                if (n == 0) {
+                    REQUIRE(std::isnan(ui::reduce(std::span(in), op::maxnm_t{})));
+                    continue;
+                }
+                auto const mx = *std::max_element(in.begin(), in.end());
+                auto const mn = *std::min_element(in.begin(), in.end());
+                for (auto i = 0ul; i < n; i += 3) {
+                    if (in[i] != mx && in[i] != mn) in[i] = std::numeric_limits<type>::quiet_NaN();
+                }
+                REQUIRE(ui::reduce(std::span(in), op::maxnm_t{}) == mx);
+                REQUIRE(ui::reduce(std::span(in), op::minnm_t{}) == mn);
+            }
+        }
+    }
+
+    WHEN("Transform reduce") {
+        for (auto n: sizes) {
+            auto const a = make_data<type>(n, n);
+            auto const b = make_data<type>(n, n + 1);
+            INFO(std::format("size = {}", n));
+
+            auto sq = type{};
+            auto dot = type{};
+            auto magnitude = type{};
+            auto diff = std::numeric_limits<type>::lowest();
+            for (auto i = 0ul; i < n; ++i) {
+                sq = wrap_add(sq, wrap_mul(a[i], a[i]));
+                dot = wrap_add(dot, wrap_mul(a[i], b[i]));
+                if constexpr (std::floating_point<type>) magnitude += std::abs(a[i] * a[i]) + std::abs(a[i] * b[i]);
+                diff = std::max(diff, wrap_sub(a[i], b[i]));
+            }
+
+            check_sum(ui::transform_reduce(std::span(a), type{}, op::add_t{}, [](auto v) { return v * v; }), sq, magnitude);
+            check_sum(ui::transform_reduce(std::span(a), std::span(b), type{}), dot, magnitude);
+            check_sum(ui::transform_reduce(std::span(a), std::span(b), type(5)), wrap_add(dot, type(5)), magnitude);
+            REQUIRE(
+                ui::transform_reduce(
+                    std::span(a), std::span(b),
+                    std::numeric_limits<type>::lowest(), op::max_t{},
+                    [](auto l, auto r) { return l - r; }
+                ) == diff
+            );
+        }
+    }
+}
+
+static auto half_bits_to_float(std::uint16_t h) -> float {
+    auto const sign = (h & 0x8000) ? -1.f : 1.f;
+    auto const exp = (h >> 10) & 0x1F;
+    auto const man = h & 0x3FF;
+    if (exp == 0x1F) return man ? std::numeric_limits<float>::quiet_NaN() : sign * std::numeric_limits<float>::infinity();
+    if (exp == 0) return sign * std::ldexp(float(man), -24);
+    return sign * std::ldexp(float(man | 0x400), exp - 25);
+}
+
+TEST_CASE(VEC_ARCH_NAME " Span Conversion", "[algorithm][convert]") {
+    // Every float16 encoding in order.
+    auto halves = std::vector<float16>(1 << 16);
+    for (auto i = 0u; i < halves.size(); ++i) halves[i] = std::bit_cast<float16>(static_cast<std::uint16_t>(i));
+
+    WHEN("float16 to float") {
+        auto out = std::vector<float>(halves.size());
+        ui::convert(std::span(halves), std::span(out));
+        for (auto i = 0u; i < halves.size(); ++i) {
+            auto const expected = half_bits_to_float(static_cast<std::uint16_t>(i));
+            INFO(std::format("bits = {:#06x}, got = {}, expected = {}", i, out[i], expected));
+            if (std::isnan(expected)) REQUIRE(std::isnan(out[i]));
+            else REQUIRE(std::bit_cast<std::uint32_t>(out[i]) == std::bit_cast<std::uint32_t>(expected));
+        }
+    }
+
+    WHEN("float to float16 rounds to nearest even") {
+        // Every finite positive encoding, its negation and the midpoints to the next encoding.
+        auto in = std::vector<float>{};
+        auto expected = std::vector<std::uint16_t>{};
+        for (auto h = 0u; h < 0x7C00; ++h) {
+            auto const v = half_bits_to_float(static_cast<std::uint16_t>(h));
+            in.insert(in.end(), { v, -v });
+            expected.insert(expected.end(), { static_cast<std::uint16_t>(h), static_cast<std::uint16_t>(h | 0x8000) });
+            // The midpoint above the largest finite value is the overflow threshold below.
+            if (h + 1 == 0x7C00) break;
+
+            auto const next = half_bits_to_float(static_cast<std::uint16_t>(h + 1));
+            auto const mid = static_cast<float>((double(v) + double(next)) / 2);
+            auto const even = static_cast<std::uint16_t>((h & 1) ? h + 1 : h);
+            in.insert(in.end(), { mid, std::nextafter(mid, 0.f), std::nextafter(mid, next) });
+            expected.insert(expected.end(), { even, static_cast<std::uint16_t>(h), static_cast<std::uint16_t>(h + 1) });
+        }
+        in.insert(in.end(), { 65520.f, std::nextafter(65520.f, 0.f), 1e10f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 1e-10f });
+        expected.insert(expected.end(), { 0x7C00, 0x7BFF, 0x7C00, 0x7C00, 0xFC00, 0x0000 });
+
+        auto out = std::vector<float16>(in.size());
+        ui::convert(std::span(in), std::span(out));
+        for (auto i = 0u; i < in.size(); ++i) {
+            auto const got = std::bit_cast<std::uint16_t>(out[i]);
+            INFO(std::format("x = {}, got = {:#06x}, expected = {:#06x}", in[i], got, expected[i]));
+            REQUIRE(got == expected[i]);
+        }
+
+        auto const nan = std::vector<float>(5, std::numeric_limits<float>::quiet_NaN());
+        auto nan_out = std::vector<float16>(nan.size());
+        ui::convert(std::span(nan), std::span(nan_out));
+        for (auto h: nan_out) REQUIRE(ui::isnan(h));
+    }
+
+    WHEN("bfloat16 to float is exact") {
+        auto in = std::vector<bfloat16>(1 << 16);
+        for (auto i = 0u; i < in.size(); ++i) in[i] = std::bit_cast<bfloat16>(static_cast<std::uint16_t>(i));
+        auto out = std::vector<float>(in.size());
+        ui::convert(std::span(in), std::span(out));
+        for (auto i = 0u; i < in.size(); ++i) {
+            INFO(std::format("bits = {:#06x}", i));
+            REQUIRE(std::bit_cast<std::uint32_t>(out[i]) == i << 16);
+        }
+    }
+
+    WHEN("float to bfloat16 rounds to nearest even") {
+        // Every finite positive encoding, its negation and the midpoints to the next encoding. The
+        // midpoint above the largest finite value rounds to infinity.
+        auto in = std::vector<float>{};
+        auto expected = std::vector<std::uint16_t>{};
+        for (auto h = 0u; h < 0x7F80; ++h) {
+            auto const v = std::bit_cast<float>(h << 16);
+            auto const mid = std::bit_cast<float>((h << 16) | 0x8000);
+            auto const even = static_cast<std::uint16_t>((h & 1) ? h + 1 : h);
+            in.insert(in.end(), { v, -v, mid, std::nextafter(mid, 0.f), std::nextafter(mid, std::numeric_limits<float>::infinity()) });
+            expected.insert(expected.end(), {
+                static_cast<std::uint16_t>(h), static_cast<std::uint16_t>(h | 0x8000),
+                even, static_cast<std::uint16_t>(h), static_cast<std::uint16_t>(h + 1)
+            });
+        }
+        in.insert(in.end(), { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() });
+        expected.insert(expected.end(), { 0x7F80, 0xFF80 });
+
+        auto out = std::vector<bfloat16>(in.size());
+        ui::convert(std::span(in), std::span(out));
+        for (auto i = 0u; i < in.size(); ++i) {
+            auto const got = std::bit_cast<std::uint16_t>(out[i]);
+            auto const scalar = std::bit_cast<std::uint16_t>(bfloat16(in[i]));
+            INFO(std::format("x = {}, got = {:#06x}, scalar = {:#06x}, expected = {:#06x}", in[i], got, scalar, expected[i]));
+            REQUIRE(got == expected[i]);
+            REQUIRE(scalar == expected[i]);
+        }
+
+        // Payloads that would round into infinity or carry into the sign stay NaN.
+        auto const nan = std::vector<float>{
+            std::numeric_limits<float>::quiet_NaN(),
+            std::bit_cast<float>(0x7F80'0001u),
+            std::bit_cast<float>(0x7FFF'FFFFu),
+            std::bit_cast<float>(0xFFFF'FFFFu),
+            std::bit_cast<float>(0xFF80'8000u)
+        };
+        auto nan_out = std::vector<bfloat16>(nan.size());
+        ui::convert(std::span(nan), std::span(nan_out));
+        for (auto i = 0u; i < nan.size(); ++i) {
+            INFO(std::format("bits = {:#010x}", std::bit_cast<std::uint32_t>(nan[i])));
+            REQUIRE(std::isnan(float(nan_out[i])));
+            REQUIRE(std::isnan(float(bfloat16(nan[i]))));
+            REQUIRE(std::signbit(float(nan_out[i])) == std::signbit(nan[i]));
+        }
+    }
+
+    WHEN("Tails and other types") {
+        for (auto n: sizes) {
+            auto const in = make_data<float>(n, n);
+            auto half = std::vector<float16>(n + 1, float16(7.f));
+            auto back = std::vector<double>(n + 1, 7.);
+            ui::convert(std::span(in), std::span(half).first(n));
+            ui::convert(std::span(half).first(n), std::span(back).first(n));
+            INFO(std::format("size = {}", n));
+            for (auto i = 0ul; i < n; ++i) {
+                REQUIRE(back[i] == static_cast<double>(static_cast<float>(half[i])));
+                REQUIRE(std::fabs(back[i] - in[i]) <= 0x1p-11 * std::fabs(in[i]));
+            }
+            REQUIRE(static_cast<float>(half[n]) == 7.f);
+            REQUIRE(back[n] == 7.);
+        }
+    }
+}
+
+template <typename T>
+static auto float8_bits_to_float(std::uint8_t b) -> float {
+    using rep_t = ui::fp::FloatingPointRep<T>;
+    auto const sign = (b & 0x80) ? -1.f : 1.f;
+    auto const mag = b & 0x7F;
+    auto const exp = mag >> rep_t::mantissa_bits;
+    auto const man = mag & ((1 << rep_t::mantissa_bits) - 1);
+    if (mag > T::max_rep()) {
+        if (T::has_infinity && mag == T::overflow_rep()) return sign * std::numeric_limits<float>::infinity();
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    if (exp == 0) return sign * std::ldexp(float(man), 1 - int(rep_t::bias) - int(rep_t::mantissa_bits));
+    return sign * std::ldexp(float(man | (1 << rep_t::mantissa_bits)), int(exp) - int(rep_t::bias) - int(rep_t::mantissa_bits));
+}
+
+TEMPLATE_TEST_CASE(VEC_ARCH_NAME " float8 Conversion", "[algorithm][convert][float8]", float8_e4m3, float8_e5m2) {
+    using rep_t = ui::fp::FloatingPointRep<TestType>;
+    static constexpr auto max_rep = TestType::max_rep();
+    static constexpr auto overflow_rep = TestType::overflow_rep();
+    auto const max = float8_bits_to_float<TestType>(max_rep);
+    auto const inf = std::numeric_limits<float>::infinity();
+
+    auto all = std::vector<TestType>(256);
+    for (auto i = 0u; i < all.size(); ++i) all[i] = std::bit_cast<TestType>(static_cast<std::uint8_t>(i));
+
+    WHEN("Decoding is exact") {
+        auto out = std::vector<float>(all.size());
+        auto half = std::vector<float16>(all.size());
+        ui::convert(std::span(all), std::span(out));
+        ui::convert(std::span(all), std::span(half));
+        for (auto i = 0u; i < all.size(); ++i) {
+            auto const expected = float8_bits_to_float<TestType>(static_cast<std::uint8_t>(i));
+            INFO(std::format("bits = {:#04x}, got = {}, expected = {}", i, out[i], expected));
+            if (std::isnan(expected)) {
+                REQUIRE(std::isnan(out[i]));
+                REQUIRE(std::isnan(float(half[i])));
+                REQUIRE(all[i].is_nan());
+            } else {
+                REQUIRE(std::bit_cast<std::uint32_t>(out[i]) == std::bit_cast<std::uint32_t>(expected));
+                REQUIRE(std::bit_cast<std::uint32_t>(float(half[i])) == std::bit_cast<std::uint32_t>(expected));
+                REQUIRE(std::bit_cast<std::uint32_t>(float(all[i])) == std::bit_cast<std::uint32_t>(expected));
+            }
+        }
+    }
+
+    WHEN("Encoding rounds to nearest even") {
+        // Every finite positive encoding, its negation and the midpoints to the next encoding.
+        auto in = std::vector<float>{};
+        auto expected = std::vector<std::uint8_t>{};
+        for (auto b = 0u; b <= max_rep; ++b) {
+            auto const v = float8_bits_to_float<TestType>(static_cast<std::uint8_t>(b));
+            in.insert(in.end(), { v, -v });
+            expected.insert(expected.end(), { static_cast<std::uint8_t>(b), static_cast<std::uint8_t>(b | 0x80) });
+            if (b == max_rep) break;
+
+            auto const next = float8_bits_to_float<TestType>(static_cast<std::uint8_t>(b + 1));
+            auto const mid = (v + next) / 2;
+            auto const even = static_cast<std::uint8_t>((b & 1) ? b + 1 : b);
+            in.insert(in.end(), { mid, std::nextafter(mid, 0.f), std::nextafter(mid, next), -mid });
+            expected.insert(expected.end(), {
+                even, static_cast<std::uint8_t>(b), static_cast<std::uint8_t>(b + 1), static_cast<std::uint8_t>(even | 0x80)
+            });
+        }
+        in.insert(in.end(), { 1e-10f, std::numeric_limits<float>::denorm_min() });
+        expected.insert(expected.end(), { 0x00, 0x00 });
+
+        for (auto n: { in.size(), std::size_t{ 5 } }) {
+            auto out = std::vector<TestType>(n);
+            ui::convert(std::span(in).first(n), std::span(out));
+            for (auto i = 0u; i < n; ++i) {
+                auto const got = std::bit_cast<std::uint8_t>(out[i]);
+                auto const scalar = std::bit_cast<std::uint8_t>(TestType(in[i]));
+                INFO(std::format("x = {}, got = {:#04x}, scalar = {:#04x}, expected = {:#04x}", in[i], got, scalar, expected[i]));
+                REQUIRE(got == expected[i]);
+                REQUIRE(scalar == expected[i]);
+            }
+        }
+    }
+
+    WHEN("Overflow, infinity and NaN") {
+        auto const ulp = max - float8_bits_to_float<TestType>(max_rep - 1);
+        // Ties at the top go to the even neighbour: the largest finite value for E4M3, the
+        // (missing) next binade for E5M2.
+        auto const tie = static_cast<std::uint8_t>((max_rep & 1) ? overflow_rep : max_rep);
+        auto const v = Vec<8, float>::load(std::array{
+            max + ulp / 2, std::nextafter(max + ulp / 2, inf), 1e30f, inf, -inf,
+            std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::quiet_NaN(), std::bit_cast<float>(0x7F80'0001u)
+        }.data(), 8);
+        auto const wrapped = std::array<std::uint8_t, 8>{ tie, overflow_rep, overflow_rep, overflow_rep, overflow_rep | 0x80, TestType::nan_rep(), TestType::nan_rep() | 0x80, TestType::nan_rep() };
+        auto const saturated = std::array<std::uint8_t, 8>{ max_rep, max_rep, max_rep, max_rep, max_rep | 0x80, TestType::nan_rep(), TestType::nan_rep() | 0x80, TestType::nan_rep() };
+
+        auto const res = ui::cast<TestType>(v);
+        auto const sat = ui::sat_cast<TestType>(v);
+        auto const sat_half = ui::sat_cast<TestType>(ui::cast<float16>(v));
+        for (auto i = 0u; i < 8; ++i) {
+            INFO(std::format("x = {}", v[i]));
+            REQUIRE(std::bit_cast<std::uint8_t>(res[i]) == wrapped[i]);
+            REQUIRE(std::bit_cast<std::uint8_t>(TestType(v[i])) == wrapped[i]);
+            REQUIRE(std::bit_cast<std::uint8_t>(sat[i]) == saturated[i]);
+            if (i > 1) REQUIRE(std::bit_cast<std::uint8_t>(sat_half[i]) == saturated[i]);
+        }
+    }
+
+    WHEN("Converting from float16 matches converting from float") {
+        auto halves = std::vector<float16>(1 << 16);
+        for (auto i = 0u; i < halves.size(); ++i) halves[i] = std::bit_cast<float16>(static_cast<std::uint16_t>(i));
+        auto floats = std::vector<float>(halves.size());
+        auto from_half = std::vector<TestType>(halves.size());
+        auto from_float = std::vector<TestType>(halves.size());
+        ui::convert(std::span(halves), std::span(floats));
+        ui::convert(std::span(halves), std::span(from_half));
+        ui::convert(std::span(floats), std::span(from_float));
+        for (auto i = 0u; i < halves.size(); ++i) {
+            INFO(std::format("bits = {:#06x}", i));
+            REQUIRE(std::bit_cast<std::uint8_t>(from_half[i]) == std::bit_cast<std::uint8_t>(from_float[i]));
+        }
+    }
+
+    WHEN("Stochastic rounding") {
+        // Lands on one of the two neighbours and is unbiased on average.
+        auto const lo = float8_bits_to_float<TestType>(0x30);
+        auto const hi = float8_bits_to_float<TestType>(0x31);
+        auto const x = lo + (hi - lo) * 0.3f;
+        auto state = std::uint32_t{ 12345 };
+        auto sum = 0.0;
+        auto count = 0u;
+        for (auto k = 0u; k < 4096; ++k) {
+            auto random = Vec<8, std::uint32_t>{};
+            for (auto j = 0u; j < 8; ++j) {
+                state = state * 1664525u + 1013904223u;
+                random[j] = state;
+            }
+            auto const res = ui::stochastic_cast<TestType>(Vec<8, float>::load(x), random);
+            for (auto j = 0u; j < 8; ++j) {
+                auto const r = float(res[j]);
+                REQUIRE((r == lo || r == hi));
+                sum += r;
+                ++count;
+            }
+        }
+        REQUIRE(std::fabs(sum / count - x) <= (hi - lo) * 0.02);
+
+        // Exact values never move, and overflow saturates.
+        auto const exact = ui::stochastic_cast<TestType>(Vec<8, float>::load(lo), Vec<8, std::uint32_t>::load(~0u));
+        auto const big = ui::stochastic_cast<TestType>(Vec<8, float>::load(-inf), Vec<8, std::uint32_t>::load(~0u));
+        for (auto j = 0u; j < 8; ++j) {
+            REQUIRE(float(exact[j]) == lo);
+            REQUIRE(std::bit_cast<std::uint8_t>(big[j]) == (max_rep | 0x80));
+        }
+    }
+
+    static_assert(rep_t::sign_bits + rep_t::exponent_bits + rep_t::mantissa_bits == 8);
+    REQUIRE(std::numeric_limits<TestType>::max() == TestType(max));
+}
+
+TEST_CASE(VEC_ARCH_NAME " bfloat16 Dot Product", "[algorithm][dot]") {
+    WHEN("Exact products") {
+        // Small integers keep every partial sum exact.
+        for (auto n: sizes) {
+            auto a = std::vector<bfloat16>(n);
+            auto b = std::vector<bfloat16>(n + 3);
+            auto expected = 0.f;
+            for (auto i = 0ul; i < n; ++i) {
+                a[i] = bfloat16(float(int(i % 7) - 3));
+                b[i] = bfloat16(float(int(i % 5) - 2));
+                expected += float(a[i]) * float(b[i]);
+            }
+            INFO(std::format("size = {}", n));
+            REQUIRE(ui::dot(std::span(a), std::span(b)) == expected);
+            REQUIRE(ui::dot(std::span(a), std::span(b), 10.f) == expected + 10.f);
+        }
+    }
+
+    WHEN("Random values") {
+        for (auto n: sizes) {
+            auto const fa = make_data<float>(n, n);
+            auto const fb = make_data<float>(n, n + 1);
+            auto a = std::vector<bfloat16>(n);
+            auto b = std::vector<bfloat16>(n);
+            ui::convert(std::span(fa), std::span(a));
+            ui::convert(std::span(fb), std::span(b));
+
+            auto expected = 0.0;
+            auto magnitude = 0.0;
+            for (auto i = 0ul; i < n; ++i) {
+                auto const p = double(float(a[i])) * double(float(b[i]));
+                expected += p;
+                magnitude += std::fabs(p);
+            }
+            INFO(std::format("size = {}", n));
+            auto const res = ui::dot<2>(std::span(std::as_const(a)), std::span(b));
+            REQUIRE(std::fabs(res - expected) <= magnitude * 1e-5 + 1e-6);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE(VEC_ARCH_NAME " int8 Dot Product", "[algorithm][dot]", std::int8_t, std::uint8_t) {
+    using acc_t = std::conditional_t<std::is_signed_v<TestType>, std::int32_t, std::uint32_t>;
+    for (auto n: sizes) {
+        auto a = std::vector<TestType>(n);
+        auto b = std::vector<std::uint8_t>(n + 5);
+        auto c = std::vector<std::int8_t>(n);
+        auto ab = std::int64_t{};
+        auto ac = std::int64_t{};
+        for (auto i = 0ul; i < n; ++i) {
+            a[i] = static_cast<TestType>(i * 37 + 11);
+            b[i] = static_cast<std::uint8_t>(i * 101 + 3);
+            c[i] = static_cast<std::int8_t>(i * 59 + 7);
+            ab += std::int64_t(a[i]) * b[i];
+            ac += std::int64_t(a[i]) * c[i];
+        }
+        INFO(std::format("size = {}", n));
+        auto const res = ui::dot(std::span(std::as_const(a)), std::span(b));
+        STATIC_REQUIRE(std::same_as<decltype(res), acc_t const>);
+        REQUIRE(res == static_cast<acc_t>(ab));
+        REQUIRE(ui::dot<1>(std::span(a), std::span(c), 100) == static_cast<std::int32_t>(ac + 100));
+    }
+}
@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <vector>
+#include "ui.hpp"
+#include "ui/algorithm.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    float,
+    double
+>;
+
+// Sequential reference that skips NaN and keeps the first occurrence.
+template <bool IsMax, typename T>
+static auto reference(std::span<T const> in) -> std::size_t {
+    auto res = std::size_t{};
+    auto found = false;
+    for (auto i = 0ul; i < in.size(); ++i) {
+        if constexpr (std::floating_point<T>) {
+            if (std::isnan(in[i])) continue;
+        }
+        if (!found || (IsMax ? in[i] > in[res] : in[i] < in[res])) {
+            res = i;
+            found = true;
+        }
+    }
+    return res;
+}
+
+template <std::size_t N, typename T>
+static auto check_vec(std::size_t seed) -> void {
+    auto data = std::vector<T>(N);
+    DataGenerator<N, T>::random(data.data(), N, seed);
+    // Duplicate the extremes so that ties are resolved to the first lane.
+    if constexpr (N > 2) {
+        auto const mn = reference<false>(std::span<T const>(data));
+        auto const mx = reference<true>(std::span<T const>(data));
+        data[N - 1] = data[mn];
+        data[N - 2] = data[mx];
+    }
+    auto const v = Vec<N, T>::load(data.data(), N);
+    INFO(std::format("v = {}", v));
+    REQUIRE(argmin(v) == reference<false>(std::span<T const>(data)));
+    REQUIRE(argmax(v) == reference<true>(std::span<T const>(data)));
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Argmin and Argmax",
+    "[argmin][argmax][algorithm]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Vector") {
+        for (auto seed = 0ul; seed < 8; ++seed) {
+            check_vec< 1, type>(seed);
+            check_vec< 2, type>(seed);
+            check_vec< 4, type>(seed);
+            check_vec< 8, type>(seed);
+            check_vec<16, type>(seed);
+            check_vec<32, type>(seed);
+            check_vec<64, type>(seed);
+        }
+    }
+
+    WHEN("Span") {
+        // The largest size crosses the chunk boundary of the 8-bit index lanes.
+        for (auto n: { 0ul, 1ul, 3ul, 17ul, 64ul, 257ul, 1000ul, 70001ul }) {
+            auto data = std::vector<type>(n);
+            DataGenerator<1, type>::random(data.data(), n, n);
+            auto const in = std::span<type const>(data);
+            INFO(std::format("size = {}", n));
+            REQUIRE(argmin(in) == reference<false>(in));
+            REQUIRE(argmax(in) == reference<true>(in));
+        }
+    }
+
+    WHEN("Span with repeated extremes") {
+        auto data = std::vector<type>(5000, type(1));
+        data[4321] = type(0);
+        data[1234] = type(0);
+        data[3000] = type(2);
+        data[4999] = type(2);
+        auto const in = std::span<type const>(data);
+        REQUIRE(argmin(in) == 1234);
+        REQUIRE(argmax(in) == 3000);
+
+        auto same = std::vector<type>(300, std::numeric_limits<type>::max());
+        REQUIRE(argmin(std::span<type const>(same)) == 0);
+        REQUIRE(argmax(std::span<type const>(same)) == 0);
+    }
+
+    if constexpr (std::floating_point<type>) {
+        WHEN("Span with NaN") {
+            auto data = std::vector<type>(1000);
+            DataGenerator<1, type>::random(data.data(), data.size(), 7);
+            for (auto i = 0ul; i < data.size(); i += 3) data[i] = std::numeric_limits<type>::quiet_NaN();
+            auto const in = std::span<type const>(data);
+            REQUIRE(argmin(in) == reference<false>(in));
+            REQUIRE(argmax(in) == reference<true>(in));
+
+            auto nan = std::vector<type>(100, std::numeric_limits<type>::quiet_NaN());
+            REQUIRE(argmin(std::span<type const>(nan)) == 0);
+        }
+    }
+}
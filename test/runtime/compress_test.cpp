@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <vector>
+#include "ui.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    float,
+    double
+>;
+
+template <std::size_t N, typename T>
+static auto make_mask(std::size_t seed) -> mask_t<N, T> {
+    return DataGenerator<N, T>::make_mask([seed](int i) {
+        auto active = ((static_cast<std::size_t>(i) * 5 + seed * 3) % 7) < 4;
+        return static_cast<mask_inner_t<T>>(active ? ~mask_inner_t<T>{} : 0);
+    });
+}
+
+template <std::size_t N, typename T>
+static auto check_compress(mask_t<N, T> const& mask) -> void {
+    auto v = DataGenerator<N, T>::random(N);
+    auto expected = std::vector<T>{};
+    for (auto i = 0ul; i < N; ++i) {
+        if (mask[i]) expected.push_back(v[i]);
+    }
+
+    {
+        auto res = compress(v, mask);
+        INFO(std::format("compress({}, {}) = {}", v, mask, res));
+        for (auto i = 0ul; i < N; ++i) {
+            if (i < expected.size()) REQUIRE(res[i] == expected[i]);
+            else REQUIRE(res[i] == T(0));
+        }
+    }
+
+    {
+        auto out = std::vector<T>(N + 1, T(3));
+        auto n = compress_store(out.data(), v, mask);
+        INFO(std::format("compress_store({}, {})", v, mask));
+        REQUIRE(n == expected.size());
+        for (auto i = 0ul; i < out.size(); ++i) {
+            if (i < n) REQUIRE(out[i] == expected[i]);
+            else REQUIRE(out[i] == T(3));
+        }
+    }
+
+    {
+        auto src = load<N>(T(1));
+        auto res = expand(v, mask, src);
+        INFO(std::format("expand({}, {}) = {}", v, mask, res));
+        auto k = 0ul;
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) REQUIRE(res[i] == v[k++]);
+            else REQUIRE(res[i] == T(1));
+        }
+        // `expand` undoes `compress` on the active lanes.
+        auto round_trip = expand(compress(v, mask), mask, src);
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) REQUIRE(round_trip[i] == v[i]);
+        }
+    }
+
+    {
+        // Only the active-lane count is readable past `in`.
+        auto data = std::vector<T>(expected.size() + 1);
+        DataGenerator<N, T>::random(data.data(), data.size());
+        auto res = expand_load(data.data() + 1, mask);
+        auto k = 1ul;
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) REQUIRE(res[i] == data[k++]);
+            else REQUIRE(res[i] == T(0));
+        }
+    }
+}
+
+template <std::size_t N, typename T>
+static auto check_masks() -> void {
+    check_compress<N, T>(DataGenerator<N, T>::make_mask([](int) { return mask_inner_t<T>{}; }));
+    check_compress<N, T>(DataGenerator<N, T>::make_mask([](int) { return static_cast<mask_inner_t<T>>(~mask_inner_t<T>{}); }));
+    for (auto seed = 0ul; seed < 7; ++seed) {
+        check_compress<N, T>(make_mask<N, T>(seed));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Compress and Expand",
+    "[compress][expand]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Vector is narrower than a register") {
+        check_masks<2, type>();
+    }
+
+    WHEN("Vector fits a register") {
+        check_masks<16 / sizeof(type), type>();
+    }
+
+    WHEN("Vector spans multiple registers") {
+        check_masks< 8, type>();
+        check_masks<16, type>();
+        check_masks<32, type>();
+        check_masks<64, type>();
+    }
+}
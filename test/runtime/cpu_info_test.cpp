@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "ui.hpp"
+
+TEST_CASE(VEC_ARCH_NAME " CpuInfo", "[cpu_info]") {
+    auto const& info = ui::cpu_info();
+
+    SECTION("Cached") {
+        REQUIRE(&info == &ui::cpu_info());
+    }
+
+    SECTION("Sanity") {
+        REQUIRE(info.cacheline > 0);
+        REQUIRE(info.mem > 0);
+        REQUIRE(info.physical_cores >= 1);
+        REQUIRE(info.logical_cores >= info.physical_cores);
+        REQUIRE(info.cache.size() <= ui::CacheLevels::capacity);
+        for (auto const& c: info.cache) {
+            REQUIRE(c.level >= 1);
+            REQUIRE(info.cache.at_level(c.level) == c.size);
+        }
+    }
+
+    SECTION("Features enabled at compile-time are reported at runtime") {
+        auto const& f = info.features;
+        #if defined(UI_CPU_X86)
+            #ifdef __SSE4_2__
+            REQUIRE(f.sse42);
+            #endif
+            #ifdef __AVX__
+            REQUIRE(f.avx);
+            #endif
+            #ifdef __AVX2__
+            REQUIRE(f.avx2);
+            REQUIRE(f.avx);
+            #endif
+            #ifdef __FMA__
+            REQUIRE(f.fma);
+            #endif
+            #ifdef __F16C__
+            REQUIRE(f.f16c);
+            #endif
+            #ifdef __BMI2__
+            REQUIRE(f.bmi2);
+            #endif
+            #ifdef __AVX512F__
+            REQUIRE(f.avx512f);
+            #endif
+            #ifdef __AVX512BW__
+            REQUIRE(f.avx512bw);
+            #endif
+            #ifdef __AVX512VNNI__
+            REQUIRE(f.avx512vnni);
+            #endif
+            REQUIRE(!f.neon);
+            // An AVX-512 flag without the OS saving the ZMM state is never reported.
+            if (f.avx512bw || f.avx512vl) REQUIRE(f.avx512f);
+            if (f.avx2) REQUIRE(f.avx);
+        #elif defined(UI_CPU_ARM64)
+            REQUIRE(f.neon);
+            #ifdef __ARM_FEATURE_DOTPROD
+            REQUIRE(f.neon_dotprod);
+            #endif
+            REQUIRE(!f.avx2);
+        #endif
+        (void)f;
+    }
+}
+
+TEST_CASE(VEC_ARCH_NAME " CpuTopology", "[cpu_info]") {
+    auto const& info = ui::cpu_info();
+    auto const& topo = ui::cpu_topology();
+
+    SECTION("Cached") {
+        REQUIRE(&topo == &ui::cpu_topology());
+    }
+
+    SECTION("Cores") {
+        REQUIRE(!topo.cores.empty());
+        REQUIRE(topo.logical_cores() >= topo.cores.size());
+        for (auto const& core: topo.cores) {
+            REQUIRE(!core.cpus.empty());
+            for (auto cpu: core.cpus) {
+                REQUIRE(topo.core_of(cpu) == &core);
+            }
+        }
+    }
+
+    SECTION("Caches") {
+        for (auto const& c: topo.caches) {
+            INFO("Level: " << int(c.level));
+            REQUIRE(c.level >= 1);
+            REQUIRE(!c.cpus.empty());
+            REQUIRE(topo.cache_of(c.cpus.front(), c.level) == &c);
+        }
+        for (auto const& c: info.cache) {
+            REQUIRE(c.shared_by >= 1);
+            REQUIRE(c.size_per_thread() <= c.size);
+        }
+    }
+
+    SECTION("Nodes") {
+        REQUIRE(!topo.nodes.empty());
+        REQUIRE(info.numa_nodes >= 1);
+        auto cpus = std::size_t{};
+        for (auto const& n: topo.nodes) cpus += n.cpus.size();
+        REQUIRE(cpus >= topo.cores.size());
+    }
+}
@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <vector>
+#include "ui.hpp"
+#include "ui/divider.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / std::max<unsigned>(sizeof(T) / 2, 1);
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::uint16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    std::uint64_t
+>;
+
+// The signed quotient `min / -1` overflows and is skipped.
+template <typename T>
+static constexpr auto is_overflow(T n, T d) noexcept -> bool {
+    if constexpr (std::is_signed_v<T>) return n == std::numeric_limits<T>::min() && d == T(-1);
+    else return false;
+}
+
+template <typename T>
+static auto make_divisors(std::size_t seed) -> std::vector<T> {
+    using limits = std::numeric_limits<T>;
+    auto res = std::vector<T>{ 1, 2, 3, 5, 6, 7, 10, 11, 13, 64, 100, limits::max(), T(limits::max() - 1), T(limits::max() / 2 + 1) };
+    for (auto s = 1u; s < sizeof(T) * 8; s += 3) res.push_back(T(T(1) << s));
+    if constexpr (std::is_signed_v<T>) {
+        auto const n = res.size();
+        for (auto i = 0ul; i < n; ++i) res.push_back(T(-res[i]));
+        res.push_back(limits::min());
+    }
+    auto random = std::vector<T>(32);
+    DataGenerator<1, T>::random(random.data(), random.size(), seed);
+    for (auto v: random) {
+        if (v != 0) res.push_back(v);
+    }
+    return res;
+}
+
+template <typename T, std::size_t N>
+static auto make_dividends(std::size_t seed) -> std::vector<T> {
+    using limits = std::numeric_limits<T>;
+    auto res = std::vector<T>{ 0, 1, 2, 3, limits::max(), T(limits::max() - 1), limits::min(), T(limits::min() + 1) };
+    if constexpr (sizeof(T) <= 2) {
+        // Every dividend.
+        res.clear();
+        for (auto i = std::int64_t(limits::min()); i <= std::int64_t(limits::max()); ++i) res.push_back(T(i));
+    } else {
+        auto random = std::vector<T>(1024);
+        DataGenerator<1, T>::random(random.data(), random.size(), seed);
+        res.insert(res.end(), random.begin(), random.end());
+    }
+    while (res.size() % N) res.push_back(T(res.size()));
+    return res;
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Divider",
+    "[div][divider]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+
+    auto const divisors = make_divisors<type>(7);
+    auto const dividends = make_dividends<type, N>(11);
+
+    WHEN("Quotient and remainder") {
+        for (auto d: divisors) {
+            auto const by = Divider<type>(d);
+            auto mismatches = 0ul;
+            auto first = std::size_t{};
+            for (auto i = 0ul; i < dividends.size(); i += N) {
+                auto const n = Vec<N, type>::load(dividends.data() + i, N);
+                auto const q = by(n);
+                auto const r = by.rem(n);
+                for (auto j = 0ul; j < N; ++j) {
+                    if (is_overflow(n[j], d)) continue;
+                    auto const ok = q[j] == type(n[j] / d) && r[j] == type(n[j] % d);
+                    if (!ok && mismatches++ == 0) first = i + j;
+                }
+            }
+            INFO(std::format("d = {}, first mismatch n = {}", d, dividends[first]));
+            REQUIRE(mismatches == 0);
+            REQUIRE(by(type(100)) == type(type(100) / d));
+            REQUIRE(by.rem(type(100)) == type(type(100) % d));
+            REQUIRE(by.divisor() == d);
+        }
+    }
+
+    WHEN("Exact division") {
+        for (auto d: divisors) {
+            auto const by = Divider<type>(d);
+            // Multiples of `d` that do not overflow.
+            using utype = std::make_unsigned_t<type>;
+            auto const ad = d < 0 ? utype(utype{} - utype(d)) : utype(d);
+            auto const limit = utype(utype(std::numeric_limits<type>::max()) / ad);
+            auto mismatches = 0ul;
+            for (auto i = 0ul; i < dividends.size(); i += N) {
+                auto q = Vec<N, type>::load(dividends.data() + i, N);
+                for (auto j = 0ul; j < N; ++j) {
+                    q[j] = limit == 0 ? type(0) : type(utype(q[j]) % limit);
+                }
+                auto const res = by.exact(q * Vec<N, type>::load(d));
+                for (auto j = 0ul; j < N; ++j) mismatches += res[j] != q[j];
+            }
+            INFO(std::format("d = {}", d));
+            REQUIRE(mismatches == 0);
+        }
+    }
+}
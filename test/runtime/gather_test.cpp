@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <vector>
+#include "ui.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    std::uint64_t,
+    float,
+    double
+>;
+
+template <std::size_t N, typename I>
+static auto make_indices(std::size_t size, std::size_t seed) -> Vec<N, I> {
+    auto idx = Vec<N, I>{};
+    for (auto i = 0ul; i < N; ++i) {
+        idx[i] = static_cast<I>((i * 7 + seed * 13 + 3) % size);
+    }
+    return idx;
+}
+
+template <std::size_t N, typename T>
+static auto make_mask() -> mask_t<N, T> {
+    return DataGenerator<N, T>::make_mask([](int i) {
+        return static_cast<mask_inner_t<T>>(i % 3 == 0 ? 0 : ~mask_inner_t<T>{});
+    });
+}
+
+template <std::size_t N, typename T, typename I>
+static auto check_gather_scatter() -> void {
+    std::vector<T> data(97);
+    DataGenerator<N, T>::random(data.data(), data.size());
+
+    auto const idx = make_indices<N, I>(data.size(), N);
+    auto const mask = make_mask<N, T>();
+
+    {
+        auto res = gather(data.data(), idx);
+        INFO(std::format("gather(data, {}) = {}", idx, res));
+        for (auto i = 0ul; i < N; ++i) {
+            REQUIRE(res[i] == data[static_cast<std::size_t>(idx[i])]);
+        }
+    }
+
+    {
+        auto src = load<N>(T(1));
+        auto res = gather(data.data(), idx, mask, src);
+        INFO(std::format("gather(data, {}, {}) = {}", idx, mask, res));
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) REQUIRE(res[i] == data[static_cast<std::size_t>(idx[i])]);
+            else REQUIRE(res[i] == T(1));
+        }
+    }
+
+    {
+        // Indices are unique, so every lane must land in its slot.
+        auto out = std::vector<T>(data.size(), T(0));
+        auto v = DataGenerator<N, T>::random(N);
+        scatter(out.data(), idx, v);
+        for (auto i = 0ul; i < N; ++i) {
+            REQUIRE(out[static_cast<std::size_t>(idx[i])] == v[i]);
+        }
+    }
+
+    {
+        auto out = std::vector<T>(data.size(), T(0));
+        auto v = load<N>(T(2));
+        scatter(out.data(), idx, v, mask);
+        for (auto i = 0ul; i < N; ++i) {
+            auto expected = mask[i] ? T(2) : T(0);
+            REQUIRE(out[static_cast<std::size_t>(idx[i])] == expected);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Gather and Scatter",
+    "[gather][scatter]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Indices are 32-bit") {
+        check_gather_scatter< 2, type, std::int32_t>();
+        check_gather_scatter< 4, type, std::int32_t>();
+        check_gather_scatter< 8, type, std::int32_t>();
+        check_gather_scatter<16, type, std::int32_t>();
+    }
+
+    WHEN("Indices are unsigned 32-bit") {
+        check_gather_scatter< 4, type, std::uint32_t>();
+        check_gather_scatter< 8, type, std::uint32_t>();
+    }
+
+    WHEN("Indices are 64-bit") {
+        check_gather_scatter< 2, type, std::int64_t>();
+        check_gather_scatter< 4, type, std::int64_t>();
+        check_gather_scatter< 8, type, std::int64_t>();
+        check_gather_scatter<16, type, std::int64_t>();
+    }
+
+    WHEN("Indices are 16-bit") {
+        check_gather_scatter< 8, type, std::uint16_t>();
+    }
+}
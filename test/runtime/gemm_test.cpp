@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "ui.hpp"
+#include "ui/gemm.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+// Deterministic values; integers cover the full 8-bit range, floats lie in [-1, 1].
+template <typename T>
+static auto make_matrix(std::size_t n, std::uint32_t seed) -> std::vector<T> {
+    auto res = std::vector<T>(n);
+    for (auto i = 0ul; i < n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        if constexpr (std::is_integral_v<T>) res[i] = static_cast<T>(seed >> 24);
+        else res[i] = T(float(seed >> 8) / float(1u << 24) * 2.f - 1.f);
+    }
+    return res;
+}
+
+template <typename T>
+static auto to_double(T v) -> double {
+    if constexpr (std::is_integral_v<T>) return double(v);
+    else return double(static_cast<float>(v));
+}
+
+// (m, n, k) pairs with partial tiles, partial depth groups and sizes that span several blocks.
+static constexpr std::size_t shapes[][3] = {
+    { 1, 1, 1 }, { 3, 5, 7 }, { 6, 16, 8 }, { 17, 33, 13 }, { 64, 64, 64 }, { 70, 45, 130 }, { 129, 100, 67 }
+};
+
+template <typename L, typename R, typename U>
+static auto check_gemm(GemmBlocking const* blocking) -> void {
+    for (auto const& [m, n, k] : shapes) {
+        // Padded leading dimensions make sure the strides are honoured.
+        auto const lda = k + 3;
+        auto const ldb = n + 1;
+        auto const ldc = n + 2;
+        auto const a = make_matrix<L>(m * lda, std::uint32_t(m * 31 + k));
+        auto const b = make_matrix<R>(k * ldb, std::uint32_t(n * 17 + k));
+        auto c = std::vector<U>(m * ldc, U(7));
+        auto const init = c;
+
+        auto const shape = GemmShape{ .m = m, .n = n, .k = k, .lda = lda, .ldb = ldb, .ldc = ldc };
+        if (blocking) gemm(std::span(a), std::span(b), std::span(c), shape, *blocking);
+        else gemm(std::span(a), std::span(b), std::span(c), shape);
+
+        auto acc = c;
+        auto acc_shape = shape;
+        acc_shape.accumulate = true;
+        if (blocking) gemm(std::span(a), std::span(b), std::span(acc), acc_shape, *blocking);
+        else gemm(std::span(a), std::span(b), std::span(acc), acc_shape);
+
+        for (auto i = 0ul; i < m; ++i) {
+            for (auto j = 0ul; j < n; ++j) {
+                auto ref = 0.;
+                for (auto p = 0ul; p < k; ++p) ref += to_double(a[i * lda + p]) * to_double(b[p * ldb + j]);
+                if constexpr (std::is_integral_v<U>) {
+                    REQUIRE(c[i * ldc + j] == static_cast<U>(static_cast<std::int64_t>(ref)));
+                    REQUIRE(acc[i * ldc + j] == static_cast<U>(static_cast<std::int64_t>(2 * ref)));
+                } else {
+                    auto const tol = (std::is_same_v<U, float> ? 1e-5 : 1e-13) * double(k);
+                    REQUIRE(std::abs(double(c[i * ldc + j]) - ref) <= tol);
+                    REQUIRE(std::abs(double(acc[i * ldc + j]) - 2 * ref) <= 2 * tol);
+                }
+            }
+            // Padding columns of `C` are never written.
+            for (auto j = n; j < ldc; ++j) {
+                REQUIRE(c[i * ldc + j] == init[i * ldc + j]);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE(VEC_ARCH_NAME " Floating-point GEMM", "[gemm]", float, double) {
+    SECTION("Blocking from the cache sizes") {
+        check_gemm<TestType, TestType, TestType>(nullptr);
+    }
+    SECTION("Small blocks") {
+        auto const blocking = GemmBlocking{ .mc = 12, .nc = 8, .kc = 16 };
+        check_gemm<TestType, TestType, TestType>(&blocking);
+    }
+}
+
+TEMPLATE_TEST_CASE(VEC_ARCH_NAME " Half-precision GEMM", "[gemm]", float16, bfloat16) {
+    check_gemm<TestType, TestType, float>(nullptr);
+    auto const blocking = GemmBlocking{ .mc = 12, .nc = 8, .kc = 16 };
+    check_gemm<TestType, TestType, float>(&blocking);
+}
+
+TEST_CASE(VEC_ARCH_NAME " 8-bit Integer GEMM", "[gemm]") {
+    // `kc = 10` is rounded down to a whole depth group.
+    auto const blocking = GemmBlocking{ .mc = 8, .nc = 8, .kc = 10 };
+    check_gemm<std::int8_t, std::int8_t, std::int32_t>(nullptr);
+    check_gemm<std::uint8_t, std::int8_t, std::int32_t>(nullptr);
+    check_gemm<std::int8_t, std::uint8_t, std::int32_t>(&blocking);
+    check_gemm<std::uint8_t, std::uint8_t, std::uint32_t>(nullptr);
+    check_gemm<std::uint8_t, std::uint8_t, std::uint32_t>(&blocking);
+}
+
+TEST_CASE(VEC_ARCH_NAME " GEMM Blocking", "[gemm]") {
+    auto cache = CacheLevels{};
+    cache.push_back({ .level = 1, .size = 32 * 1024 });
+    cache.push_back({ .level = 2, .size = 1024 * 1024 });
+    cache.push_back({ .level = 3, .size = 8 * 1024 * 1024 });
+    auto const b = ui::internal::make_gemm_blocking(cache, 6, 16, 4, 4);
+    REQUIRE(b.kc == 184);
+    REQUIRE(b.mc % 6 == 0);
+    REQUIRE(b.mc * b.kc * 4 <= 512 * 1024);
+    REQUIRE(b.nc % 16 == 0);
+    REQUIRE(b.nc * b.kc * 4 <= 4 * 1024 * 1024);
+
+    auto const d = gemm_blocking<float>();
+    REQUIRE(d.kc >= 8);
+    REQUIRE(d.mc >= ui::internal::gemm_mr<float, float>);
+    REQUIRE(d.nc >= ui::internal::gemm_nr<float, float>);
+}
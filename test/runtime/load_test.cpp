@@ -5,6 +5,7 @@
 #include <catch2/matchers/catch_matchers_templated.hpp>
 
 #include <cstdint>
+#include <cstring>
 #include <format>
 #include <print>
 #include <span>
@@ -24,6 +25,52 @@ struct Fixture{
 
 };
 
+// The interleaved output must match the emulated backend bit for bit.
+template <std::size_t N, typename T>
+static auto check_strided_store(std::span<T const> data) -> void {
+    auto a = Vec<N, T>::load(data.data() + 0 * N, N);
+    auto b = Vec<N, T>::load(data.data() + 1 * N, N);
+    auto c = Vec<N, T>::load(data.data() + 2 * N, N);
+    auto d = Vec<N, T>::load(data.data() + 3 * N, N);
+
+    auto const check = [](std::vector<T> const& res, std::vector<T> const& expected) {
+        INFO(std::format("N = {}", N));
+        for (auto i = 0ul; i < res.size(); ++i) {
+            REQUIRE(std::memcmp(&res[i], &expected[i], sizeof(T)) == 0);
+        }
+    };
+
+    {
+        auto res = std::vector<T>(2 * N + 1);
+        auto expected = res;
+        strided_store(res.data(), a, b);
+        emul::strided_store(expected.data(), a, b);
+        check(res, expected);
+    }
+    {
+        auto res = std::vector<T>(3 * N + 1);
+        auto expected = res;
+        strided_store(res.data(), a, b, c);
+        emul::strided_store(expected.data(), a, b, c);
+        check(res, expected);
+    }
+    {
+        auto res = std::vector<T>(4 * N + 1);
+        auto expected = res;
+        strided_store(res.data(), a, b, c, d);
+        emul::strided_store(expected.data(), a, b, c, d);
+        check(res, expected);
+    }
+}
+
+template <std::size_t N, typename T>
+static auto check_strided_stores(std::span<T const> data) -> void {
+    check_strided_store<N, T>(data);
+    check_strided_store<std::max(16 / sizeof(T), 1ul), T>(data);
+    check_strided_store<std::max(8 / sizeof(T), 1ul), T>(data);
+    check_strided_store<1, T>(data);
+}
+
 using SignedTypes = std::tuple<
     std::uint8_t,
     std::uint16_t,
@@ -110,6 +157,10 @@ TEMPLATE_LIST_TEST_CASE_METHOD(
             REQUIRE(d[i] == data[4 * i + 3]);
         }
     }
+
+    WHEN("Strided store") {
+        check_strided_stores<N, type>(data);
+    }
 }
 
 template <std::floating_point T>
@@ -216,4 +267,8 @@ TEMPLATE_LIST_TEST_CASE_METHOD(
             REQUIRE_THAT(ftype(d[i]), Catch::Matchers::WithinRel(ftype(data[4 * i + 3]), eps<ftype>));
         }
     }
+
+    WHEN("Strided store") {
+        check_strided_stores<N, type>(data);
+    }
 }
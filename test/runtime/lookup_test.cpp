@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include "ui.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t
+>;
+
+template <std::size_t M, std::size_t N, typename T>
+static auto check_lookup() -> void {
+    auto table = DataGenerator<M, T>::random(M);
+    auto indices = Vec<N, std::uint8_t>{};
+    // Every index value is exercised across the offsets, including the out-of-range ones.
+    for (auto offset = 0u; offset < 256; offset += N) {
+        for (auto i = 0u; i < N; ++i) {
+            indices[i] = static_cast<std::uint8_t>((offset + i * 37) & 0xff);
+        }
+        auto res = lookup(table, indices);
+        INFO(std::format("lookup({}, {}) = {}", table, indices, res));
+        for (auto i = 0ul; i < N; ++i) {
+            auto idx = static_cast<std::size_t>(indices[i]);
+            auto expected = idx < M ? table[idx] : T(0);
+            REQUIRE(res[i] == expected);
+        }
+    }
+}
+
+template <std::size_t M, typename T>
+static auto check_table() -> void {
+    check_lookup<M,  8, T>();
+    check_lookup<M, 16, T>();
+    check_lookup<M, 32, T>();
+    check_lookup<M, 64, T>();
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Runtime Lookup",
+    "[lookup][permute]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Table is 16 bytes") {
+        check_table<16, type>();
+    }
+
+    WHEN("Table is 32 bytes") {
+        check_table<32, type>();
+    }
+
+    WHEN("Table is 64 bytes") {
+        check_table<64, type>();
+    }
+
+    WHEN("Table size is not a multiple of a register") {
+        check_table<8, type>();
+    }
+
+    WHEN("Indices are the identity") {
+        auto table = DataGenerator<16, type>::random(16);
+        auto indices = Vec<16, std::uint8_t>{};
+        for (auto i = 0u; i < 16; ++i) indices[i] = static_cast<std::uint8_t>(i);
+        auto res = lookup(table, indices);
+        for (auto i = 0ul; i < 16; ++i) REQUIRE(res[i] == table[i]);
+    }
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <vector>
+#include "ui.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    float,
+    double
+>;
+
+template <std::size_t N, typename T>
+static auto make_mask() -> mask_t<N, T> {
+    return DataGenerator<N, T>::make_mask([](int i) {
+        return static_cast<mask_inner_t<T>>(i % 3 == 1 ? 0 : ~mask_inner_t<T>{});
+    });
+}
+
+template <std::size_t N, typename T>
+static auto check_masked() -> void {
+    // Pad the buffer so that the sentinels around the window can be checked.
+    std::vector<T> data(N + 2);
+    DataGenerator<N, T>::random(data.data(), data.size());
+    auto const* in = data.data() + 1;
+    auto const mask = make_mask<N, T>();
+
+    {
+        auto src = load<N>(T(1));
+        auto res = masked_load(in, mask, src);
+        INFO(std::format("masked_load({}) = {}", mask, res));
+        for (auto i = 0ul; i < N; ++i) {
+            if (mask[i]) REQUIRE(res[i] == in[i]);
+            else REQUIRE(res[i] == T(1));
+        }
+    }
+
+    for (auto count = 0ul; count <= N + 1; ++count) {
+        auto res = masked_load<N>(in, count);
+        INFO(std::format("masked_load({}) = {}", count, res));
+        for (auto i = 0ul; i < N; ++i) {
+            if (i < count) REQUIRE(res[i] == in[i]);
+            else REQUIRE(res[i] == T(0));
+        }
+    }
+
+    {
+        auto out = std::vector<T>(N + 2, T(3));
+        auto v = load<N>(T(2));
+        masked_store(out.data() + 1, v, mask);
+        REQUIRE(out.front() == T(3));
+        REQUIRE(out.back() == T(3));
+        for (auto i = 0ul; i < N; ++i) {
+            auto expected = mask[i] ? T(2) : T(3);
+            REQUIRE(out[i + 1] == expected);
+        }
+    }
+
+    for (auto count = 0ul; count <= N + 1; ++count) {
+        auto out = std::vector<T>(N + 2, T(3));
+        auto v = load<N>(T(2));
+        masked_store(out.data() + 1, v, count);
+        INFO(std::format("masked_store({})", count));
+        REQUIRE(out.front() == T(3));
+        REQUIRE(out.back() == T(3));
+        for (auto i = 0ul; i < N; ++i) {
+            auto expected = i < count ? T(2) : T(3);
+            REQUIRE(out[i + 1] == expected);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Masked Load and Store",
+    "[masked][load][store]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Vector is narrower than a register") {
+        check_masked<2, type>();
+    }
+
+    WHEN("Vector fits a register") {
+        check_masked<16 / sizeof(type), type>();
+    }
+
+    WHEN("Vector spans multiple registers") {
+        check_masked< 8, type>();
+        check_masked<16, type>();
+        check_masked<32, type>();
+        check_masked<64, type>();
+    }
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <vector>
+#include "ui.hpp"
+#include "ui/mod_arith.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / sizeof(T);
+};
+
+using Types = std::tuple<
+    std::uint32_t,
+    std::uint64_t
+>;
+
+// NTT-friendly primes with a generator of their multiplicative group, and plain odd moduli that
+// use the full width.
+template <typename T>
+struct Moduli;
+
+template <>
+struct Moduli<std::uint32_t> {
+    static constexpr std::uint32_t prime = 998244353u;
+    static constexpr std::uint32_t generator = 3u;
+    static constexpr std::uint32_t others[] = { 3u, 65537u, 2147483647u, 4294967291u, 4294967295u };
+};
+
+template <>
+struct Moduli<std::uint64_t> {
+    static constexpr std::uint64_t prime = 0xffff'ffff'0000'0001ull;
+    static constexpr std::uint64_t generator = 7ull;
+    static constexpr std::uint64_t others[] = { 3ull, 998244353ull, (1ull << 61) - 1, 0xffff'ffff'ffff'ffc5ull, ~0ull };
+};
+
+template <typename T>
+static constexpr auto ref_mul(T a, T b, T m) noexcept -> T {
+    return static_cast<T>(static_cast<unsigned __int128>(a) * b % m);
+}
+
+template <typename T>
+static constexpr auto ref_pow(T a, T e, T m) noexcept -> T {
+    auto res = T(1 % m);
+    for (a %= m; e; e >>= 1) {
+        if (e & 1) res = ref_mul(res, a, m);
+        a = ref_mul(a, a, m);
+    }
+    return res;
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Modular Arithmetic",
+    "[mod_arith]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    using moduli = Moduli<type>;
+
+    auto mods = std::vector<type>(std::begin(moduli::others), std::end(moduli::others));
+    mods.push_back(moduli::prime);
+
+    WHEN("Montgomery and Barrett operations") {
+        for (auto m: mods) {
+            auto const ma = ModArith<type>(m);
+            for (auto seed = 0ul; seed < 16; ++seed) {
+                auto raw_a = DataGenerator<N, type>::random(seed);
+                auto raw_b = DataGenerator<N, type>::random(seed + 100);
+                raw_a[0] = type(m - 1);
+                raw_b[0] = type(m - 1);
+                raw_a[1] = std::numeric_limits<type>::max();
+
+                auto const a = ma.reduce(raw_a);
+                auto const b = ma.reduce(raw_b);
+                auto const sum = ma.add(a, b);
+                auto const diff = ma.sub(a, b);
+                auto const prod = ma.from_mont(ma.mul(ma.to_mont(a), ma.to_mont(b)));
+                auto const mixed = ma.mul(ma.to_mont(a), b);
+                auto const p = ma.from_mont(ma.pow(ma.to_mont(a), type(seed * 7 + 3)));
+                for (auto i = 0ul; i < N; ++i) {
+                    INFO(std::format("m = {}, a = {}, b = {}", m, raw_a[i], raw_b[i]));
+                    REQUIRE(a[i] == raw_a[i] % m);
+                    REQUIRE(b[i] == raw_b[i] % m);
+                    REQUIRE(sum[i] == static_cast<type>((static_cast<unsigned __int128>(a[i]) + b[i]) % m));
+                    REQUIRE(diff[i] == (a[i] >= b[i] ? type(a[i] - b[i]) : type(a[i] + (m - b[i]))));
+                    REQUIRE(prod[i] == ref_mul(a[i], b[i], m));
+                    REQUIRE(mixed[i] == ref_mul(a[i], b[i], m));
+                    REQUIRE(p[i] == ref_pow(a[i], type(seed * 7 + 3), m));
+                }
+                REQUIRE(ma.mul(ma.to_mont(a[2]), b[2]) == ref_mul(a[2], b[2], m));
+                REQUIRE(ma.add(a[2], b[2]) == sum[2]);
+                REQUIRE(ma.sub(a[2], b[2]) == diff[2]);
+            }
+        }
+    }
+
+    WHEN("Number theoretic transform") {
+        auto const m = moduli::prime;
+        for (auto size: { 1ul, 2ul, 4ul, 16ul, 64ul, 512ul }) {
+            auto const root = ref_pow(moduli::generator, type((m - 1) / size), m);
+            auto const ntt = NTT<type>(m, root, size);
+
+            // Cyclic convolution of two batches of `size` elements through the transform.
+            static constexpr auto batches = 3ul;
+            auto a = std::vector<type>(size * batches);
+            auto b = std::vector<type>(size * batches);
+            DataGenerator<1, type>::random(a.data(), a.size(), size);
+            DataGenerator<1, type>::random(b.data(), b.size(), size + 1);
+            for (auto& x: a) x %= m;
+            for (auto& x: b) x %= m;
+
+            auto expected = std::vector<type>(size * batches);
+            for (auto k = 0ul; k < batches; ++k) {
+                for (auto i = 0ul; i < size; ++i) {
+                    for (auto j = 0ul; j < size; ++j) {
+                        auto& e = expected[k * size + (i + j) % size];
+                        e = ntt.arith().add(e, ref_mul(a[k * size + i], b[k * size + j], m));
+                    }
+                }
+            }
+
+            auto const original = a;
+            ntt.forward(std::span(a));
+            ntt.forward(std::span(b));
+            for (auto i = 0ul; i < a.size(); ++i) {
+                a[i] = ref_mul(a[i], b[i], m);
+            }
+            ntt.inverse(std::span(a));
+            INFO(std::format("size = {}", size));
+            REQUIRE(a == expected);
+
+            auto round_trip = original;
+            ntt.forward(std::span(round_trip));
+            ntt.inverse(std::span(round_trip));
+            REQUIRE(round_trip == original);
+        }
+    }
+}
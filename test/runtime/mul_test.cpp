@@ -58,6 +58,44 @@ TEMPLATE_LIST_TEST_CASE_METHOD(
         }
     }
 
+    WHEN("High-half multiplication") {
+        auto d = DataGenerator<N, type>::random();
+        auto res = mul_high(v, d);
+        for (auto i = 0ul; i < N; ++i) {
+            type l = res[i];
+            type r;
+            if constexpr (sizeof(type) < 8) {
+                r = type((wtype(v[i]) * wtype(d[i])) >> (sizeof(type) * 8));
+            } else {
+                using ltype = std::conditional_t<std::is_signed_v<type>, __int128, unsigned __int128>;
+                r = type((ltype(v[i]) * ltype(d[i])) >> 64);
+            }
+            INFO(std::format("[{}]: {} == {}", i, l, r));
+            REQUIRE(l == r);
+        }
+    }
+
+    WHEN("Wide multiplication") {
+        auto d = DataGenerator<N, type>::random();
+        // Include the extremes so that the signed corrections are exercised.
+        d[0] = min;
+        d[1] = max;
+        auto [lo, hi] = mul_wide(v, d);
+        auto expected_hi = mul_high(v, d);
+        for (auto i = 0ul; i < N; ++i) {
+            INFO(std::format("[{}]: {} * {}", i, v[i], d[i]));
+            REQUIRE(hi[i] == expected_hi[i]);
+            if constexpr (sizeof(type) < 8) {
+                REQUIRE(lo[i] == type(wtype(v[i]) * wtype(d[i])));
+            } else {
+                using ltype = std::conditional_t<std::is_signed_v<type>, __int128, unsigned __int128>;
+                auto const p = ltype(v[i]) * ltype(d[i]);
+                REQUIRE(lo[i] == type(p));
+                REQUIRE(hi[i] == type(p >> 64));
+            }
+        }
+    }
+
     WHEN("Multiplication with accumulating addition") {
         auto d = DataGenerator<N, type>::random();
         auto res = mul_acc(Vec<N, type>::load(1), v, d, op::add_t{});
@@ -242,6 +280,42 @@ TEMPLATE_LIST_TEST_CASE_METHOD(
             }
         }
     }
+
+    if constexpr (sizeof(type) == 1) {
+        WHEN("Four-way dot-product accumulation") {
+            auto const check = []<std::size_t M, typename U>(Vec<M, type> const& lhs, Vec<M, U> const& rhs) {
+                static constexpr auto K = M / 4;
+                using acc_t = std::conditional_t<std::is_signed_v<type> || std::is_signed_v<U>, std::int32_t, std::uint32_t>;
+                auto acc = Vec<K, acc_t>{};
+                for (auto i = 0ul; i < K; ++i) acc[i] = static_cast<acc_t>(std::int32_t(i) * 1000 - 3000);
+                auto const res = dot_acc(acc, lhs, rhs);
+                STATIC_REQUIRE(std::same_as<typename decltype(res)::element_t, acc_t>);
+                for (auto i = 0ul; i < K; ++i) {
+                    auto r = static_cast<std::int64_t>(acc[i]);
+                    for (auto k = 4 * i; k < 4 * i + 4; ++k) r += std::int64_t(lhs[k]) * std::int64_t(rhs[k]);
+                    INFO(std::format("[{}]: {} == {}", i, res[i], r));
+                    REQUIRE(res[i] == static_cast<acc_t>(r));
+                }
+            };
+            // Pairs of extreme products overflow a 16-bit intermediate sum.
+            auto const extremes = []<std::size_t M, typename U>() {
+                auto res = Vec<M, U>{};
+                for (auto i = 0ul; i < M; ++i) {
+                    res[i] = i % 3 == 2 ? std::numeric_limits<U>::min() : std::numeric_limits<U>::max();
+                }
+                return res;
+            };
+            // Every accumulator width from two lanes up to two 512-bit registers.
+            [&]<std::size_t... Ms>(std::index_sequence<Ms...>) {
+                ((
+                    check(DataGenerator<Ms, type>::random(), DataGenerator<Ms, std::int8_t>::random()),
+                    check(DataGenerator<Ms, type>::random(), DataGenerator<Ms, std::uint8_t>::random()),
+                    check(extremes.template operator()<Ms, type>(), extremes.template operator()<Ms, std::int8_t>()),
+                    check(extremes.template operator()<Ms, type>(), extremes.template operator()<Ms, std::uint8_t>())
+                ), ...);
+            }(std::index_sequence<8, 16, 32, 64, 128>{});
+        }
+    }
 }
 
 template <std::floating_point T>
@@ -504,4 +578,20 @@ TEMPLATE_LIST_TEST_CASE_METHOD(
             }
         }
     }
+
+    if constexpr (std::same_as<type, bfloat16>) {
+        WHEN("Pairwise dot-product accumulation") {
+            auto d = DataGenerator<N, type>::random();
+            auto acc = Vec<N / 2, float>{};
+            for (auto i = 0ul; i < N / 2; ++i) acc[i] = float(i) - 3.5f;
+            auto res = dot_acc(acc, v, d);
+            for (auto i = 0ul; i < N / 2; ++i) {
+                // The products are exact in float, so fused and unfused evaluation agree.
+                auto r = acc[i] + float(v[2 * i]) * float(d[2 * i]);
+                r += float(v[2 * i + 1]) * float(d[2 * i + 1]);
+                INFO(std::format("[{}]: {} == {}", i, res[i], r));
+                REQUIRE(res[i] == r);
+            }
+        }
+    }
 }
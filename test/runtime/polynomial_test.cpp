@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <array>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <utility>
+#include "ui.hpp"
+#include "ui/polynomial.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / sizeof(T);
+};
+
+using Types = std::tuple<
+    float,
+    double
+>;
+
+using HalfTypes = std::tuple<
+    float16,
+    bfloat16
+>;
+
+template <std::size_t K>
+static auto ref_poly(std::array<double, K> const& c, long double x) -> long double {
+    auto res = 0.0L;
+    for (auto i = K; i > 0; --i) res = res * x + c[i - 1];
+    return res;
+}
+
+// Taylor series of exp(x) and its [3/3] Pade approximant.
+static constexpr std::array<double, 8> exp_taylor{ 1., 1., 1. / 2, 1. / 6, 1. / 24, 1. / 120, 1. / 720, 1. / 5040 };
+static constexpr std::array<double, 4> pade_p{ 1., 1. / 2, 1. / 10, 1. / 120 };
+static constexpr std::array<double, 4> pade_q{ 1., -1. / 2, 1. / 10, -1. / 120 };
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Polynomial Evaluation",
+    "[polynomial]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    static constexpr auto eps = static_cast<long double>(std::numeric_limits<type>::epsilon());
+
+    auto x = Vec<N, type>{};
+    for (auto i = 0ul; i < N; ++i) {
+        x[i] = type(-1) + type(2) * type(i) / type(N - 1);
+    }
+
+    auto const check = [&x](auto const& res, auto&& ref, long double tol) {
+        for (auto i = 0ul; i < N; ++i) {
+            auto const expected = ref(static_cast<long double>(x[i]));
+            INFO(std::format("x = {}, got = {}, expected = {}", x[i], res[i], static_cast<double>(expected)));
+            REQUIRE(std::fabs(res[i] - expected) <= tol * std::fmax(std::fabs(expected), 1.0L));
+        }
+    };
+
+    WHEN("Constant and linear") {
+        REQUIRE(ui::horner<2.5>(x)[0] == type(2.5));
+        REQUIRE(ui::estrin<2.5>(x)[0] == type(2.5));
+        check(ui::horner<1, 2>(x), [](auto v) { return 1 + 2 * v; }, eps);
+        check(ui::estrin<1, 2>(x), [](auto v) { return 1 + 2 * v; }, eps);
+    }
+
+    WHEN("Every degree agrees between the schemes") {
+        static constexpr std::array<double, 13> c{ 0.5, -1.25, 0.75, 2., -0.5, 0.125, 1., -2., 0.25, 1.5, -0.75, 0.0625, 3. };
+        auto const run = [&]<std::size_t K>(std::integral_constant<std::size_t, K>) {
+            static constexpr auto sub = [] {
+                auto r = std::array<double, K>{};
+                for (auto i = 0ul; i < K; ++i) r[i] = c[i];
+                return r;
+            }();
+            INFO(std::format("degree = {}", K - 1));
+            auto const ref = [](auto v) { return ref_poly(sub, v); };
+            check(ui::horner<sub>(x), ref, 64 * eps);
+            check(ui::estrin<sub>(x), ref, 64 * eps);
+            check(ui::poly<sub>(x), ref, 64 * eps);
+        };
+        [&]<std::size_t... K>(std::index_sequence<K...>) {
+            (run(std::integral_constant<std::size_t, K + 1>{}), ...);
+        }(std::make_index_sequence<c.size()>{});
+    }
+
+    WHEN("Scalar and array coefficients mix") {
+        auto const ref = [](auto v) { return ref_poly(exp_taylor, v); };
+        check(ui::poly<1., std::array{ 1., 1. / 2 }, 1. / 6, std::array{ 1. / 24, 1. / 120, 1. / 720, 1. / 5040 }>(x), ref, 4 * eps);
+    }
+
+    WHEN("Rational function") {
+        auto const ref = [](auto v) { return ref_poly(pade_p, v) / ref_poly(pade_q, v); };
+        check(ui::rational<pade_p, pade_q>(x), ref, 4 * eps);
+        check(ui::rational<std::array{ 1., 1. }, 2.>(x), [](auto v) { return (1 + v) / 2; }, 2 * eps);
+        check(ui::rational<1., std::array{ 3., 1. }>(x), [](auto v) { return 1 / (3 + v); }, 2 * eps);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Polynomial Evaluation on Half-Precision Lanes",
+    "[polynomial]",
+    HalfTypes
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    // Evaluated in float and narrowed once.
+    static constexpr auto rel = std::same_as<type, float16> ? 0x1p-10f : 0x1p-7f;
+
+    auto x = Vec<N, type>{};
+    for (auto i = 0ul; i < N; ++i) {
+        x[i] = type(float(i) / float(N) - 0.5f);
+    }
+
+    auto const check = [&x](auto const& res, auto&& ref) {
+        for (auto i = 0ul; i < N; ++i) {
+            auto const expected = float(type(ref(float(x[i]))));
+            INFO(std::format("x = {}, got = {}, expected = {}", float(x[i]), float(res[i]), expected));
+            REQUIRE(std::fabs(float(res[i]) - expected) <= rel * std::fabs(expected));
+        }
+    };
+
+    check(ui::horner<exp_taylor>(x), [](float v) { return float(ref_poly(exp_taylor, v)); });
+    check(ui::estrin<exp_taylor>(x), [](float v) { return float(ref_poly(exp_taylor, v)); });
+    check(ui::rational<pade_p, pade_q>(x), [](float v) { return float(ref_poly(pade_p, v) / ref_poly(pade_q, v)); });
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "ui.hpp"
+#include "ui/quantize.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+// Deterministic values in [-amp, amp] with a different range per block.
+static auto make_input(std::size_t n, std::size_t block) -> std::vector<float> {
+    auto res = std::vector<float>(n);
+    auto state = 0x12345678u;
+    for (auto i = 0ul; i < n; ++i) {
+        state = state * 1664525u + 1013904223u;
+        auto const amp = float(1 + (i / block) % 7) * 0.75f;
+        res[i] = (float(state >> 8) / float(1u << 24) * 2.f - 1.f) * amp;
+    }
+    return res;
+}
+
+TEST_CASE(VEC_ARCH_NAME " Symmetric int8 Quantization", "[quantize]") {
+    // Sizes cover a partial register, a partial block and a short last block.
+    for (auto const [n, block] : { std::pair{ 5ul, 64ul }, std::pair{ 200ul, 64ul }, std::pair{ 333ul, 48ul }, std::pair{ 1024ul, 256ul } }) {
+        auto const x = make_input(n, block);
+        auto const blocks = (n + block - 1) / block;
+        auto q = std::vector<std::int8_t>(n);
+        auto scales = std::vector<float>(blocks);
+        auto y = std::vector<float>(n);
+
+        quantize(std::span(x), std::span(q), std::span(scales), block);
+        dequantize(std::span(q), std::span(y), std::span(scales), block);
+
+        for (auto b = 0ul; b < blocks; ++b) {
+            auto const first = x.begin() + long(b * block);
+            auto const last = x.begin() + long(std::min(n, (b + 1) * block));
+            auto const amax = std::abs(*std::max_element(first, last, [](float l, float r) { return std::abs(l) < std::abs(r); }));
+            REQUIRE(scales[b] == amax / 127.f);
+        }
+        for (auto i = 0ul; i < n; ++i) {
+            auto const scale = scales[i / block];
+            REQUIRE(q[i] == std::clamp(std::nearbyint(x[i] / scale), -127.f, 127.f));
+            REQUIRE(std::abs(y[i] - x[i]) <= scale * 0.5001f);
+        }
+    }
+
+    SECTION("Zero block") {
+        auto const x = std::vector<float>(40, 0.f);
+        auto q = std::vector<std::int8_t>(40, 1);
+        auto scales = std::vector<float>(1, 1.f);
+        quantize(std::span(x), std::span(q), std::span(scales), 64);
+        REQUIRE(scales[0] == 0.f);
+        REQUIRE(std::all_of(q.begin(), q.end(), [](auto v) { return v == 0; }));
+    }
+}
+
+TEST_CASE(VEC_ARCH_NAME " Asymmetric uint8 Quantization", "[quantize]") {
+    for (auto const [n, block] : { std::pair{ 7ul, 32ul }, std::pair{ 300ul, 64ul }, std::pair{ 513ul, 128ul } }) {
+        auto x = make_input(n, block);
+        // One positive-only block; the range still contains zero.
+        for (auto i = 0ul; i < std::min(n, block); ++i) x[i] = std::abs(x[i]) + 1.f;
+
+        auto const blocks = (n + block - 1) / block;
+        auto q = std::vector<std::uint8_t>(n);
+        auto scales = std::vector<float>(blocks);
+        auto zp = std::vector<std::uint8_t>(blocks);
+        auto y = std::vector<float>(n);
+
+        quantize(std::span(x), std::span(q), std::span(scales), std::span(zp), block);
+        dequantize(std::span(q), std::span(y), std::span(scales), std::span(zp), block);
+
+        REQUIRE(zp[0] == 0);
+        for (auto i = 0ul; i < n; ++i) {
+            auto const scale = scales[i / block];
+            auto const expected = std::clamp(std::nearbyint(x[i] / scale) + float(zp[i / block]), 0.f, 255.f);
+            REQUIRE(std::abs(float(q[i]) - expected) <= 1.f);
+            REQUIRE(std::abs(y[i] - x[i]) <= scale * 1.0001f);
+        }
+    }
+}
+
+TEST_CASE(VEC_ARCH_NAME " Packed int4 Quantization", "[quantize]") {
+    for (auto const [n, block] : { std::pair{ 9ul, 32ul }, std::pair{ 250ul, 32ul }, std::pair{ 1001ul, 128ul } }) {
+        auto const x = make_input(n, block);
+        auto const blocks = (n + block - 1) / block;
+        auto scales = std::vector<float>(blocks);
+        auto y = std::vector<float>(n);
+
+        SECTION("Symmetric") {
+            // One spare byte checks that nothing is written past the packed size.
+            auto q = std::vector<std::uint8_t>((n + 1) / 2 + 1, 0xAA);
+            quantize<4>(std::span(x), std::span(q), std::span(scales), block);
+            REQUIRE(q.back() == 0xAA);
+
+            for (auto i = 0ul; i < n; ++i) {
+                auto const scale = scales[i / block];
+                auto const nibble = (q[i / 2] >> (4 * (i % 2))) & 0xF;
+                auto const code = (nibble ^ 8) - 8;
+                REQUIRE(float(code) == std::clamp(std::nearbyint(x[i] / scale), -7.f, 7.f));
+            }
+
+            dequantize<4>(std::span(std::as_const(q)), std::span(y), std::span(std::as_const(scales)), block);
+            for (auto i = 0ul; i < n; ++i) {
+                REQUIRE(std::abs(y[i] - x[i]) <= scales[i / block] * 0.5001f);
+            }
+        }
+
+        SECTION("Asymmetric") {
+            auto q = std::vector<std::uint8_t>((n + 1) / 2);
+            auto zp = std::vector<std::uint8_t>(blocks);
+            quantize<4>(std::span(x), std::span(q), std::span(scales), std::span(zp), block);
+            dequantize<4>(std::span(q), std::span(y), std::span(scales), std::span(zp), block);
+            for (auto i = 0ul; i < n; ++i) {
+                REQUIRE(zp[i / block] <= 15);
+                REQUIRE(std::abs(y[i] - x[i]) <= scales[i / block] * 1.0001f);
+            }
+        }
+    }
+}
+
+TEST_CASE(VEC_ARCH_NAME " float16 Quantization", "[quantize][float16]") {
+    static constexpr auto n = 150ul;
+    static constexpr auto block = 32ul;
+    auto const xf = make_input(n, block);
+    auto x = std::vector<float16>(n);
+    for (auto i = 0ul; i < n; ++i) x[i] = float16(xf[i]);
+
+    auto q = std::vector<std::int8_t>(n);
+    auto scales = std::vector<float>((n + block - 1) / block);
+    auto y = std::vector<float16>(n);
+    quantize(std::span(x), std::span(q), std::span(scales), block);
+    dequantize(std::span(q), std::span(y), std::span(scales), block);
+
+    for (auto i = 0ul; i < n; ++i) {
+        auto const scale = scales[i / block];
+        REQUIRE(float(q[i]) == std::nearbyint(float(x[i]) / scale));
+        // Half of a step plus the rounding of the `float16` result.
+        REQUIRE(std::abs(float(y[i]) - float(x[i])) <= scale * 0.5001f + std::abs(float(x[i])) * 0x1p-10f);
+    }
+}
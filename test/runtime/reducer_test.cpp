@@ -0,0 +1,174 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <vector>
+#include "ui.hpp"
+#include "ui/reducer.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::uint16_t,
+    std::int32_t,
+    float,
+    double
+>;
+
+// Uneven chunks so that partial vectors land in the middle of the stream.
+static constexpr std::size_t chunks[] = { 0, 1, 7, 64, 3, 129, 1000, 31, 2 };
+
+template <typename T>
+static auto make_data(std::size_t n, std::size_t seed) -> std::vector<T> {
+    auto res = std::vector<T>(n);
+    DataGenerator<1, T>::random(res.data(), n, seed);
+    return res;
+}
+
+template <typename R, typename T>
+static auto push_chunks(R& r, std::vector<T> const& data) -> void {
+    auto offset = std::size_t{};
+    for (auto c: chunks) {
+        r.push(std::span<T const>(data.data() + offset, c));
+        offset += c;
+    }
+}
+
+static constexpr auto total_size = [] {
+    auto res = std::size_t{};
+    for (auto c: chunks) res += c;
+    return res;
+}();
+
+template <typename T, typename W = T>
+static constexpr auto wrap_add(W a, T b) noexcept -> W {
+    if constexpr (std::integral<W>) {
+        using utype = std::make_unsigned_t<W>;
+        return static_cast<W>(static_cast<utype>(static_cast<utype>(a) + static_cast<utype>(static_cast<W>(b))));
+    } else {
+        return a + b;
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Streaming Reducers",
+    "[reducer][reduce]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    auto const data = make_data<type>(total_size, 42);
+
+    WHEN("Reducer") {
+        auto sum = Reducer<type>{};
+        auto sum_init = Reducer<type>{ type(3) };
+        auto mx = Reducer<type, op::max_t>{};
+        auto mn = Reducer<type, op::min_t, 2>{};
+        push_chunks(sum, data);
+        push_chunks(sum_init, data);
+        push_chunks(mx, data);
+        push_chunks(mn, data);
+
+        auto expected = type{};
+        auto magnitude = type{};
+        for (auto v: data) {
+            expected = wrap_add(expected, v);
+            if constexpr (std::floating_point<type>) magnitude += std::abs(v);
+        }
+
+        REQUIRE(sum.size() == total_size);
+        if constexpr (std::integral<type>) {
+            REQUIRE(sum.result() == expected);
+            REQUIRE(sum_init.result() == wrap_add(expected, type(3)));
+        } else {
+            REQUIRE(std::abs(sum.result() - expected) <= magnitude * type(1e-5));
+            REQUIRE(std::abs(sum.mean() - expected / type(total_size)) <= magnitude * type(1e-5));
+        }
+        REQUIRE(mx.result() == *std::max_element(data.begin(), data.end()));
+        REQUIRE(mn.result() == *std::min_element(data.begin(), data.end()));
+    }
+
+    WHEN("Reducer fed with vectors") {
+        using reducer_t = Reducer<type, op::max_t>;
+        auto r = reducer_t{};
+        auto expected = std::numeric_limits<type>::lowest();
+        for (auto i = 0ul; i + reducer_t::lanes <= data.size(); i += reducer_t::lanes) {
+            r.push(reducer_t::vec_type::load(data.data() + i, reducer_t::lanes));
+            for (auto j = 0ul; j < reducer_t::lanes; ++j) expected = std::max(expected, data[i + j]);
+        }
+        REQUIRE(r.result() == expected);
+    }
+
+    if constexpr (std::floating_point<type>) {
+        WHEN("Reducer ignoring NaN") {
+            auto in = data;
+            auto const mx = *std::max_element(in.begin(), in.end());
+            for (auto& v: in) {
+                if (v != mx && (&v - in.data()) % 5 == 0) v = std::numeric_limits<type>::quiet_NaN();
+            }
+            auto r = Reducer<type, op::maxnm_t>{};
+            push_chunks(r, in);
+            REQUIRE(r.result() == mx);
+        }
+
+        WHEN("Compensated and pairwise sums") {
+            // One large value followed by many values below its rounding error; a plain sum
+            // loses all of them.
+            auto in = std::vector<type>(1 << 20, std::numeric_limits<type>::epsilon() / 4);
+            in[0] = type(1);
+            auto const expected = 1.0 + static_cast<double>(in.size() - 1) * static_cast<double>(in[1]);
+
+            auto kahan = KahanSum<type>{};
+            auto kahan_vec = KahanSum<type, 1>{};
+            kahan.push(std::span<type const>(in));
+            for (auto i = 0ul; i < in.size(); i += kahan_vec.lanes) {
+                kahan_vec.push(KahanSum<type, 1>::vec_type::load(in.data() + i, kahan_vec.lanes));
+            }
+            auto const eps = static_cast<double>(std::numeric_limits<type>::epsilon());
+            INFO(std::format("kahan = {}, expected = {}", kahan.result(), expected));
+            REQUIRE(std::abs(static_cast<double>(kahan.result()) - expected) <= eps);
+            REQUIRE(std::abs(static_cast<double>(kahan_vec.result()) - expected) <= eps);
+            REQUIRE(kahan.size() == in.size());
+
+            auto ones = std::vector<type>(3'000'001, type(0.1));
+            auto const ones_expected = static_cast<double>(ones.size()) * static_cast<double>(type(0.1));
+            auto pairwise = PairwiseSum<type>{};
+            auto plain = Reducer<type, op::add_t, 1>{};
+            push_chunks(pairwise, ones);
+            pairwise.push(std::span<type const>(ones).subspan(total_size));
+            plain.push(std::span<type const>(ones));
+            auto const pairwise_err = std::abs(static_cast<double>(pairwise.result()) - ones_expected);
+            auto const plain_err = std::abs(static_cast<double>(plain.result()) - ones_expected);
+            INFO(std::format("pairwise error = {}, plain error = {}", pairwise_err, plain_err));
+            REQUIRE(pairwise_err <= ones_expected * eps * 8);
+            REQUIRE(pairwise_err <= plain_err);
+            REQUIRE(std::abs(pairwise.mean() - type(0.1)) <= type(0.1) * type(eps) * 8);
+        }
+    }
+
+    if constexpr (std::integral<type> && sizeof(type) < 8) {
+        WHEN("Widening sum") {
+            using result_t = typename WideningSum<type>::result_t;
+            auto r = WideningSum<type>{};
+            push_chunks(r, data);
+            auto expected = result_t{};
+            for (auto v: data) expected = wrap_add<type, result_t>(expected, v);
+            REQUIRE(r.result() == expected);
+            REQUIRE(r.size() == total_size);
+        }
+    }
+}
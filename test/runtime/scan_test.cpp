@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <span>
+#include <vector>
+#include "ui.hpp"
+#include "ui/scan.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+};
+
+using Types = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::uint16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    std::uint64_t,
+    float,
+    double
+>;
+
+// Covers empty input, a partial register, whole registers and register boundaries.
+static constexpr std::size_t sizes[] = { 0, 1, 2, 3, 5, 8, 15, 16, 17, 31, 33, 64, 100, 255, 256, 257, 1000 };
+
+// Integer arithmetic wraps like the vector lanes do.
+template <typename T>
+static constexpr auto wrap_add(T a, T b) noexcept -> T {
+    if constexpr (std::integral<T>) {
+        using utype = std::make_unsigned_t<T>;
+        return static_cast<T>(static_cast<utype>(static_cast<utype>(a) + static_cast<utype>(b)));
+    } else {
+        return a + b;
+    }
+}
+
+// Sequential inclusive scan; returns the magnitude of the partial sums for the float tolerance.
+template <typename T>
+static auto reference(std::span<T const> in, T init, std::vector<T>& out) -> T {
+    auto sum = init;
+    auto magnitude = std::abs(static_cast<double>(init));
+    out.resize(in.size());
+    for (auto i = 0ul; i < in.size(); ++i) {
+        sum = wrap_add(sum, in[i]);
+        magnitude += std::abs(static_cast<double>(in[i]));
+        out[i] = sum;
+    }
+    return static_cast<T>(magnitude);
+}
+
+// Floating-point sums are reassociated, so only the integer results are exact.
+template <typename T>
+static auto close(T actual, T expected, T magnitude) -> bool {
+    if constexpr (std::integral<T>) return actual == expected;
+    else return std::abs(actual - expected) <= magnitude * T(1e-5) + T(1e-5);
+}
+
+template <typename T>
+static auto check_eq(T actual, T expected, T magnitude) -> void {
+    INFO(std::format("actual = {}, expected = {}", actual, expected));
+    REQUIRE(close(actual, expected, magnitude));
+}
+
+template <std::size_t N, typename T>
+static auto check_vec(std::size_t seed) -> void {
+    auto data = std::vector<T>(N);
+    DataGenerator<N, T>::random(data.data(), N, seed);
+    auto expected = std::vector<T>{};
+    auto const magnitude = reference(std::span<T const>(data), T{}, expected);
+
+    auto const v = Vec<N, T>::load(data.data(), N);
+    auto const incl = inclusive_scan(v);
+    auto const excl = exclusive_scan(v, T(3));
+    INFO(std::format("v = {}", v));
+    for (auto i = 0ul; i < N; ++i) {
+        check_eq(incl[i], expected[i], magnitude);
+        check_eq(excl[i], i == 0 ? T(3) : wrap_add(expected[i - 1], T(3)), magnitude);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Prefix Sum",
+    "[scan][algorithm]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+
+    WHEN("Vector") {
+        for (auto seed = 0ul; seed < 4; ++seed) {
+            check_vec< 1, type>(seed);
+            check_vec< 2, type>(seed);
+            check_vec< 4, type>(seed);
+            check_vec< 8, type>(seed);
+            check_vec<16, type>(seed);
+            check_vec<32, type>(seed);
+            check_vec<64, type>(seed);
+        }
+    }
+
+    WHEN("Span") {
+        for (auto n: sizes) {
+            auto in = std::vector<type>(n);
+            DataGenerator<1, type>::random(in.data(), n, n);
+            auto expected = std::vector<type>{};
+            auto const magnitude = reference(std::span<type const>(in), type(5), expected);
+            auto const total = n == 0 ? type(5) : expected.back();
+            INFO(std::format("size = {}", n));
+
+            // One extra element checks that the tail is not overwritten.
+            auto incl = std::vector<type>(n + 1, type(7));
+            check_eq(ui::inclusive_scan(std::span<type const>(in), std::span(incl).first(n), type(5)), total, magnitude);
+            for (auto i = 0ul; i < n; ++i) check_eq(incl[i], expected[i], magnitude);
+            REQUIRE(incl[n] == type(7));
+
+            auto excl = std::vector<type>(n + 1, type(7));
+            check_eq(ui::exclusive_scan(std::span<type const>(in), std::span(excl).first(n), type(5)), total, magnitude);
+            for (auto i = 0ul; i < n; ++i) check_eq(excl[i], i == 0 ? type(5) : expected[i - 1], magnitude);
+            REQUIRE(excl[n] == type(7));
+
+            // In place.
+            ui::exclusive_scan(std::span(in), std::span(in), type(5));
+            for (auto i = 0ul; i < n; ++i) REQUIRE(in[i] == excl[i]);
+        }
+    }
+
+    WHEN("Parallel span") {
+        // Uneven sizes so that the last block has a tail.
+        for (auto n: { 1000ul, (1ul << 18) + 13, (1ul << 20) + 1 }) {
+            auto in = std::vector<type>(n);
+            DataGenerator<1, type>::random(in.data(), n, n);
+            auto expected = std::vector<type>{};
+            auto const magnitude = reference(std::span<type const>(in), type(1), expected);
+            INFO(std::format("size = {}", n));
+
+            for (auto threads: { 0u, 1u, 3u, 8u }) {
+                auto incl = std::vector<type>(n);
+                auto excl = std::vector<type>(n);
+                auto const incl_total = ui::parallel_inclusive_scan(std::span<type const>(in), std::span(incl), type(1), threads);
+                auto const excl_total = ui::parallel_exclusive_scan(std::span<type const>(in), std::span(excl), type(1), threads);
+                INFO(std::format("threads = {}", threads));
+                check_eq(incl_total, expected.back(), magnitude);
+                check_eq(excl_total, expected.back(), magnitude);
+                auto mismatches = 0ul;
+                for (auto i = 0ul; i < n; ++i) {
+                    mismatches += !close(incl[i], expected[i], magnitude);
+                    mismatches += !close(excl[i], i == 0 ? type(1) : expected[i - 1], magnitude);
+                }
+                REQUIRE(mismatches == 0);
+            }
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
 
 #include <concepts>
 #include <functional>
@@ -2292,3 +2293,45 @@ TEST_CASE( VEC_ARCH_NAME " Right Shift", "[shift][right]" ) {
     }
 }
 
+template <typename T>
+struct CountFixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / std::max<unsigned>(sizeof(T) / 2, 1);
+};
+
+using CountTypes = std::tuple<
+    std::int8_t,
+    std::uint8_t,
+    std::int16_t,
+    std::uint16_t,
+    std::int32_t,
+    std::uint32_t,
+    std::int64_t,
+    std::uint64_t
+>;
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    CountFixture,
+    VEC_ARCH_NAME " Shift by a runtime count",
+    "[shift][left][right]",
+    CountTypes
+) {
+    using type = typename CountFixture<TestType>::type;
+    static constexpr auto N = CountFixture<TestType>::N;
+    auto v = DataGenerator<N, type>::random();
+    v[0] = std::numeric_limits<type>::min();
+    v[1] = std::numeric_limits<type>::max();
+    INFO("[Vec]: " << std::format("{}", v));
+
+    for (auto s = 0u; s < sizeof(type) * 8; ++s) {
+        auto const l = shift_left(v, s);
+        auto const r = shift_right(v, s);
+        auto const op_r = v >> s;
+        for (auto i = 0u; i < N; ++i) {
+            INFO("['" << i << "']: " << s);
+            REQUIRE(l[i] == static_cast<type>(static_cast<std::make_unsigned_t<type>>(v[i]) << s));
+            REQUIRE(r[i] == static_cast<type>(v[i] >> s));
+            REQUIRE(op_r[i] == r[i]);
+        }
+    }
+}
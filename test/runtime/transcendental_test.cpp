@@ -0,0 +1,386 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <array>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <numbers>
+#include <random>
+#include "ui.hpp"
+#include "ui/transcendental.hpp"
+#include "utils.hpp"
+
+using namespace ui;
+
+template <typename T>
+struct Fixture {
+    using type = T;
+    static constexpr std::size_t N = 32ul / sizeof(T);
+};
+
+using Types = std::tuple<
+    float,
+    double
+>;
+
+using HalfTypes = std::tuple<
+    float16,
+    bfloat16
+>;
+
+// Distance from the reference in units in the last place of `T`; subnormals use the smallest unit.
+template <std::floating_point T>
+static auto ulp_error(T got, long double ref) -> long double {
+    using limits = std::numeric_limits<T>;
+    if (std::isnan(ref)) return std::isnan(got) ? 0 : limits::infinity();
+    if (std::isinf(ref) || std::fabs(ref) > static_cast<long double>(limits::max())) {
+        return got == static_cast<T>(ref) ? 0 : limits::infinity();
+    }
+    if (!std::isfinite(got)) return limits::infinity();
+    auto e = 0;
+    std::frexp(std::fmax(std::fabs(ref), static_cast<long double>(limits::min())), &e);
+    auto const ulp = std::ldexp(1.0L, e - limits::digits);
+    return std::fabs(static_cast<long double>(got) - ref) / ulp;
+}
+
+// Largest error of `fn` over random lanes in [lo, hi]; `log_scale` spreads them over the exponents.
+template <std::size_t N, typename T, typename Fn, typename Ref>
+static auto max_ulp_error(Fn&& fn, Ref&& ref, T lo, T hi, bool log_scale = false) -> long double {
+    auto rng = std::mt19937(42);
+    auto dist = log_scale
+        ? std::uniform_real_distribution<T>(std::log2(lo), std::log2(hi))
+        : std::uniform_real_distribution<T>(lo, hi);
+    auto worst = 0.0L;
+    for (auto it = 0; it < 512; ++it) {
+        auto x = Vec<N, T>{};
+        for (auto i = 0ul; i < N; ++i) {
+            auto const v = dist(rng);
+            x[i] = log_scale ? std::exp2(v) : v;
+        }
+        auto const res = fn(x);
+        for (auto i = 0ul; i < N; ++i) {
+            worst = std::max(worst, ulp_error<T>(res[i], ref(static_cast<long double>(x[i]))));
+        }
+    }
+    return worst;
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Elementary Functions",
+    "[transcendental]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    using limits = std::numeric_limits<type>;
+    static constexpr auto is_float = std::same_as<type, float>;
+    // The fast variants keep at least half of the significand.
+    static constexpr auto fast_ulp = static_cast<long double>(1ull << (limits::digits / 2));
+
+    static constexpr auto exp_lo = is_float ? type(-103) : type(-744);
+    static constexpr auto exp_hi = is_float ? type(88) : type(709);
+    static constexpr auto exp2_lo = is_float ? type(-149) : type(-1074);
+    static constexpr auto exp2_hi = is_float ? type(127) : type(1023);
+    static constexpr auto log_lo = limits::denorm_min();
+    static constexpr auto log_hi = limits::max();
+
+    auto const rexp = [](long double x) { return std::exp(x); };
+    auto const rexp2 = [](long double x) { return std::exp2(x); };
+    auto const rlog = [](long double x) { return std::log(x); };
+    auto const rlog2 = [](long double x) { return std::log2(x); };
+
+    WHEN("Exponential") {
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp(v); }, rexp, exp_lo, exp_hi) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp<Accuracy::Ulp3_5>(v); }, rexp, exp_lo, exp_hi) <= 3.5);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp<Accuracy::Fast>(v); }, rexp, exp_lo, exp_hi) <= fast_ulp);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp(v); }, rexp, type(-1), type(1)) <= 1);
+
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp2(v); }, rexp2, exp2_lo, exp2_hi) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp2<Accuracy::Ulp3_5>(v); }, rexp2, exp2_lo, exp2_hi) <= 3.5);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::exp2<Accuracy::Fast>(v); }, rexp2, exp2_lo, exp2_hi) <= fast_ulp);
+
+        auto v = Vec<8, type>::load(type(0));
+        v[0] = limits::infinity();
+        v[1] = -limits::infinity();
+        v[2] = limits::quiet_NaN();
+        v[3] = exp_hi + 1;
+        v[4] = exp_lo - 10;
+        v[5] = type(10);
+        auto const e = ui::exp(v);
+        auto const e2 = ui::exp2(v);
+        REQUIRE(e[0] == limits::infinity());
+        REQUIRE(e[1] == 0);
+        REQUIRE(std::isnan(e[2]));
+        REQUIRE(e[3] == limits::infinity());
+        REQUIRE(e[4] == 0);
+        REQUIRE(e2[5] == type(1024));
+        REQUIRE(e[6] == 1);
+        REQUIRE(e[7] == 1);
+    }
+
+    WHEN("Logarithm") {
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log(v); }, rlog, log_lo, log_hi, true) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log<Accuracy::Ulp3_5>(v); }, rlog, log_lo, log_hi, true) <= 3.5);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log<Accuracy::Fast>(v); }, rlog, log_lo, log_hi, true) <= fast_ulp);
+        // Around one, where the result is small.
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log(v); }, rlog, type(0.5), type(2)) <= 1);
+
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log2(v); }, rlog2, log_lo, log_hi, true) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log2<Accuracy::Ulp3_5>(v); }, rlog2, log_lo, log_hi, true) <= 3.5);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log2<Accuracy::Fast>(v); }, rlog2, log_lo, log_hi, true) <= fast_ulp);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::log2(v); }, rlog2, type(0.5), type(2)) <= 1);
+
+        auto v = Vec<8, type>::load(type(1));
+        v[0] = limits::infinity();
+        v[1] = type(0);
+        v[2] = type(-0.0);
+        v[3] = type(-1);
+        v[4] = limits::quiet_NaN();
+        v[5] = limits::denorm_min();
+        v[6] = type(0.25);
+        auto const l = ui::log(v);
+        auto const l2 = ui::log2(v);
+        REQUIRE(l[0] == limits::infinity());
+        REQUIRE(l[1] == -limits::infinity());
+        REQUIRE(l[2] == -limits::infinity());
+        REQUIRE(std::isnan(l[3]));
+        REQUIRE(std::isnan(l[4]));
+        REQUIRE(l2[5] == type(limits::min_exponent - limits::digits));
+        REQUIRE(l2[6] == type(-2));
+        REQUIRE(l[7] == 0);
+    }
+
+    WHEN("Power") {
+        auto rng = std::mt19937(7);
+        auto dx = std::uniform_real_distribution<type>(-10, 10);
+        auto dy = std::uniform_real_distribution<type>(is_float ? -12 : -100, is_float ? 12 : 100);
+        auto worst = std::array<long double, 3>{};
+        for (auto it = 0; it < 512; ++it) {
+            auto x = Vec<N, type>{};
+            auto y = Vec<N, type>{};
+            for (auto i = 0ul; i < N; ++i) {
+                x[i] = std::exp2(dx(rng));
+                y[i] = dy(rng);
+            }
+            auto const p1 = ui::pow(x, y);
+            auto const p3 = ui::pow<Accuracy::Ulp3_5>(x, y);
+            auto const pf = ui::pow<Accuracy::Fast>(x, y);
+            for (auto i = 0ul; i < N; ++i) {
+                auto const ref = std::pow(static_cast<long double>(x[i]), static_cast<long double>(y[i]));
+                worst[0] = std::max(worst[0], ulp_error<type>(p1[i], ref));
+                worst[1] = std::max(worst[1], ulp_error<type>(p3[i], ref));
+                worst[2] = std::max(worst[2], ulp_error<type>(pf[i], ref));
+            }
+        }
+        REQUIRE(worst[0] <= 1);
+        REQUIRE(worst[1] <= 3.5);
+        REQUIRE(worst[2] <= fast_ulp);
+
+        static constexpr auto inf = limits::infinity();
+        static constexpr auto nan = limits::quiet_NaN();
+        static constexpr std::array<type, 15> values{
+            type(0), type(-0.0), type(1), type(-1), type(0.5), type(-0.5), type(2), type(-2),
+            type(3), type(-3), type(1.5), type(-1.5), inf, -inf, nan
+        };
+        for (auto a: values) {
+            for (auto b: values) {
+                auto const res = ui::pow(Vec<N, type>::load(a), Vec<N, type>::load(b))[N - 1];
+                auto const ref = std::pow(a, b);
+                INFO(std::format("pow({}, {}) = {}, expected {}", a, b, res, ref));
+                if (std::isnan(ref)) {
+                    REQUIRE(std::isnan(res));
+                } else {
+                    REQUIRE(ulp_error<type>(res, std::pow(static_cast<long double>(a), static_cast<long double>(b))) <= 1);
+                    REQUIRE(std::signbit(res) == std::signbit(ref));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Trigonometric Functions",
+    "[transcendental]",
+    Types
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    using limits = std::numeric_limits<type>;
+    static constexpr auto is_float = std::same_as<type, float>;
+    static constexpr auto pi = std::numbers::pi_v<type>;
+    // Inside and past the range of the Cody-Waite reduction.
+    static constexpr auto reduced = is_float ? type(6000) : type(1.5e6);
+    static constexpr auto large = is_float ? type(1e6) : type(1e15);
+
+    auto const rsin = [](long double x) { return std::sin(x); };
+    auto const rcos = [](long double x) { return std::cos(x); };
+    auto const rtan = [](long double x) { return std::tan(x); };
+
+    WHEN("Sine, cosine and tangent") {
+        for (auto range: { type(4), reduced, large }) {
+            INFO(std::format("range = {}", range));
+            REQUIRE(max_ulp_error<N>([](auto v) { return ui::sin(v); }, rsin, -range, range) <= 1);
+            REQUIRE(max_ulp_error<N>([](auto v) { return ui::cos(v); }, rcos, -range, range) <= 1);
+            REQUIRE(max_ulp_error<N>([](auto v) { return ui::sincos(v).first; }, rsin, -range, range) <= 1);
+            REQUIRE(max_ulp_error<N>([](auto v) { return ui::sincos(v).second; }, rcos, -range, range) <= 1);
+            REQUIRE(max_ulp_error<N>([](auto v) { return ui::tan(v); }, rtan, -range, range) <= 1.5);
+        }
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::sin(v); }, rsin, limits::min(), type(1), true) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::tan(v); }, rtan, limits::min(), type(1), true) <= 1.5);
+
+        auto v = Vec<8, type>::load(type(0));
+        v[0] = type(-0.0);
+        v[1] = limits::infinity();
+        v[2] = limits::quiet_NaN();
+        v[3] = limits::max();
+        v[4] = pi;
+        auto const s = ui::sin(v);
+        auto const c = ui::cos(v);
+        auto const t = ui::tan(v);
+        REQUIRE((s[0] == 0 && std::signbit(s[0])));
+        REQUIRE((t[0] == 0 && std::signbit(t[0])));
+        REQUIRE(c[0] == 1);
+        REQUIRE(std::isnan(s[1]));
+        REQUIRE(std::isnan(c[1]));
+        REQUIRE(std::isnan(s[2]));
+        REQUIRE(std::isnan(c[2]));
+        REQUIRE(std::isnan(t[2]));
+        REQUIRE(s[3] == std::sin(limits::max()));
+        REQUIRE(c[4] == type(-1));
+        REQUIRE((s[7] == 0 && !std::signbit(s[7])));
+    }
+
+    WHEN("Inverse functions") {
+        auto const rasin = [](long double x) { return std::asin(x); };
+        auto const racos = [](long double x) { return std::acos(x); };
+        auto const ratan = [](long double x) { return std::atan(x); };
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::asin(v); }, rasin, type(-1), type(1)) <= 1.5);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::acos(v); }, racos, type(-1), type(1)) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::atan(v); }, ratan, type(-4), type(4)) <= 1);
+        REQUIRE(max_ulp_error<N>([](auto v) { return ui::atan(v); }, ratan, limits::min(), limits::max(), true) <= 1);
+
+        auto v = Vec<8, type>::load(type(0));
+        v[0] = type(-0.0);
+        v[1] = type(1);
+        v[2] = type(-1);
+        v[3] = type(1.5);
+        v[4] = limits::quiet_NaN();
+        v[5] = -limits::infinity();
+        auto const as = ui::asin(v);
+        auto const ac = ui::acos(v);
+        auto const at = ui::atan(v);
+        REQUIRE((as[0] == 0 && std::signbit(as[0])));
+        REQUIRE((at[0] == 0 && std::signbit(at[0])));
+        REQUIRE(as[1] == std::asin(type(1)));
+        REQUIRE(ac[1] == 0);
+        REQUIRE(ac[2] == std::acos(type(-1)));
+        REQUIRE(std::isnan(as[3]));
+        REQUIRE(std::isnan(ac[3]));
+        REQUIRE(std::isnan(as[4]));
+        REQUIRE(std::isnan(at[4]));
+        REQUIRE(at[5] == std::atan(-limits::infinity()));
+    }
+
+    WHEN("Two-argument arctangent") {
+        auto rng = std::mt19937(11);
+        auto de = std::uniform_real_distribution<type>(-20, 20);
+        auto sign = std::bernoulli_distribution();
+        auto worst = 0.0L;
+        for (auto it = 0; it < 512; ++it) {
+            auto x = Vec<N, type>{};
+            auto y = Vec<N, type>{};
+            for (auto i = 0ul; i < N; ++i) {
+                x[i] = std::exp2(de(rng)) * (sign(rng) ? 1 : -1);
+                y[i] = std::exp2(de(rng)) * (sign(rng) ? 1 : -1);
+            }
+            auto const res = ui::atan2(y, x);
+            for (auto i = 0ul; i < N; ++i) {
+                auto const ref = std::atan2(static_cast<long double>(y[i]), static_cast<long double>(x[i]));
+                worst = std::max(worst, ulp_error<type>(res[i], ref));
+            }
+        }
+        REQUIRE(worst <= 2);
+
+        static constexpr auto inf = limits::infinity();
+        static constexpr auto nan = limits::quiet_NaN();
+        static constexpr std::array<type, 9> values{
+            type(0), type(-0.0), type(1), type(-1), type(3), type(-3), inf, -inf, nan
+        };
+        for (auto a: values) {
+            for (auto b: values) {
+                auto const res = ui::atan2(Vec<N, type>::load(a), Vec<N, type>::load(b))[N - 1];
+                auto const ref = std::atan2(a, b);
+                INFO(std::format("atan2({}, {}) = {}, expected {}", a, b, res, ref));
+                if (std::isnan(ref)) {
+                    REQUIRE(std::isnan(res));
+                } else {
+                    REQUIRE(ulp_error<type>(res, std::atan2(static_cast<long double>(a), static_cast<long double>(b))) <= 2);
+                    REQUIRE(std::signbit(res) == std::signbit(ref));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE_METHOD(
+    Fixture,
+    VEC_ARCH_NAME " Elementary Functions on Half-Precision Lanes",
+    "[transcendental]",
+    HalfTypes
+) {
+    using type = typename Fixture<TestType>::type;
+    static constexpr auto N = Fixture<TestType>::N;
+    // Evaluated in float and narrowed once, so the result is within one unit of the narrowed
+    // reference.
+    static constexpr auto rel = std::same_as<type, float16> ? 0x1p-10f : 0x1p-7f;
+
+    auto x = Vec<N, type>{};
+    auto y = Vec<N, type>{};
+    for (auto i = 0ul; i < N; ++i) {
+        x[i] = type(0.25f + float(i) * 0.5f);
+        y[i] = type(float(i % 7) - 3.f);
+    }
+
+    auto const check = [](auto const& res, auto&& ref, auto const& in) {
+        for (auto i = 0ul; i < N; ++i) {
+            auto const expected = float(type(ref(i)));
+            INFO(std::format("x = {}, got = {}, expected = {}", float(in[i]), float(res[i]), expected));
+            REQUIRE(std::fabs(float(res[i]) - expected) <= rel * std::fabs(expected));
+        }
+    };
+
+    WHEN("Exponential and logarithm") {
+        auto const e = ui::exp(y);
+        auto const e2 = ui::exp2(y);
+        auto const l = ui::log(x);
+        auto const l2 = ui::log2(x);
+        check(e, [&](auto i) { return std::exp(float(y[i])); }, y);
+        check(e2, [&](auto i) { return std::exp2(float(y[i])); }, y);
+        check(l, [&](auto i) { return std::log(float(x[i])); }, x);
+        check(l2, [&](auto i) { return std::log2(float(x[i])); }, x);
+    }
+
+    WHEN("Power") {
+        auto const p = ui::pow(x, y);
+        check(p, [&](auto i) { return std::pow(float(x[i]), float(y[i])); }, x);
+    }
+
+    WHEN("Trigonometric") {
+        auto u = Vec<N, type>{};
+        for (auto i = 0ul; i < N; ++i) {
+            u[i] = type(float(i) / float(N) * 1.5f - 0.75f);
+        }
+        auto const [s, c] = ui::sincos(y);
+        check(ui::sin(y), [&](auto i) { return std::sin(float(y[i])); }, y);
+        check(s, [&](auto i) { return std::sin(float(y[i])); }, y);
+        check(c, [&](auto i) { return std::cos(float(y[i])); }, y);
+        check(ui::tan(y), [&](auto i) { return std::tan(float(y[i])); }, y);
+        check(ui::asin(u), [&](auto i) { return std::asin(float(u[i])); }, u);
+        check(ui::acos(u), [&](auto i) { return std::acos(float(u[i])); }, u);
+        check(ui::atan(x), [&](auto i) { return std::atan(float(x[i])); }, x);
+        check(ui::atan2(y, x), [&](auto i) { return std::atan2(float(y[i]), float(x[i])); }, y);
+    }
+}
@@ -0,0 +1,35 @@
+#include <cstddef>
+#include <span>
+#include "ui.hpp"
+#include "ui/algorithm.hpp"
+#include "ui/dispatch.hpp"
+
+namespace kernels::UI_DISPATCH_TARGET {
+
+    auto compiled_target() -> ui::IsaTarget {
+        return ui::current_isa_target;
+    }
+
+    auto saxpy(float a, float const* x, float* y, std::size_t n) -> void {
+        using vec_t = ui::native::f32;
+        static constexpr auto N = vec_t::elements;
+
+        auto i = std::size_t{};
+        for (; i + N <= n; i += N) {
+            auto const vx = vec_t::load(x + i, N);
+            auto const vy = vec_t::load(y + i, N);
+            (a * vx + vy).store(y + i, N);
+        }
+        for (; i < n; ++i) y[i] = a * x[i] + y[i];
+    }
+
+    // F16C is part of the avx2 target.
+    auto float16_to_float(ui::float16 const* in, float* out, std::size_t n) -> void {
+        ui::convert(std::span(in, n), std::span(out, n));
+    }
+
+    auto float_to_float16(float const* in, ui::float16* out, std::size_t n) -> void {
+        ui::convert(std::span(in, n), std::span(out, n));
+    }
+
+} // namespace kernels::UI_DISPATCH_TARGET
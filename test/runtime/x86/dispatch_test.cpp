@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "ui.hpp"
+#include "ui/dispatch.hpp"
+
+namespace kernels {
+    namespace emul {
+        auto compiled_target() -> ui::IsaTarget;
+        auto saxpy(float a, float const* x, float* y, std::size_t n) -> void;
+        auto float16_to_float(ui::float16 const* in, float* out, std::size_t n) -> void;
+        auto float_to_float16(float const* in, ui::float16* out, std::size_t n) -> void;
+    }
+    namespace sse41 {
+        auto compiled_target() -> ui::IsaTarget;
+        auto saxpy(float a, float const* x, float* y, std::size_t n) -> void;
+        auto float16_to_float(ui::float16 const* in, float* out, std::size_t n) -> void;
+        auto float_to_float16(float const* in, ui::float16* out, std::size_t n) -> void;
+    }
+    namespace avx2 {
+        auto compiled_target() -> ui::IsaTarget;
+        auto saxpy(float a, float const* x, float* y, std::size_t n) -> void;
+        auto float16_to_float(ui::float16 const* in, float* out, std::size_t n) -> void;
+        auto float_to_float16(float const* in, ui::float16* out, std::size_t n) -> void;
+    }
+
+    inline auto const compiled_target = ui::Dispatcher<ui::IsaTarget()>{
+        { ui::IsaTarget::Emul,  &emul::compiled_target  },
+        { ui::IsaTarget::AVX2,  &avx2::compiled_target  },
+        { ui::IsaTarget::SSE41, &sse41::compiled_target },
+    };
+
+    inline auto const saxpy = ui::Dispatcher<void(float, float const*, float*, std::size_t)>{
+        { ui::IsaTarget::Emul,  &emul::saxpy  },
+        { ui::IsaTarget::SSE41, &sse41::saxpy },
+        { ui::IsaTarget::AVX2,  &avx2::saxpy  },
+    };
+
+    inline auto const float16_to_float = ui::Dispatcher<void(ui::float16 const*, float*, std::size_t)>{
+        { ui::IsaTarget::Emul,  &emul::float16_to_float  },
+        { ui::IsaTarget::SSE41, &sse41::float16_to_float },
+        { ui::IsaTarget::AVX2,  &avx2::float16_to_float  },
+    };
+
+    inline auto const float_to_float16 = ui::Dispatcher<void(float const*, ui::float16*, std::size_t)>{
+        { ui::IsaTarget::Emul,  &emul::float_to_float16  },
+        { ui::IsaTarget::SSE41, &sse41::float_to_float16 },
+        { ui::IsaTarget::AVX2,  &avx2::float_to_float16  },
+    };
+} // namespace kernels
+
+TEST_CASE("Runtime Dispatch", "[dispatch]") {
+    auto const best = ui::detect_isa_target();
+
+    SECTION("Detection") {
+        REQUIRE(best == ui::detect_isa_target());
+        REQUIRE(ui::is_isa_supported(ui::IsaTarget::Emul));
+        REQUIRE(ui::is_isa_supported(best));
+        REQUIRE(!ui::is_isa_supported(ui::IsaTarget::Neon));
+        REQUIRE(!ui::is_isa_supported(ui::IsaTarget::Wasm));
+        // Each copy reports the target it was built for.
+        REQUIRE(kernels::emul::compiled_target() == ui::IsaTarget::Emul);
+        if (ui::is_isa_supported(ui::IsaTarget::SSE41)) {
+            REQUIRE(kernels::sse41::compiled_target() == ui::IsaTarget::SSE41);
+        }
+        if (ui::is_isa_supported(ui::IsaTarget::AVX2)) {
+            REQUIRE(kernels::avx2::compiled_target() == ui::IsaTarget::AVX2);
+        }
+    }
+
+    SECTION("Selection") {
+        auto expected = ui::IsaTarget::Emul;
+        if (ui::is_isa_supported(ui::IsaTarget::SSE41)) expected = ui::IsaTarget::SSE41;
+        if (ui::is_isa_supported(ui::IsaTarget::AVX2)) expected = ui::IsaTarget::AVX2;
+
+        REQUIRE(kernels::compiled_target.target() == expected);
+        REQUIRE(kernels::compiled_target() == expected);
+        REQUIRE(kernels::saxpy.target() == expected);
+    }
+
+    SECTION("Every variant computes the same result") {
+        static constexpr std::size_t n = 67;
+        std::vector<float> x(n), y(n), expected(n);
+        for (auto i = 0ul; i < n; ++i) {
+            x[i] = static_cast<float>(i) * 0.5f;
+            y[i] = static_cast<float>(n - i);
+            expected[i] = 3.f * x[i] + y[i];
+        }
+
+        auto check = [&](auto fn) {
+            auto res = y;
+            fn(3.f, x.data(), res.data(), n);
+            for (auto i = 0ul; i < n; ++i) {
+                REQUIRE(res[i] == expected[i]);
+            }
+        };
+
+        check(kernels::saxpy);
+        check(&kernels::emul::saxpy);
+        if (ui::is_isa_supported(ui::IsaTarget::SSE41)) check(&kernels::sse41::saxpy);
+        if (ui::is_isa_supported(ui::IsaTarget::AVX2)) check(&kernels::avx2::saxpy);
+    }
+
+    SECTION("float16 conversion matches across variants") {
+        // Every float16 encoding, and floats around and beyond the float16 range.
+        std::vector<ui::float16> halves(1 << 16);
+        for (auto i = 0u; i < halves.size(); ++i) halves[i] = std::bit_cast<ui::float16>(static_cast<std::uint16_t>(i));
+        std::vector<float> floats(1 << 16);
+        for (auto i = 0u; i < floats.size(); ++i) floats[i] = std::bit_cast<float>((i << 15) | (i & 0x7FFF));
+
+        auto const widen = [&](auto fn) {
+            std::vector<float> res(halves.size());
+            fn(halves.data(), res.data(), res.size());
+            return res;
+        };
+        auto const narrow = [&](auto fn) {
+            std::vector<ui::float16> res(floats.size());
+            fn(floats.data(), res.data(), res.size());
+            return res;
+        };
+        auto const same = [](auto const& a, auto const& b) {
+            REQUIRE(std::memcmp(a.data(), b.data(), a.size() * sizeof(a[0])) == 0);
+        };
+
+        auto const wide = widen(&kernels::emul::float16_to_float);
+        auto const narrowed = narrow(&kernels::emul::float_to_float16);
+        same(widen(kernels::float16_to_float), wide);
+        same(narrow(kernels::float_to_float16), narrowed);
+        if (ui::is_isa_supported(ui::IsaTarget::SSE41)) {
+            same(widen(&kernels::sse41::float16_to_float), wide);
+            same(narrow(&kernels::sse41::float_to_float16), narrowed);
+        }
+        if (ui::is_isa_supported(ui::IsaTarget::AVX2)) {
+            same(widen(&kernels::avx2::float16_to_float), wide);
+            same(narrow(&kernels::avx2::float_to_float16), narrowed);
+        }
+    }
+}